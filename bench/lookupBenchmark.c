@@ -0,0 +1,123 @@
+/*
+ * Description: Measures the cost of classifying the words of a line as reserved words -
+ *              the linear search over the instructions/directives tables (the previous lookup),
+ *              against the perfect hash table of 'reservedWords.c'.
+ *
+ * Build (from the repository root, every source file except the one holding 'main'):
+ *     gcc -ansi -pedantic -Wall -O2 -o lookupBenchmark bench/lookupBenchmark.c $(ls src/[a-z]*.c | grep -v assembler.c)
+ * Run:
+ *     ./lookupBenchmark [number of lines]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../include/instructions.h"
+#include "../include/directives.h"
+#include "../include/reservedWords.h"
+
+/* The default number of simulated lines */
+#define defaultNumberOfLines 20000000L
+
+
+/*
+   The words classified for each simulated line: a label definition (checked against the reserved words),
+   followed by an instruction name or a directive name. The mix resembles the sample inputs in 'tests'.
+*/
+static const char *lineWords[][2] = {
+        {"MAIN", "add"}, {"LOOP", "bne"}, {"", "move"}, {"END", "stop"}, {"", "lw"},
+        {"STR", "asciz"}, {"LIST", "db"}, {"", "jmp"}, {"K", "dw"}, {"", "entry"},
+        {"Next", "call"}, {"", "extern"}, {"x", "addi"}, {"", "sh"}, {"labelV3", "blt"},
+        {"", "mvhi"}, {"", "la"}, {"ARR", "dh"}, {"", "nori"}, {"", "sb"}
+};
+
+
+/* The previous lookup - compares the word against every instruction name, then against every directive name */
+static int linearLookup(const char *word)
+{
+    int i, numberOfInstructions, numberOfDirectives;
+    instructionWord *instruction = getReservedInstructions(&numberOfInstructions);
+    directiveWord *directive = getReservedDirectives(&numberOfDirectives);
+
+    for(i = 0; i < numberOfInstructions; i++)
+        if(strcmp(word, instruction[i].name) == 0)
+            return i;
+    for(i = 0; i < numberOfDirectives; i++)
+        if(strcmp(word, directive[i].name) == 0)
+            return numberOfInstructions + i;
+    return -1;
+}
+
+
+/* The current lookup - one hash and one compare */
+static int hashedLookup(const char *word)
+{
+    int numberOfInstructions;
+    const reservedWord *slot = findReservedWord(word);
+
+    getReservedInstructions(&numberOfInstructions);
+    if(slot == NULL)
+        return -1;
+    return (slot->type == reservedInstruction) ? slot->index : numberOfInstructions + slot->index;
+}
+
+
+/* Classifies the words of the given number of lines, returns the elapsed time in seconds */
+static double runLookups(int (*lookup)(const char *), long numberOfLines, long *checksum)
+{
+    long i;
+    int numberOfWords = sizeof(lineWords) / sizeof(lineWords[0]);
+    clock_t start = clock();
+
+    for(i = 0; i < numberOfLines; i++)
+    {
+        const char **words = lineWords[i % numberOfWords];
+        /* The label is classified only if the line defines one, like in 'labelIsValid' */
+        if(words[0][0] != '\0')
+            *checksum += lookup(words[0]);
+        *checksum += lookup(words[1]);
+    }
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+
+int main(int argc, char *argv[])
+{
+    long numberOfLines = (argc > 1) ? atol(argv[1]) : defaultNumberOfLines;
+    long linearChecksum = 0, hashedChecksum = 0;
+    double linearTime, hashedTime;
+    int i, numberOfInstructions, numberOfDirectives;
+    instructionWord *instruction = getReservedInstructions(&numberOfInstructions);
+    directiveWord *directive = getReservedDirectives(&numberOfDirectives);
+
+    /* Every reserved word must be found in its own slot, pointing back at its table entry */
+    for(i = 0; i < numberOfInstructions; i++)
+        if(linearLookup(instruction[i].name) != hashedLookup(instruction[i].name))
+        {
+            fprintf(stderr, "Error: instruction '%s' isn't in its slot.\n", instruction[i].name);
+            return 1;
+        }
+    for(i = 0; i < numberOfDirectives; i++)
+        if(linearLookup(directive[i].name) != hashedLookup(directive[i].name))
+        {
+            fprintf(stderr, "Error: directive '%s' isn't in its slot.\n", directive[i].name);
+            return 1;
+        }
+
+    if(numberOfLines <= 0)
+        numberOfLines = defaultNumberOfLines;
+
+    linearTime = runLookups(linearLookup, numberOfLines, &linearChecksum);
+    hashedTime = runLookups(hashedLookup, numberOfLines, &hashedChecksum);
+    if(linearChecksum != hashedChecksum)
+    {
+        fprintf(stderr, "Error: the lookups disagree.\n");
+        return 1;
+    }
+
+    printf("lines: %ld\n", numberOfLines);
+    printf("linear search: %.2f ns per line\n", linearTime * 1e9 / numberOfLines);
+    printf("perfect hash:  %.2f ns per line\n", hashedTime * 1e9 / numberOfLines);
+    return 0;
+}
@@ -0,0 +1,223 @@
+/*
+ * Description: Measures the speed of the simulator, in simulated instructions per second on one core.
+ *              A loop of arithmetic, loads, stores and branches is assembled in memory and run on the predecoded
+ *              (threaded) simulator, then on a reference interpreter that decodes the bit fields of every instruction
+ *              it executes. Both must end with the same registers and the same number of executed instructions.
+ *              The results are printed to stdout as JSON.
+ *
+ * Build (from the repository root, every source file except the one holding the assembler's 'main'):
+ *     gcc -ansi -pedantic -Wall -O2 -o simulatorBenchmark bench/simulatorBenchmark.c $(ls src/[a-z]*.c | grep -v /assembler.c) -pthread
+ * Run:
+ *     ./simulatorBenchmark [--iterations N] [--repeat N]
+ * The loop runs N times 10000 iterations of its body (default N: 3000, about 210M instructions).
+ * The exit status is 1 if the runs don't agree, or if the simulator runs less than 200M instructions per second.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/structs.h"
+#include "../include/libassembler.h"
+#include "../include/simulator.h"
+#include "../include/tables.h"
+#include "../include/statistics.h"
+
+/* The default number of iterations of the outer loop */
+#define defaultIterations 3000L
+
+/* The default number of timed runs, the fastest one is reported */
+#define defaultRepeat 3
+
+/* The number of simulated instructions per second the simulator should reach */
+#define targetRate 200e6
+
+
+/*
+   The benchmarked program. The inner loop (7 instructions) runs 10000 times per iteration of the outer loop,
+   the number of iterations is loaded from 'COUNT' (patched in memory before every run).
+*/
+static const char *benchmarkSource =
+        "        la COUNT\n"
+        "        lw $0, 0, $2\n"
+        "        addi $1, 10000, $9\n"
+        "        la BUFFER\n"
+        "        add $0, $1, $10\n"
+        "OUTER:  addi $1, 0, $3\n"
+        "INNER:  add $4, $3, $4\n"
+        "        and $4, $9, $5\n"
+        "        lw $10, 0, $6\n"
+        "        sub $6, $5, $6\n"
+        "        sw $10, 0, $6\n"
+        "        addi $3, 1, $3\n"
+        "        blt $3, $9, INNER\n"
+        "        subi $2, 1, $2\n"
+        "        bgt $2, $1, OUTER\n"
+        "        stop\n"
+        "COUNT:  .dw 0\n"
+        "BUFFER: .dw 0\n";
+
+
+/*
+   The reference interpreter, which decodes every instruction it executes from memory.
+   Returns the number of executed instructions, the registers are left in 'registers'.
+*/
+static unsigned long decodingRun(const simulator *machine, unsigned int *registers)
+{
+    unsigned char *memory = machine->memory;
+    unsigned long steps = 0, address;
+    unsigned int word, *reg = registers;
+    long pc = ICInitialValue;
+    codeType data;
+
+    for(;;)
+    {
+        if(pc < ICInitialValue || pc >= machine->codeEnd)
+            return steps;
+        word = (unsigned int)memory[pc] | (unsigned int)memory[pc + 1] << 8 |
+               (unsigned int)memory[pc + 2] << 16 | (unsigned int)memory[pc + 3] << 24;
+        memcpy(&data, &word, sizeof(word));
+        steps++;
+        pc += 4;
+
+        switch(data.typeJ.opcode)
+        {
+            case 0:
+                switch(data.typeR.funct)
+                {
+                    case 1: reg[data.typeR.rd] = reg[data.typeR.rs] + reg[data.typeR.rt]; break;
+                    case 2: reg[data.typeR.rd] = reg[data.typeR.rs] - reg[data.typeR.rt]; break;
+                    case 3: reg[data.typeR.rd] = reg[data.typeR.rs] & reg[data.typeR.rt]; break;
+                    case 4: reg[data.typeR.rd] = reg[data.typeR.rs] | reg[data.typeR.rt]; break;
+                    case 5: reg[data.typeR.rd] = ~(reg[data.typeR.rs] | reg[data.typeR.rt]); break;
+                    default: return steps;
+                }
+                break;
+            case 1:
+                switch(data.typeR.funct)
+                {
+                    case 1: reg[data.typeR.rd] = reg[data.typeR.rs]; break;
+                    case 2: reg[data.typeR.rd] = reg[data.typeR.rs] >> 16 & 0xFFFF; break;
+                    case 3: reg[data.typeR.rd] = reg[data.typeR.rs] & 0xFFFF; break;
+                    default: return steps;
+                }
+                break;
+            case 10: reg[data.typeI.rt] = reg[data.typeI.rs] + (unsigned int)data.typeI.immed; break;
+            case 11: reg[data.typeI.rt] = reg[data.typeI.rs] - (unsigned int)data.typeI.immed; break;
+            case 12: reg[data.typeI.rt] = reg[data.typeI.rs] & (unsigned int)data.typeI.immed; break;
+            case 13: reg[data.typeI.rt] = reg[data.typeI.rs] | (unsigned int)data.typeI.immed; break;
+            case 14: reg[data.typeI.rt] = ~(reg[data.typeI.rs] | (unsigned int)data.typeI.immed); break;
+            case 15: if(reg[data.typeI.rs] != reg[data.typeI.rt]) pc += data.typeI.immed - 4; break;
+            case 16: if(reg[data.typeI.rs] == reg[data.typeI.rt]) pc += data.typeI.immed - 4; break;
+            case 17: if((int)reg[data.typeI.rs] < (int)reg[data.typeI.rt]) pc += data.typeI.immed - 4; break;
+            case 18: if((int)reg[data.typeI.rs] > (int)reg[data.typeI.rt]) pc += data.typeI.immed - 4; break;
+            case 21: case 22:
+                address = (unsigned long)(reg[data.typeI.rs] + (unsigned int)data.typeI.immed);
+                if(address > machine->memorySize - 4)
+                    return steps;
+                if(data.typeI.opcode == 21)
+                    reg[data.typeI.rt] = (unsigned int)memory[address] | (unsigned int)memory[address + 1] << 8 |
+                            (unsigned int)memory[address + 2] << 16 | (unsigned int)memory[address + 3] << 24;
+                else
+                {
+                    memory[address] = (unsigned char)(reg[data.typeI.rt] & 0xFF);
+                    memory[address + 1] = (unsigned char)(reg[data.typeI.rt] >> 8 & 0xFF);
+                    memory[address + 2] = (unsigned char)(reg[data.typeI.rt] >> 16 & 0xFF);
+                    memory[address + 3] = (unsigned char)(reg[data.typeI.rt] >> 24 & 0xFF);
+                }
+                break;
+            case 30: pc = data.typeJ.reg ? (long)reg[data.typeJ.address & maxRegister] : (long)data.typeJ.address; break;
+            case 31: reg[0] = data.typeJ.address; break;
+            case 32: reg[0] = (unsigned int)pc; pc = (long)data.typeJ.address; break;
+            /* 'stop', and the byte/half word loads and stores the benchmarked program doesn't use */
+            default: return steps;
+        }
+    }
+}
+
+
+/* Stores the number of iterations of the outer loop in 'COUNT', the first word of the data image */
+static void setIterations(simulator *machine, long iterations)
+{
+    unsigned char *count = machine->memory + machine->codeEnd;
+
+    count[0] = (unsigned char)(iterations & 0xFF);
+    count[1] = (unsigned char)(iterations >> 8 & 0xFF);
+    count[2] = (unsigned char)(iterations >> 16 & 0xFF);
+    count[3] = (unsigned char)(iterations >> 24 & 0xFF);
+}
+
+
+int main(int argc, char *argv[])
+{
+    int i, run, repeat = defaultRepeat;
+    long iterations = defaultIterations;
+    double start, seconds, threadedBest = 0, decodingBest = 0;
+    unsigned long decodingSteps = 0;
+    unsigned int decodingRegisters[numOfRegisters];
+    assemblyContext context = {0};
+    simulator machine = {0};
+    bool agree;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc)
+            iterations = strtol(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc)
+            repeat = atoi(argv[++i]);
+        else
+        {
+            fprintf(stderr, "Error: unknown option '%s'.\n", argv[i]);
+            return 1;
+        }
+    }
+    if (iterations < 1 || repeat < 1)
+    {
+        fprintf(stderr, "Error: the iterations and the repeats must be positive.\n");
+        return 1;
+    }
+
+    context.errors = stderr;
+    if (assembleSource(&context, NULL, "simulatorBenchmark.as", benchmarkSource, strlen(benchmarkSource)) == INVALID ||
+        loadSimulator(&machine, &context.codeImage, &context.dataImage) == INVALID)
+    {
+        freeAssemblyContext(&context);
+        return 1;
+    }
+
+    for (run = 0; run < repeat; run++)
+    {
+        /* The program and the machine are reset before every run */
+        memset(machine.registers, 0, sizeof(machine.registers));
+        memset(machine.memory + machine.codeEnd, 0, 8);
+        setIterations(&machine, iterations);
+        machine.steps = 0;
+        start = secondsNow();
+        runSimulator(&machine);
+        seconds = secondsNow() - start;
+        if (threadedBest == 0 || seconds < threadedBest)
+            threadedBest = seconds;
+
+        memset(decodingRegisters, 0, sizeof(decodingRegisters));
+        memset(machine.memory + machine.codeEnd, 0, 8);
+        setIterations(&machine, iterations);
+        start = secondsNow();
+        decodingSteps = decodingRun(&machine, decodingRegisters);
+        seconds = secondsNow() - start;
+        if (decodingBest == 0 || seconds < decodingBest)
+            decodingBest = seconds;
+    }
+
+    agree = (machine.fault == NULL && machine.steps == decodingSteps &&
+             memcmp(machine.registers, decodingRegisters, sizeof(decodingRegisters)) == 0) ? TRUE : FALSE;
+    printf("{\n  \"instructions\": %lu,\n  \"agree\": %s,\n", machine.steps, agree ? "true" : "false");
+    printf("  \"predecoded\": {\"seconds\": %.6f, \"instructionsPerSecond\": %.0f},\n",
+           threadedBest, (double)machine.steps / threadedBest);
+    printf("  \"decoding\": {\"seconds\": %.6f, \"instructionsPerSecond\": %.0f},\n",
+           decodingBest, (double)decodingSteps / decodingBest);
+    printf("  \"speedup\": %.2f\n}\n", decodingBest / threadedBest);
+
+    i = (agree && (double)machine.steps / threadedBest >= targetRate) ? 0 : 1;
+    freeSimulator(&machine);
+    freeAssemblyContext(&context);
+    return i;
+}
@@ -0,0 +1,419 @@
+/*
+ * Description: Generates large synthetic sources (seeded, so every run sees the same sources) in several shapes,
+ *              assembles them in memory and times each phase of the assembly - 'firstPass', 'relaxBranches',
+ *              'updateValues', 'secondPass' and 'createOutputFiles' - for sources of 1k up to 1M lines.
+ *              The results are printed to stdout as JSON, so scaling curves can be compared between versions.
+ *
+ * Build (from the repository root, every source file except the one holding the assembler's 'main'):
+ *     gcc -ansi -pedantic -Wall -O2 -o workloadBenchmark bench/workloadBenchmark.c $(ls src/[a-z]*.c | grep -v /assembler.c) -pthread
+ * Run:
+ *     ./workloadBenchmark [--seed N] [--max-lines N] [--shape NAME] [--repeat N] > results.json
+ *     ./workloadBenchmark --emit NAME LINES FILE [--seed N]      (writes a generated source, e.g. for the assembler)
+ * Shapes:
+ *     labels   - every line defines a label, 'jmp'/'la'/'call' to labels anywhere in the file (forward and backward).
+ *     branches - conditional branches to nearby labels, the distances are encoded in the second pass.
+ *     far      - conditional branches to labels anywhere in the file, beyond 32KB of code most of them are relaxed.
+ *     data     - '.dw'/'.dh'/'.db'/'.asciz' directives with labels, and 'la' instructions loading their addresses.
+ *     externs  - many '.extern' labels referenced by 'jmp'/'la'/'call', and many '.entry' directives.
+ *     errors   - a quarter of the lines hold errors, the file is reported and no output file is created.
+ */
+
+/* For 'open_memstream' */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/structs.h"
+#include "../include/firstPass.h"
+#include "../include/secondPass.h"
+#include "../include/files.h"
+#include "../include/lineHandling.h"
+#include "../include/createOutputFiles.h"
+#include "../include/relaxation.h"
+#include "../include/tables.h"
+#include "../include/options.h"
+#include "../include/general.h"
+#include "../include/statistics.h"
+
+/* The default seed of the generator */
+#define defaultSeed 1L
+
+/* The default size of the largest generated source, in lines */
+#define defaultMaxLines 1000000L
+
+/* The name the generated sources are assembled as, their output files are removed once they're timed */
+#define benchmarkFileName "workloadBenchmark.as"
+
+/* The number of timed phases, see 'phaseNames' */
+#define numOfPhases 6
+
+
+typedef void (*lineGenerator)(FILE *out, long lineIndex, long numOfLines);
+
+static const char *phaseNames[numOfPhases] = {"loadSource", "firstPass", "relaxation", "updateValues", "secondPass",
+                                                "createOutputFiles"};
+
+static const long sourceSizes[] = {1000L, 10000L, 100000L, 1000000L};
+
+static const char *registerPairs[] = {"$1, $2", "$3, $4", "$5, $6", "$7, $8", "$30, $31", "$0, $9"};
+
+
+/* A linear congruential generator, independent of the C library, so the sources are the same on every platform */
+static unsigned long randomState;
+
+static long randomBelow(long bound)
+{
+    randomState = (randomState * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+    return (long)((randomState >> 8) % (unsigned long)bound);
+}
+
+static const char *randomRegisters(void)
+{
+    return registerPairs[randomBelow(sizeof(registerPairs) / sizeof(registerPairs[0]))];
+}
+
+
+/* Every line defines a label, the label operands point anywhere in the file, so most of them are forward references */
+static void labelsLine(FILE *out, long lineIndex, long numOfLines)
+{
+    switch(randomBelow(6))
+    {
+        case 0: fprintf(out, "L%ld: add %s, $3\n", lineIndex, randomRegisters()); break;
+        case 1: fprintf(out, "L%ld: jmp L%ld\n", lineIndex, randomBelow(numOfLines)); break;
+        case 2: fprintf(out, "L%ld: la L%ld\n", lineIndex, randomBelow(numOfLines)); break;
+        case 3: fprintf(out, "L%ld: call L%ld\n", lineIndex, randomBelow(numOfLines)); break;
+        case 4: fprintf(out, "L%ld: lw $4, %ld, $5\n", lineIndex, randomBelow(2000) - 1000); break;
+        default: fprintf(out, "L%ld: move $%ld, $%ld\n", lineIndex, randomBelow(32), randomBelow(32));
+    }
+}
+
+
+/* Conditional branches to labels up to 500 lines away, well within the 16 bits distance of an I instruction */
+static void branchesLine(FILE *out, long lineIndex, long numOfLines)
+{
+    static const char *branches[] = {"bne", "beq", "blt", "bgt"};
+    long target = lineIndex + randomBelow(1001) - 500;
+
+    if(target < 0)
+        target = 0;
+    if(target >= numOfLines)
+        target = numOfLines - 1;
+    if(randomBelow(4) == 0)
+        fprintf(out, "B%ld: addi $1, %ld, $1\n", lineIndex, randomBelow(100));
+    else
+        fprintf(out, "B%ld: %s %s, B%ld\n", lineIndex, branches[randomBelow(4)], randomRegisters(), target);
+}
+
+
+/* Conditional branches to labels anywhere in the file, the far ones are relaxed into an inverted branch and a 'jmp' */
+static void farBranchesLine(FILE *out, long lineIndex, long numOfLines)
+{
+    static const char *branches[] = {"bne", "beq", "blt", "bgt"};
+
+    if(randomBelow(2) == 0)
+        fprintf(out, "F%ld: sub %s, $5\n", lineIndex, randomRegisters());
+    else
+        fprintf(out, "F%ld: %s %s, F%ld\n", lineIndex, branches[randomBelow(4)], randomRegisters(),
+                randomBelow(numOfLines));
+}
+
+
+/* Data directives with labels, and instructions loading the addresses of earlier data labels */
+static void dataLine(FILE *out, long lineIndex, long numOfLines)
+{
+    (void)numOfLines;
+    switch(randomBelow(6))
+    {
+        case 0: fprintf(out, "D%ld: .dw %ld, -7, 1024, %ld, 0, 2147483647\n", lineIndex, randomBelow(100000),
+                        -randomBelow(100000)); break;
+        case 1: fprintf(out, "D%ld: .dh 1, -2, 32767, -32768, %ld\n", lineIndex, randomBelow(30000)); break;
+        case 2: fprintf(out, "D%ld: .db 1, 2, 3, 4, 5, 6, 7, -128, 127, %ld\n", lineIndex, randomBelow(100)); break;
+        case 3: fprintf(out, "D%ld: .asciz \"synthetic string number %ld\"\n", lineIndex, randomBelow(1000000)); break;
+        case 4: fprintf(out, "D%ld: la D%ld\n", lineIndex, (lineIndex > 0) ? randomBelow(lineIndex) : 0); break;
+        default: fprintf(out, "D%ld: sw $2, %ld, $3\n", lineIndex, randomBelow(64));
+    }
+}
+
+
+/* The index of the last line that defined a label, the '.entry' directives of the 'externs' shape refer to it */
+static long lastLabelLine;
+
+/* One external label for every 8 lines, referenced from everywhere, and '.entry' directives for the local labels */
+static void externsLine(FILE *out, long lineIndex, long numOfLines)
+{
+    long numOfExterns = numOfLines / 8 + 1;
+
+    if(lineIndex < numOfExterns)
+    {
+        fprintf(out, ".extern X%ld\n", lineIndex);
+        lastLabelLine = -1;
+        return;
+    }
+    switch((lastLabelLine < 0) ? 0 : randomBelow(5))
+    {
+        case 0: fprintf(out, "E%ld: call X%ld\n", lineIndex, randomBelow(numOfExterns)); break;
+        case 1: fprintf(out, "E%ld: jmp X%ld\n", lineIndex, randomBelow(numOfExterns)); break;
+        case 2: fprintf(out, "E%ld: la X%ld\n", lineIndex, randomBelow(numOfExterns)); break;
+        case 3: fprintf(out, ".entry E%ld\n", lastLabelLine); return;
+        default: fprintf(out, "E%ld: add %s, $3\n", lineIndex, randomRegisters());
+    }
+    lastLabelLine = lineIndex;
+}
+
+
+/* A quarter of the lines hold an error, found in the first pass - every one of them is reported */
+static void errorsLine(FILE *out, long lineIndex, long numOfLines)
+{
+    if(randomBelow(4) != 0)
+    {
+        labelsLine(out, lineIndex, numOfLines);
+        return;
+    }
+    switch(randomBelow(6))
+    {
+        case 0: fprintf(out, "L%ld: add $1, $2\n", lineIndex); break;
+        case 1: fprintf(out, "L%ld: addi $1, 99999999, $2\n", lineIndex); break;
+        case 2: fprintf(out, "L%ld: move $40, $1\n", lineIndex); break;
+        case 3: fprintf(out, "L%ld: .dw 1,, 2\n", lineIndex); break;
+        case 4: fprintf(out, "L%ld: .asciz \"unterminated\n", lineIndex); break;
+        default: fprintf(out, "L%ld: L%ld: stop\n", lineIndex, lineIndex);
+    }
+}
+
+
+static const char *shapeNames[] = {"labels", "branches", "far", "data", "externs", "errors"};
+
+static const lineGenerator shapeGenerators[] = {labelsLine, branchesLine, farBranchesLine, dataLine, externsLine,
+                                                errorsLine};
+
+#define numOfShapes ((int)(sizeof(shapeNames) / sizeof(shapeNames[0])))
+
+
+static int findShape(const char *name)
+{
+    int i;
+
+    for(i = 0; i < numOfShapes; i++)
+        if(strcmp(name, shapeNames[i]) == 0)
+            return i;
+    fprintf(stderr, "Error: unknown shape '%s'.\n", name);
+    return -1;
+}
+
+
+/* Generates a source of the given shape, every line ends with '\n' and the last line is 'stop' */
+static char *generateSource(int shape, long numOfLines, long seed, size_t *size)
+{
+    char *content;
+    long i;
+    FILE *out = openMemoryStream(&content, size);
+
+    randomState = (unsigned long)seed * 2654435761UL + (unsigned long)shape;
+    /* The generators refer only to the labels of the lines before the last one */
+    for(i = 0; i < numOfLines - 1; i++)
+        shapeGenerators[shape](out, i, numOfLines - 1);
+    fprintf(out, "stop\n");
+    fclose(out);
+    return content;
+}
+
+
+/* Assembles the source in memory, like 'fileIsValid' and 'createOutputFiles', timing each phase.
+   A phase that isn't reached (the file is invalid) is timed as -1. Returns whether the source is valid */
+static state timePhases(const char *content, size_t size, const assemblerOptions *options, FILE *errors,
+                        double seconds[numOfPhases])
+{
+    assemblyContext context = {0};
+    newLine line = {0};
+    long instructionCounter = ICInitialValue;
+    state sourceState = INVALID;
+    double start;
+    int i;
+
+    for(i = 0; i < numOfPhases; i++)
+        seconds[i] = -1;
+    context.options = options;
+    context.errors = errors;
+    line.sourceFileName = benchmarkFileName;
+
+    start = secondsNow();
+    loadSourceBuffer(content, (unsigned long)size, &context.source);
+    seconds[0] = secondsNow() - start;
+
+    start = secondsNow();
+    if(firstPass(&line, &instructionCounter, &context) == VALID)
+    {
+        seconds[1] = secondsNow() - start;
+
+        start = secondsNow();
+        relaxBranches(&context, &instructionCounter);
+        seconds[2] = secondsNow() - start;
+
+        start = secondsNow();
+        updateValues(&context.ICF, &context.DCF, instructionCounter, (long)context.dataImage.size, &context.symbolTab);
+        seconds[3] = secondsNow() - start;
+
+        start = secondsNow();
+        sourceState = secondPass(&line, &context);
+        seconds[4] = secondsNow() - start;
+
+        if(sourceState == VALID)
+        {
+            start = secondsNow();
+            createOutputFiles(benchmarkFileName, &context);
+            seconds[5] = secondsNow() - start;
+        }
+    }
+    else
+        seconds[1] = secondsNow() - start;
+
+    freeAssemblyContext(&context);
+    return sourceState;
+}
+
+
+static void removeOutputFiles(void)
+{
+    static const char *extensions[] = {".ob", ".ent", ".ext"};
+    char *fileName;
+    int i;
+
+    for(i = 0; i < 3; i++)
+    {
+        fileName = getFileFullName(benchmarkFileName, (char *) extensions[i]);
+        remove(fileName);
+        free(fileName);
+    }
+}
+
+
+static void printSeconds(double seconds)
+{
+    if(seconds < 0)
+        printf("null");
+    else
+        printf("%.6f", seconds);
+}
+
+
+/* Times every shape in every size up to 'maxLines' (keeping the fastest of 'repeat' runs), printing one JSON document */
+static int runBenchmark(long seed, long maxLines, int onlyShape, long repeat)
+{
+    assemblerOptions options;
+    double seconds[numOfPhases], best[numOfPhases], total;
+    int shape, size, i, isFirst = 1;
+    long run, numOfSizes = sizeof(sourceSizes) / sizeof(sourceSizes[0]);
+    char *content;
+    size_t contentSize;
+    state sourceState = INVALID;
+    /* The errors of the error-heavy sources are counted by the assembler, their text isn't part of the measure */
+    FILE *errors = fopen("/dev/null", "w");
+
+    if(errors == NULL && (errors = tmpfile()) == NULL)
+    {
+        fprintf(stderr, "Error: failed to open a stream for the diagnostics.\n");
+        return 1;
+    }
+    setDefaultOptions(&options);
+
+    printf("{\n  \"benchmark\": \"workload\",\n  \"assemblerVersion\": \"%s\",\n", assemblerVersion);
+    printf("  \"seed\": %ld,\n  \"repeat\": %ld,\n  \"unit\": \"seconds\",\n  \"results\": [", seed, repeat);
+    for(shape = 0; shape < numOfShapes; shape++)
+    {
+        if(onlyShape >= 0 && shape != onlyShape)
+            continue;
+        for(size = 0; size < numOfSizes && sourceSizes[size] <= maxLines; size++)
+        {
+            content = generateSource(shape, sourceSizes[size], seed, &contentSize);
+            for(run = 0; run < repeat; run++)
+            {
+                sourceState = timePhases(content, contentSize, &options, errors, seconds);
+                for(i = 0; i < numOfPhases; i++)
+                    best[i] = (run == 0 || seconds[i] < best[i]) ? seconds[i] : best[i];
+            }
+            free(content);
+            removeOutputFiles();
+
+            printf("%s\n    {\"shape\": \"%s\", \"lines\": %ld, \"bytes\": %lu, \"valid\": %s, \"phases\": {",
+                   isFirst ? "" : ",", shapeNames[shape], sourceSizes[size], (unsigned long)contentSize,
+                   (sourceState == VALID) ? "true" : "false");
+            for(i = 0, total = 0; i < numOfPhases; i++)
+            {
+                printf("%s\"%s\": ", (i == 0) ? "" : ", ", phaseNames[i]);
+                printSeconds(best[i]);
+                total += (best[i] < 0) ? 0 : best[i];
+            }
+            printf("}, \"total\": %.6f}", total);
+            fflush(stdout);
+            isFirst = 0;
+        }
+    }
+    printf("\n  ]\n}\n");
+    fclose(errors);
+    return 0;
+}
+
+
+/* Writes a generated source to a file, so it can be fed to the assembler itself */
+static int emitSource(const char *shapeName, const char *lines, const char *fileName, long seed)
+{
+    int shape = findShape(shapeName);
+    long numOfLines = atol(lines);
+    char *content;
+    size_t size;
+    FILE *out;
+
+    if(shape < 0)
+        return 1;
+    if(numOfLines <= 0)
+    {
+        fprintf(stderr, "Error: the number of lines must be positive.\n");
+        return 1;
+    }
+    if(openFile(&out, fileName, "w", stderr) == INVALID)
+        return 1;
+    content = generateSource(shape, numOfLines, seed, &size);
+    fwrite(content, 1, size, out);
+    fclose(out);
+    free(content);
+    return 0;
+}
+
+
+int main(int argc, char *argv[])
+{
+    long seed = defaultSeed, maxLines = defaultMaxLines, repeat = 1;
+    int i, onlyShape = -1, emitIndex = 0;
+
+    for(i = 1; i < argc; i++)
+    {
+        if(strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            seed = atol(argv[++i]);
+        else if(strcmp(argv[i], "--max-lines") == 0 && i + 1 < argc)
+            maxLines = atol(argv[++i]);
+        else if(strcmp(argv[i], "--repeat") == 0 && i + 1 < argc)
+            repeat = atol(argv[++i]);
+        else if(strcmp(argv[i], "--shape") == 0 && i + 1 < argc)
+        {
+            if((onlyShape = findShape(argv[++i])) < 0)
+                return 1;
+        }
+        else if(strcmp(argv[i], "--emit") == 0 && i + 3 < argc)
+        {
+            emitIndex = i + 1;
+            i += 3;
+        }
+        else
+        {
+            fprintf(stderr, "Error: unknown argument '%s'.\n", argv[i]);
+            return 1;
+        }
+    }
+    if(repeat <= 0)
+        repeat = 1;
+
+    if(emitIndex != 0)
+        return emitSource(argv[emitIndex], argv[emitIndex + 1], argv[emitIndex + 2], seed);
+    return runBenchmark(seed, maxLines, onlyShape, repeat);
+}
@@ -0,0 +1,43 @@
+/*
+ * Description: Runs a command line of the assembler on a running assembler server ('assembler --serve [SOCKET]'),
+ *              so small jobs don't pay for the start of the assembler. It behaves exactly like the assembler:
+ *              it takes the same arguments, and the diagnostics, the statistics and the output files are the same.
+ *
+ * Build (from the repository root, every source file except the one holding the assembler's 'main'):
+ *     gcc -ansi -pedantic -Wall -O2 -o client client/client.c $(ls src/[a-z]*.c | grep -v /assembler.c) -pthread
+ * Run:
+ *     ./client [options] file1.as file2.as ...
+ * The server is found by the socket named in the environment variable 'ASSEMBLER_SOCKET' (default: the socket of the
+ * user, '$XDG_RUNTIME_DIR/assembler.sock' or '/tmp/assembler-<uid>/assembler.sock'). Only a server of the same user
+ * is used. If no such server serves the socket, the files are assembled in this process. With '--serve' the client
+ * starts a server.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/server.h"
+#include "../include/jobs.h"
+
+
+int main(int argc, char *argv[])
+{
+    const char *socketPath = getenv("ASSEMBLER_SOCKET");
+    char *defaultPath = NULL;
+    int i, status = -1;
+
+    /* A server is started in this process, the same as the assembler starts it */
+    for (i = 1; i < argc; i++)
+        if (strcmp(argv[i], "--serve") == 0)
+            return runAssembler(argc, argv, FALSE);
+
+    /* The default socket is only trusted in a directory no other user can reach */
+    if (socketPath == NULL || socketPath[0] == '\0')
+        socketPath = defaultPath = defaultServerSocketPath();
+    if (defaultPath == NULL || checkSocketDirectory(defaultPath, FALSE) == VALID)
+        status = runOnServer(socketPath, argc, argv);
+    if (status < 0)
+        status = runAssembler(argc, argv, FALSE);
+    free(defaultPath);
+    return status;
+}
@@ -0,0 +1,70 @@
+/*
+ * Description: Writes the source code of an assembled program ('.ob' file, with its '.ent' and '.ext' files if they
+ *              exist). Assembling the source yields the same object file.
+ *
+ * Build (from the repository root, every source file except the one holding the assembler's 'main'):
+ *     gcc -ansi -pedantic -Wall -O2 -o disassembler disassembler/disassembler.c $(ls src/[a-z]*.c | grep -v /assembler.c) -pthread
+ * Run:
+ *     ./disassembler [-o output.as] program
+ * The program is named like the file it was assembled from (e.g. 'x' or 'x.ob' for 'x.ob', 'x.ent', 'x.ext').
+ * Without '-o' the source is written to stdout. The exit status is 1 if a word can't be written as source.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/disassembler.h"
+#include "../include/general.h"
+
+
+int main(int argc, char *argv[])
+{
+    int i, status;
+    const char *outputName = NULL;
+    char *baseName = NULL;
+    size_t length;
+    FILE *out = stdout;
+    disassembler dis = {0};
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            outputName = argv[++i];
+        else if (argv[i][0] == '-' || baseName != NULL)
+        {
+            fprintf(stderr, "Error: unknown option '%s'.\n", argv[i]);
+            free(baseName);
+            return 1;
+        }
+        else
+        {
+            /* The extension of the object file is dropped, the other files are found by the same name */
+            length = strlen(argv[i]);
+            baseName = (char *) callocWithCheck(length + 1);
+            strcpy(baseName, argv[i]);
+            if (length > 3 && strcmp(baseName + length - 3, ".ob") == 0)
+                baseName[length - 3] = '\0';
+        }
+    }
+    if (baseName == NULL)
+    {
+        fprintf(stderr, "Error: Missing object file.\n");
+        return 1;
+    }
+    if (outputName != NULL && (out = fopen(outputName, "w")) == NULL)
+    {
+        fprintf(stderr, "Error: failed to access file '%s' for writing.\n", outputName);
+        free(baseName);
+        return 1;
+    }
+
+    initDisassembler(&dis);
+    dis.errors = stderr;
+    status = (disassembleObjectFile(&dis, baseName, out) == VALID) ? 0 : 1;
+
+    if (out != stdout)
+        fclose(out);
+    freeDisassembler(&dis);
+    free(baseName);
+    return status;
+}
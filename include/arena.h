@@ -0,0 +1,79 @@
+#ifndef UNTITLED_ARENA_H
+#define UNTITLED_ARENA_H
+
+#include <stdio.h>
+#include "structs.h"
+
+
+/*
+   This file contains the functions of the arena - the bump allocator owned by the assembly context of each input file.
+   The small allocations made while assembling a file (symbols, attributes, label names) are carved from large blocks,
+   and are all released at once when the assembly of the file is over.
+*/
+
+
+/*
+    Function: arenaAlloc
+    Description: Allocates memory of the specified size from the given arena.
+    Parameters:
+        - memory: Pointer to the arena.
+        - size: The size of memory to be allocated.
+    Returns:
+        - A pointer to the allocated (zero initialized) memory.
+    Notes:
+        - The memory is aligned to 'arenaAlignment', and can't be released on its own - only by 'freeArena'.
+        - A new block is allocated only when the current block can't hold the requested size.
+        - Exits the program if memory allocation fails.
+*/
+void *arenaAlloc(arena *memory, unsigned long size);
+
+
+/*
+    Function: arenaCopyString
+    Description: Copies the given string into memory allocated from the given arena.
+    Parameters:
+        - memory: Pointer to the arena.
+        - string: The string to be copied.
+    Returns:
+        - A pointer to the copy of the string.
+*/
+char *arenaCopyString(arena *memory, const char *string);
+
+
+/*
+    Function: adoptArena
+    Description: Moves all the blocks of another arena into the given arena, the memory handed out by the other
+                 arena stays valid and is released along with the given arena.
+    Parameters:
+        - memory: Pointer to the arena that takes the blocks.
+        - other: Pointer to the arena whose blocks are taken, it's reset to an empty arena.
+    Returns: void
+*/
+void adoptArena(arena *memory, arena *other);
+
+
+/*
+    Function: freeArena
+    Description: Releases all the blocks of the given arena, and resets it to an empty arena.
+    Parameters:
+        - memory: Pointer to the arena.
+    Returns: void
+*/
+void freeArena(arena *memory);
+
+
+/*
+    Function: printArenaStats
+    Description: Prints the allocation counters of the given arena.
+    Parameters:
+        - memory: Pointer to the arena.
+        - fileName: The name of the input file the arena belongs to.
+        - fd: The file descriptor to print to.
+    Returns: void
+    Notes:
+        - Reports how many allocations were served, and how many calls to the system allocator were avoided.
+*/
+void printArenaStats(arena *memory, const char *fileName, FILE *fd);
+
+
+#endif
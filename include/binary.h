@@ -1,4 +1,3 @@
-
 #ifndef UNTITLED_BINARY_H
 #define UNTITLED_BINARY_H
 
@@ -7,45 +6,42 @@
 
 /*
    This  file contains functions related to the binary encoding of instructions in the assembler program.
-   It facilitates the completion of binary encoding based on the instruction type,
-   and presence of label operands in the source code.
+   It facilitates the completion of binary encoding of instructions with label operands,
+   using the fixups recorded during the first pass.
  */
 
 
 /*
-    Function: checkLineBinaryEncoding
-    Description: Checks the current line for instructions with label operands and completes the binary encoding if required.
+    Function: encodeFixup
+    Description: Completes the field of the instruction of a fixup, without recording the external reference.
     Parameters:
-        - line: Pointer to the structure representing the current line.
-        - symTable: Symbol table containing information about labels and symbols encountered.
-        - cTable: Code table containing encoded instructions.
-        - instructionToken: Pointer to the structure representing the current instruction.
-        - label: Pointer to the symbol table entry of the label found, if present.
+        - line: Pointer to the structure representing the line of the instruction.
+        - fixup: Pointer to the fixup recorded for the instruction in the first pass.
+        - context: Pointer to the assembly context (symbol table and code image of the file).
+    Returns:
+        - symbolTable: The label of the fixup, NULL if it isn't in the symbol table.
     Notes:
-        - This function checks if the current line contains instructions with label operands ('I' or 'J' types).
-        - If such instructions are found, it attempts to extract and process the associated label information.
-        - Upon successful retrieval of label information from the symbol table,
-          it initiates the completion of binary encoding.
+        - Only reads the symbol table and writes the instruction of the fixup, so fixups can be encoded concurrently.
+        - If the label is not found or the address is invalid, adds the proper error to the line object.
 */
-void checkLineBinaryEncoding(newLine *line, symbolTable symTable, codeTable cTable, instructionWord *instructionToken, symbolTable *label);
+symbolTable encodeFixup(newLine *line, fixupEntry *fixup, assemblyContext *context);
 
 
 /*
-    Function: checkLineBinaryEncoding
-    Description: Manages the completion of binary encoding based on the instruction type and presence of label operands in the source code.
+    Function: resolveFixup
+    Description: Completes the binary encoding of an instruction with a label operand.
     Parameters:
-        - line: Pointer to the structure representing the current line.
-        - symTable: Symbol table containing information about labels and symbols encountered.
-        - cTable: Code table containing encoded instructions.
-        - instructionToken: Pointer to the structure representing the current instruction.
-        - label: Pointer to the symbol table entry of the label found, if present.
+        - line: Pointer to the structure representing the line of the instruction.
+        - fixup: Pointer to the fixup recorded for the instruction in the first pass.
+        - context: Pointer to the assembly context (symbol table, code image and attributes table of the file).
     Notes:
-        - This function scans the current line to identify instructions with label operands ('I' or 'J' types).
-        - Upon encountering such instructions, it attempts to retrieve associated label information from the symbol table.
-        - If the label is found in the symbol table,
-          indicating its validity, this function manages the completion of binary encoding for the line.
+        - The instruction is accessed directly by the code image index saved in the fixup, and encoded by 'encodeFixup'.
+        - Retrieves the label from the symbol table and completes the 'immed' field of 'I' instructions,
+          or the 'address' field of 'J' instructions.
+        - If the label is external, adds the address of the instruction to the attributes table.
+        - If the label is not found or the address is invalid, adds the proper error to the line object.
 */
-void completeLineBinaryEncoding(symbolTable label, codeTable table, instructionWord *instructionToken, newLine *line);
+void resolveFixup(newLine *line, fixupEntry *fixup, assemblyContext *context);
 
 
-#endif
\ No newline at end of file
+#endif
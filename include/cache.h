@@ -0,0 +1,185 @@
+#ifndef UNTITLED_CACHE_H
+#define UNTITLED_CACHE_H
+
+#include <stdio.h>
+#include "structs.h"
+
+
+/*
+   This file contains the functions of the assembly cache ('--cache-dir DIR'), which restores the output files
+   of an unchanged source without assembling it.
+   Every entry of the cache is a single file in the cache directory, named by the key of the source - a hash of the
+   source, the version of the assembler and the options that affect the outputs. The entry holds the content of the
+   '.ob', '.ext' and '.ent' files of the source (the ones it has).
+   Only valid sources assembled without any diagnostics are cached, so a hit prints nothing.
+   The least recently used entries are evicted once the cache grows beyond its size limit ('--cache-size N').
+*/
+
+
+/*
+    Function: hashBytes
+    Description: Adds bytes to a 64-bit hash, kept as two independent 32-bit lanes.
+    Parameters:
+        - lanes: The two lanes of the hash (FNV-1a and Jenkins' one-at-a-time), updated in place.
+        - bytes: The bytes to be hashed.
+        - size: The number of bytes.
+    Returns:
+        - void
+*/
+void hashBytes(unsigned long lanes[2], const char *bytes, unsigned long size);
+
+
+/*
+    Function: cacheKey
+    Description: Computes the key of a source in the assembly cache.
+    Parameters:
+        - source: Pointer to the source buffer, already read from the input file.
+        - options: Pointer to the options of the assembler.
+        - key: Buffer (of at least cacheKeyLength + 1 characters) to store the key, as hexadecimal digits.
+    Returns:
+        - void
+    Notes:
+        - The key covers the source, 'assemblerVersion' and the maximum line length,
+          the rest of the options don't affect the outputs.
+*/
+void cacheKey(const sourceBuffer *source, const assemblerOptions *options, char *key);
+
+
+/*
+    Function: cacheEntryPath
+    Description: Builds the path of a file in the cache directory.
+    Parameters:
+        - directory: The cache directory.
+        - name: The name of the file (the key of an entry).
+    Returns:
+        - char*: The path, the caller is responsible for freeing it.
+*/
+char *cacheEntryPath(const char *directory, const char *name);
+
+
+/*
+    Function: openCacheDirectory
+    Description: Creates the cache directory, unless it already exists.
+    Parameters:
+        - options: Pointer to the options of the assembler.
+    Returns:
+        - state: VALID if the cache directory can be used, INVALID otherwise (the error is printed).
+*/
+state openCacheDirectory(const assemblerOptions *options);
+
+
+/*
+    Function: copyCachedOutput
+    Description: Copies an output file out of a cache entry.
+    Parameters:
+        - entry: The cache entry, positioned at the start of the output.
+        - size: The number of bytes of the output.
+        - fileName: Name of the input file.
+        - extension: The extension of the output file ('.ob', '.ext' or '.ent').
+        - errors: The stream the diagnostics of the file are printed to.
+    Returns:
+        - state: INVALID if the entry is cut short, VALID otherwise.
+    Notes:
+        - If the output file can't be created, the error is printed and the output is skipped.
+*/
+state copyCachedOutput(FILE *entry, long size, const char *fileName, char *extension, FILE *errors);
+
+
+/*
+    Function: restoreFromCache
+    Description: Restores the output files of a source from its cache entry, if there's one.
+    Parameters:
+        - fileName: Name of the input file (the output files are named after it).
+        - key: The key of the source.
+        - context: Pointer to the assembly context, whose source buffer is already filled.
+    Returns:
+        - state: VALID on a hit (the output files are restored), INVALID on a miss.
+    Notes:
+        - An entry that doesn't match the source (its version or its source size) or that is cut short is a miss.
+        - The entry is marked as recently used, by updating its modification time.
+        - The output files are copied from the entry (not linked), so writing them later never modifies the cache.
+        - On a hit, the counts of the assembly the entry came from (its symbols, code words, data bytes, fixups and
+          attributes) are copied into the statistics of the context, if it has any.
+*/
+state restoreFromCache(const char *fileName, const char *key, assemblyContext *context);
+
+
+/*
+    Function: storeInCache
+    Description: Stores the outputs of a valid source in its cache entry.
+    Parameters:
+        - key: The key of the source.
+        - context: Pointer to the assembly context of the valid source.
+    Returns:
+        - void
+    Notes:
+        - The entry starts with a header line: the version, the source size, the sizes of the outputs and the counts of
+          the assembly ('countAssembly'), followed by the outputs themselves.
+        - The entry is written to a temporary file that's renamed at once, so concurrent assemblers never see a partial entry.
+        - The cache is best effort - if the entry can't be written, the source is simply not cached.
+*/
+void storeInCache(const char *key, assemblyContext *context);
+
+
+/*
+    Function: countCacheOutcome
+    Description: Counts the outcome of a file in the statistics of the cache.
+    Parameters:
+        - statistics: Pointer to the statistics of the cache.
+        - outcome: How the outputs of the file were obtained.
+    Returns:
+        - void
+*/
+void countCacheOutcome(cacheStatistics *statistics, cacheOutcome outcome);
+
+
+/*
+    Function: isCacheEntryName
+    Description: Checks if a file in the cache directory is a cache entry (its name is a key).
+    Parameters:
+        - name: The name of the file.
+    Returns:
+        - bool: TRUE if it's an entry, FALSE otherwise (e.g. an entry that's still being written).
+*/
+bool isCacheEntryName(const char *name);
+
+
+/*
+    Function: compareCacheEntries
+    Description: Orders cache entries from the least recently used to the most recently used (for 'qsort').
+    Parameters:
+        - first: Pointer to the first entry (cacheEntryInfo).
+        - second: Pointer to the second entry (cacheEntryInfo).
+    Returns:
+        - int: Negative, zero or positive, as 'qsort' requires.
+*/
+int compareCacheEntries(const void *first, const void *second);
+
+
+/*
+    Function: trimCache
+    Description: Evicts the least recently used entries, until the cache is within its size limit.
+    Parameters:
+        - options: Pointer to the options of the assembler.
+        - statistics: Pointer to the statistics of the cache (evictions, entries and size are updated).
+    Returns:
+        - void
+    Notes:
+        - Called once all the files are done, so the cache is scanned once per run.
+*/
+void trimCache(const assemblerOptions *options, cacheStatistics *statistics);
+
+
+/*
+    Function: printCacheStatistics
+    Description: Prints the hits, misses and evictions of the cache, and the size it's left with.
+    Parameters:
+        - statistics: Pointer to the statistics of the cache.
+        - fd: The stream the statistics are printed to.
+    Returns:
+        - void
+*/
+void printCacheStatistics(const cacheStatistics *statistics, FILE *fd);
+
+
+#endif
@@ -0,0 +1,137 @@
+#ifndef UNTITLED_CHUNKEDFIRSTPASS_H
+#define UNTITLED_CHUNKEDFIRSTPASS_H
+
+#include <pthread.h>
+#include "structs.h"
+
+
+/*
+   This file contains the functions of the parallel first pass ('--first-pass-threads N'), for very large sources.
+   The source is split at line boundaries into chunks, and each chunk is parsed and validated on a thread of its own,
+   into a context of its own - its code starts at 'ICInitialValue' and its data at 0, like a file of its own.
+   Once all the chunks are done, their sizes are summed (a prefix sum gives the base addresses of every chunk),
+   and their tables are merged into the context of the file, by the order of the chunks.
+   A label defined in more than one chunk (or defined in one and declared '.extern' in another) is reported
+   by a serial first pass only, so when the chunks' labels clash the file is parsed again serially -
+   the diagnostics are always those of a serial run.
+*/
+
+
+/*
+   Struct: firstPassChunk
+   Description: Represents a chunk of the source, parsed by the first pass on a thread of its own.
+   Fields:
+     - context: The context the chunk is parsed into, its source is a view into the source of the file.
+     - line: The line structure of the chunk's first pass.
+     - firstLineNumber: The number of the first line of the chunk in the input file.
+     - numOfLines: The number of lines in the chunk.
+     - IC: The Instruction Counter of the chunk (starting at 'ICInitialValue').
+     - result: The validation state of the chunk after the first pass.
+     - diagnostics: The diagnostics printed while parsing the chunk (not terminated by '\0').
+     - diagnosticsSize: The number of characters in 'diagnostics'.
+     - thread: The thread the chunk is parsed on.
+     - threadStarted: Whether the chunk is parsed on its own thread (FALSE if the thread couldn't be created).
+*/
+typedef struct firstPassChunk
+{
+    assemblyContext context;
+    newLine line;
+    long firstLineNumber;
+    long numOfLines;
+    long IC;
+    state result;
+    char *diagnostics;
+    size_t diagnosticsSize;
+    pthread_t thread;
+    bool threadStarted;
+} firstPassChunk;
+
+
+/*
+    Function: splitSource
+    Description: Splits the source of a file into chunks of about the same size, at line boundaries.
+    Parameters:
+        - source: Pointer to the source of the file.
+        - chunks: Array of the chunks, their sources are set to views into the source and their lines are numbered.
+        - numOfChunks: The number of chunks.
+    Returns:
+        - void
+    Notes:
+        - A chunk may be empty, if a single line is longer than the chunks around it.
+*/
+void splitSource(const sourceBuffer *source, firstPassChunk *chunks, int numOfChunks);
+
+
+/*
+    Function: firstPassChunkWorker
+    Description: Runs the first pass on a chunk, collecting its diagnostics in a buffer.
+    Parameters:
+        - chunk: Pointer to the chunk (firstPassChunk *).
+    Returns:
+        - NULL.
+*/
+void *firstPassChunkWorker(void *chunk);
+
+
+/*
+    Function: mergeChunkSymbols
+    Description: Moves the labels of the chunks into the symbol table of the file, at their addresses in the file.
+    Parameters:
+        - context: Pointer to the context of the file, its symbol table is empty.
+        - chunks: Array of the parsed chunks.
+        - numOfChunks: The number of chunks.
+    Returns:
+        - bool: TRUE if the labels were merged, FALSE if a label of one chunk clashes with a label of an earlier chunk.
+    Notes:
+        - The labels keep the order a serial first pass adds them in, an '.extern' label of several chunks is added once.
+        - On a clash the symbol table of the file is left empty.
+*/
+bool mergeChunkSymbols(assemblyContext *context, firstPassChunk *chunks, int numOfChunks);
+
+
+/*
+    Function: mergeChunkTables
+    Description: Appends the code image, the data image, the fixups and the '.entry' directives of the chunks to
+                 the tables of the file, and prints the diagnostics of the chunks.
+    Parameters:
+        - context: Pointer to the context of the file, its symbol table already merged.
+        - chunks: Array of the parsed chunks.
+        - numOfChunks: The number of chunks.
+        - IC: Pointer to the Instruction Counter of the file, set to the end of the merged code image.
+    Returns:
+        - void
+    Notes:
+        - The arenas of the chunks are adopted by the arena of the file, so the labels' names stay valid.
+*/
+void mergeChunkTables(assemblyContext *context, firstPassChunk *chunks, int numOfChunks, long *IC);
+
+
+/*
+    Function: freeChunks
+    Description: Releases the contexts and the diagnostics of the chunks (but not the source they view).
+    Parameters:
+        - chunks: Array of the chunks.
+        - numOfChunks: The number of chunks.
+    Returns:
+        - void
+*/
+void freeChunks(firstPassChunk *chunks, int numOfChunks);
+
+
+/*
+    Function: chunkedFirstPass
+    Description: Executes the first pass on the entire input file, split between the threads of '--first-pass-threads'.
+    Parameters:
+        - line: Pointer to the structure representing a line of code, its number is set past the last line.
+        - IC: Pointer to the Instruction Counter.
+        - context: Pointer to the assembly context of the file.
+    Returns:
+        - Returns the validation state of the input file after the first pass. state variable: VALID / INVALID.
+    Notes:
+        - A source smaller than two chunks of 'firstPassChunkSize' bytes (see 'assemblerOptions') is parsed by 'firstPass' directly.
+        - The tables and the diagnostics are the same as those of 'firstPass'.
+*/
+state chunkedFirstPass(newLine *line, long *IC, assemblyContext *context);
+
+
+#endif
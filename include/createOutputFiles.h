@@ -10,18 +10,56 @@
 
 /*
     Function: createOutputFiles
-    Description: Creates output files based on provided data and frees the memory that was allocated for this data.
+    Description: Creates output files based on the tables of the given assembly context.
     Parameters:
         - fileName: Name of the file.
-        - codeImage: Table containing code image data.
-        - dataImage: Table containing data image data.
-        - attributesTab: Table containing attributes data.
+        - context: Pointer to the assembly context of the file (code image, data image, attributes table, ICF and DCF).
+    Returns:
+        - void
+    Notes:
+        - The context isn't released here, it's released by the caller along with its arena.
+*/
+void createOutputFiles(const char *fileName, assemblyContext *context);
+
+
+/*
+    Function: createOutputFilesWithPrefix
+    Description: Creates the output files of the given assembly context, when the lines of the object file for its
+                 first instructions were already formatted (by the writer stage of the pipeline, see pipeline.h).
+    Parameters:
+        - fileName: Name of the file.
+        - context: Pointer to the assembly context of the file.
+        - codeText: The formatted lines of the first instructions (not terminated by '\0'), NULL if there are none.
+        - codeTextSize: The number of characters in 'codeText'.
+        - formattedEntries: The number of instructions formatted in 'codeText'.
+    Returns:
+        - void
+*/
+void createOutputFilesWithPrefix(const char *fileName, assemblyContext *context, const char *codeText,
+                                 unsigned long codeTextSize, unsigned long formattedEntries);
+
+
+/*
+    Function: createObjectFileWithPrefix
+    Description: Creates an object file, when the lines of its first instructions were already formatted.
+    Parameters:
+        - fileName: Name of the file to be created.
+        - codeText: The formatted lines of the first instructions, NULL if there are none.
+        - codeTextSize: The number of characters in 'codeText'.
+        - formattedEntries: The number of instructions formatted in 'codeText'.
+        - codeImage: Pointer to the table containing code image data.
+        - dataImage: Pointer to the table containing data image data.
         - ICF: Instruction Counter Final value.
         - DCF: Data Counter Final value.
+        - errors: The stream the diagnostics of the current file are printed to.
     Returns:
         - void
+    Notes:
+        - The content of the file is written by 'writeObjectFileWithPrefix'.
 */
-void createOutputFiles(char *fileName, codeTable codeImage, dataTable dataImage, attributesTable attributesTab, long ICF, long DCF);
+void createObjectFileWithPrefix(const char *fileName, const char *codeText, unsigned long codeTextSize,
+                                unsigned long formattedEntries, codeImageTable *codeImage, dataImageTable *dataImage,
+                                long ICF, long DCF, FILE *errors);
 
 
 /*
@@ -29,10 +67,11 @@ void createOutputFiles(char *fileName, codeTable codeImage, dataTable dataImage,
     Description: Creates an object file based on code and data images and their sizes, using the provided file name.
     Parameters:
         - fileName: Name of the file to be created.
-        - codeImage: Table containing code image data.
-        - dataImage: Table containing data image data.
+        - codeImage: Pointer to the table containing code image data.
+        - dataImage: Pointer to the table containing data image data.
         - ICF: Instruction Counter Final value.
         - DCF: Data Counter Final value.
+        - errors: The stream the diagnostics of the current file are printed to.
     Returns:
         - void
     File Structure:
@@ -44,132 +83,127 @@ void createOutputFiles(char *fileName, codeTable codeImage, dataTable dataImage,
         - The final row may contain fewer than 4 bytes.
         - The code image is displayed first in the file.
         - The file name is generated using the input file name (without the extension) and appending the '.ob' extension.
-*/
-void createObjectFile(char *fileName, codeTable codeImage, dataTable dataImage, long ICF, long DCF);
-
-
-/*
-    Function: createExtAndEntFiles
-    Description: Creates external and entry files based on the attributes table and the provided file name.
-    Parameters:
-        - fileName: Name of the file to be created.
-        - attributesTab: Table containing attributes data.
-    Returns:
-        - void
-*/
-void createExtAndEntFiles(char *fileName, attributesTable attributesTab);
-
-
-/*
-    Function: exportToExtAndEntFiles
-    Description: Exports symbols defined as external and internal to the corresponding external and entry files.
-    Parameters:
-        - attributesTab: Table containing attributes data.
-        - externFileDescriptor: Pointer to the external file descriptor.
-        - entryFileDescriptor: Pointer to the entry file descriptor.
-    Returns:
-        - void
     Notes:
-        - Exports the symbols along with their corresponding addresses.
-        - Each line in the file consists of a single label and its associated address, presented as 4-digit decimal number.
-        - The filename for each file consists of the input filename (without the extension),
-          followed by either the 'ext' extension (for externals file) or the 'ent' extension (for entries file).
+        - The content of the file is written by 'writeObjectFile'.
 */
-void exportToExtAndEntFiles(attributesTable attributesTab, FILE *externFileDescriptor, FILE  *entryFileDescriptor);
+void createObjectFile(const char *fileName, codeImageTable *codeImage, dataImageTable *dataImage, long ICF, long DCF, FILE *errors);
 
 
 /*
-    Function: exportCodeImage
-    Description: Exports the code image into object file in a specific format based on the dataType of instruction.
+    Function: writeObjectFile
+    Description: Writes the content of an object file (see 'createObjectFile') to an open stream.
     Parameters:
-        - codeImage: Table containing code image data.
-        - fd: File descriptor for the output file.
+        - fileDescriptor: The stream the object file is written to (a file, or a memory stream).
+        - codeImage: Pointer to the table containing code image data.
+        - dataImage: Pointer to the table containing data image data.
+        - ICF: Instruction Counter Final value.
+        - DCF: Data Counter Final value.
     Returns:
         - void
+    Notes:
+        - The file is formatted through an output writer (outputWriter.h) and written in large blocks.
 */
-void exportCodeImage(codeTable codeImage, FILE *fd);
+void writeObjectFile(FILE *fileDescriptor, codeImageTable *codeImage, dataImageTable *dataImage, long ICF, long DCF);
 
 
 /*
-    Function: exportDataImage
-    Description: Exports the data image to the specified file descriptor, starting from a specified address.
+    Function: writeObjectFileWithPrefix
+    Description: Writes the content of an object file to an open stream, when the lines of its first instructions
+                 were already formatted (by the writer stage of the pipeline, see pipeline.h).
     Parameters:
-        - dataImage: Table containing data image data.
-        - fileDescriptor: File descriptor for the output file.
-        - startingAddress: Starting address for the data export.
+        - fileDescriptor: The stream the object file is written to.
+        - codeText: The formatted lines of the first instructions (not terminated by '\0'), NULL if there are none.
+        - codeTextSize: The number of characters in 'codeText'.
+        - formattedEntries: The number of instructions formatted in 'codeText'.
+        - codeImage: Pointer to the table containing code image data.
+        - dataImage: Pointer to the table containing data image data.
+        - ICF: Instruction Counter Final value.
+        - DCF: Data Counter Final value.
     Returns:
         - void
+    Notes:
+        - The formatted lines must be those 'exportCodeEntries' writes for the first instructions of the code image.
 */
-void exportDataImage(dataTable dataImage, FILE *fileDescriptor, long startingAddress);
+void writeObjectFileWithPrefix(FILE *fileDescriptor, const char *codeText, unsigned long codeTextSize,
+                               unsigned long formattedEntries, codeImageTable *codeImage, dataImageTable *dataImage,
+                               long ICF, long DCF);
 
 
 /*
-    Function: exportDataVariable
-    Description: Exports a single variable from the data entry to the specified file descriptor.
+    Function: createExtAndEntFiles
+    Description: Creates external and entry files based on the attributes table and the provided file name.
     Parameters:
-        - currentEntry: Current data entry containing variables.
-        - currentAddress: Pointer to the current memory address.
-        - currentIndex: Index of the current variable.
-        - fileDescriptor: File descriptor for the output file.
-        - totalPrintedBytes: Pointer to the total number of bytes printed.
+        - fileName: Name of the file to be created.
+        - attributesTab: Table containing attributes data.
+        - errors: The stream the diagnostics of the current file are printed to.
     Returns:
         - void
 */
-void exportDataVariable(dataTable currentEntry, long *currentAddress, int currentIndex, FILE *fileDescriptor, long *totalPrintedBytes);
+void createExtAndEntFiles(const char *fileName, attributesTable attributesTab, FILE *errors);
 
 
 /*
-    Function: exportDataEntry
-    Description: Exports the data of a single data image entry to the specified file descriptor.
+    Function: exportToExtAndEntFiles
+    Description: Exports symbols defined as external and internal to the corresponding external and entry files.
     Parameters:
-        - currentEntry: Current data entry to be exported.
-        - currentAddress: Pointer to the current memory address.
-        - totalPrintedBytes: Pointer to the total number of bytes printed.
-        - fileDescriptor: File descriptor for the output file.
+        - attributesTab: Table containing attributes data.
+        - externFileDescriptor: Pointer to the external file descriptor.
+        - entryFileDescriptor: Pointer to the entry file descriptor.
     Returns:
         - void
+    Notes:
+        - Exports the symbols along with their corresponding addresses.
+        - A NULL descriptor skips the symbols of its type.
+        - Each line in the file consists of a single label and its associated address, presented as 4-digit decimal number.
+        - The filename for each file consists of the input filename (without the extension),
+          followed by either the 'ext' extension (for externals file) or the 'ent' extension (for entries file).
 */
-void exportDataEntry(dataTable currentEntry, long *currentAddress, long *totalPrintedBytes, FILE *fileDescriptor);
+void exportToExtAndEntFiles(attributesTable attributesTab, FILE *externFileDescriptor, FILE  *entryFileDescriptor);
 
 
 /*
-    Function: exportDataByteByType
-    Description: Exports a single byte of data based on the type of data entry to the specified file descriptor.
+    Function: exportCodeEntries
+    Description: Exports a range of instructions into object file, a line for each instruction.
     Parameters:
-        - currentEntry: Current data entry.
-        - printedVariableBytes: Number of bytes printed for the current variable.
-        - currentIndex: Index of the current variable.
-        - fileDescriptor: File descriptor for the output file.
+        - entries: Pointer to the first instruction.
+        - count: The number of instructions.
+        - writer: Pointer to the output writer of the object file.
     Returns:
         - void
+    Notes:
+        - Each line holds the address of the instruction (4 decimal digits) and its 4 bytes, in little-endian order.
 */
-void exportDataByteByType(dataTable currentEntry, int printedVariableBytes, int currentIndex, FILE *fileDescriptor);
+void exportCodeEntries(const codeImageEntry *entries, unsigned long count, outputWriter *writer);
 
 
 /*
-    Function: exportDWByte
-    Description: Exports bytes of '.dw' directive variables to the specified file descriptor.
+    Function: exportCodeImage
+    Description: Exports the code image into object file in a specific format based on the dataType of instruction.
     Parameters:
-        - currentVariable: Pointer to the current variable.
-        - printedVariableBytes: Number of bytes printed for the current variable.
-        - fileDescriptor: File descriptor for the output file.
+        - codeImage: Pointer to the table containing code image data.
+        - writer: Pointer to the output writer of the object file.
     Returns:
         - void
+    Notes:
+        - The lines are written by 'exportCodeEntries'.
 */
-void exportDWByte(void* currentVariable, int printedVariableBytes, FILE* fileDescriptor);
+void exportCodeImage(codeImageTable *codeImage, outputWriter *writer);
 
 
 /*
-    Function: exportDHByte
-    Description: Exports bytes of '.dh' directive variables to the specified file descriptor, based on the number of bytes already printed.
+    Function: exportDataImage
+    Description: Exports the data image to the specified file descriptor, starting from a specified address.
     Parameters:
-        - currentVariable: Pointer to the current variable.
-        - printedVariableBytes: Number of bytes already printed for the current variable.
-        - fileDescriptor: File descriptor for the output file.
+        - dataImage: Pointer to the table containing data image data.
+        - writer: Pointer to the output writer of the object file.
+        - startingAddress: Starting address for the data export.
     Returns:
         - void
+    Notes:
+        - The data image is already encoded in little-endian order, so it's exported byte by byte,
+          4 bytes in each line.
 */
-void exportDHByte(void* currentVariable, int printedVariableBytes, FILE* fileDescriptor);
+void exportDataImage(dataImageTable *dataImage, outputWriter *writer, long startingAddress);
 
 
 #endif
\ No newline at end of file
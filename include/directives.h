@@ -16,12 +16,13 @@
     Description: Scans the current directive word from the input line.
     Parameters:
         - lineContent: The content of the input line.
-        - directiveName: The buffer to store the directive name.
+        - directiveName: The buffer to store the directive name (of size maxDirectiveName).
         - contentIndex: The index in the content where the directive starts.
     Returns:
         - void
     Notes:
         - Updates the contentIndex to the position after the scanned directive.
+        - A name longer than the buffer is cut, the cut name is still longer than any directive name.
 */
 void scanDirectiveName(const char *lineContent, char *directiveName, int *contentIndex);
 
@@ -47,6 +48,8 @@ bool isDirective(const char *lineContent, directiveWord *directiveToken, int *co
         - directiveToken: Pointer to the directiveWord structure to store the matched directive details.
     Returns:
         - state: The state of the search operation (VALID or INVALID).
+    Notes:
+        - The directive is found in the perfect hash table of the reserved words, with a single compare.
 */
 state searchDirective(newLine *line, directiveWord  *directiveToken);
 
@@ -63,59 +66,52 @@ bool isDataStorageDirective(directiveType type);
 
 
 /*
-    Function: enterVariableByType
-    Description: Inserts the current variable into the data array based on the directive type.
-    Parameters:
-        - type: The directiveType specifying the type of directive.
-        - dataArray: Pointer to the data array.
-        - arrayIndex: Pointer to the index in the array where the variable will be inserted.
-        - numString: String containing the variable value to be inserted.
-    Returns:
-        - void
-*/
-void enterVariableByType(directiveType type, void * dataArray, int *arrayIndex, char *numString);
-
-
-/*
-    Function: scanDVariableToArray
-    Description: Scans a variable from the input line and enters it into the data array (for '.db'/'dh'/'dw' directives).
+    Function: scanDVariablesToImage
+    Description: Scans the variables from the input line and appends them to the data image (for '.db'/'dh'/'dw' directives).
     Parameters:
         - content: Pointer to the content of the input line.
-        - index: Index in the content indicating the position of the variable.
+        - index: Index in the content indicating the position of the first variable.
         - type: The directiveType specifying the type of directive.
-        - dataArray: Pointer to the data array.
+        - dataImage: Pointer to the data image table.
     Returns:
         - void
+    Notes:
+        - Each variable is appended in little-endian order, using the size defined by the directive type.
 */
-void scanDVariableToArray(const char *content, int index, directiveType type, void *dataArray);
+void scanDVariablesToImage(const char *content, int index, directiveType type, dataImageTable *dataImage);
 
 
 /*
-    Function: scanAscizVariableToArray
-    Description: Scans a variable from the input line and enters it into the data array for '.asciz' directive.
+    Function: scanAscizVariableToImage
+    Description: Scans the string from the input line and appends it to the data image (for '.asciz' directive).
     Parameters:
         - content: Pointer to the content of the input line.
-        - index: Index in the content indicating the position of the variable.
-        - dataArray: Pointer to the data array.
+        - index: Index in the content indicating the position of the string.
+        - dataImage: Pointer to the data image table.
     Returns:
         - void
+    Notes:
+        - Appends the string characters followed by '\0'.
 */
-void scanAscizVariableToArray(const char *content, int index, char *dataArray);
+void scanAscizVariableToImage(const char *content, int index, dataImageTable *dataImage);
 
 
 /*
-    Function: createDataArray
-    Description: Creates an array of data based on the directive type and input variables.
+    Function: addToDataImage
+    Description: Appends the variables of a valid data storage directive line to the data image.
     Parameters:
         - type: The directiveType specifying the type of directive.
-        - dataArray: Pointer to the pointer of the data array.
-        - numOfVariables: Number of variables to be processed.
+        - numOfVariables: Number of variables that appear in the line.
         - content: Pointer to the content of the input line.
-        - index: Index in the content indicating the position of the variable.
+        - index: Index in the content indicating the position of the first variable.
+        - dataImage: Pointer to the data image table.
     Returns:
         - void
+    Notes:
+        - Reserves room for all the variables of the line before scanning them.
+        - The Data Counter is the size of the data image, so it advances as the variables are appended.
 */
-void createDataArray(directiveType type, void **dataArray, int numOfVariables, const char *content, int index);
+void addToDataImage(directiveType type, int numOfVariables, const char *content, int index, dataImageTable *dataImage);
 
 
 /*
@@ -181,14 +177,12 @@ void checkDirectiveByType(newLine *line, directiveType type, int index, int *num
         - type: The directiveType specifying the type of directive.
         - index: Index in the content of the input line.
         - numOfVariables: Pointer to the number of variables.
-        - dataArray: Pointer to the pointer of the data array.
     Returns:
         - state: State of the data storage directive processing.
     Notes:
-        - If the directive is valid, Produces an array using 'createDataArray' function.
         - If the data storage directive invalid, stores proper error in 'line'.
 */
-state dataStorageDirective(newLine *line, directiveType type, int index, int *numOfVariables, void **dataArray);
+state dataStorageDirective(newLine *line, directiveType type, int index, int *numOfVariables);
 
 
 /*
@@ -200,13 +194,13 @@ state dataStorageDirective(newLine *line, directiveType type, int index, int *nu
         - type: The directiveType specifying the type of directive.
         - labelSet: Boolean indicating whether a label is set.
         - index: Index in the content of the input line.
-        - symTable: Pointer to the symbol table.
-        - dataImage: Pointer to the data image table.
-        - DC: Pointer to the Data Counter.
+        - context: Pointer to the assembly context of the current file.
     Returns:
         - void
+    Notes:
+        - A label defined in the line receives the current size of the data image (the Data Counter).
 */
-void processDataStorageDirective(char *label, newLine *line, directiveType type, bool labelSet, int index, symbolTable *symTable, dataTable *dataImage, long *DC);
+void processDataStorageDirective(char *label, newLine *line, directiveType type, bool labelSet, int index, assemblyContext *context);
 
 
 /*
@@ -217,16 +211,15 @@ void processDataStorageDirective(char *label, newLine *line, directiveType type,
         - labelSet: Boolean indicating whether a label is set.
         - line: Pointer to the newLine structure representing the input line.
         - index: Pointer to the index in the content of the input line.
-        - DC: Pointer to the Data Counter.
-        - symTab: Pointer to the symbol table.
-        - dImage: Pointer to the data image table.
+        - context: Pointer to the assembly context of the current file.
         - label: Pointer to the label associated with the directive.
     Returns:
         - void
     Notes:
-        - Does not process '.entry' directive.
+        - The operand of '.entry' directive is only recorded (in the deferred entries of the context),
+          it's marked as entry once the symbol table is complete.
 */
-void processDirective(directiveWord *directToken, bool labelSet, newLine *line, int *index, long *DC, symbolTable *symTab, dataTable *dImage, char *label);
+void processDirective(directiveWord *directToken, bool labelSet, newLine *line, int *index, assemblyContext *context, char *label);
 
 
 /*
@@ -239,6 +232,8 @@ void processDirective(directiveWord *directToken, bool labelSet, newLine *line,
     Notes:
         - Stores the current number of directives in 'numberOfDirectives' variable.
         - Each directive in the table contains information about its name, opcode, funct and dataType.
+        - The perfect hash table in 'reservedWords.c' refers to the directives by their index in this array,
+          so its order must be kept.
 */
 directiveWord *getReservedDirectives(int *numberOfDirectives);
 
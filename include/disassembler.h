@@ -0,0 +1,268 @@
+#ifndef UNTITLED_DISASSEMBLER_H
+#define UNTITLED_DISASSEMBLER_H
+
+#include <stdio.h>
+#include "structs.h"
+
+
+/*
+   This file contains the functions of the disassembler, which turns an object file back into source code that
+   assembles to the same object file.
+   Every word is decoded through a table of the 64 opcodes (and a table of the functs of opcodes 0 and 1), built from
+   'getReservedInstructions'. The labels are named after the '.ent' file where it names them, the external references
+   after the '.ext' file, and any other address an instruction refers to gets a made up label ("L" and the address).
+   The object file is read twice, line by line - once for the addresses the instructions refer to, and once to write
+   the source - so only the labels are kept in memory, whatever the size of the image.
+*/
+
+
+/*
+    Function: initDisassembler
+    Description: Prepares the decoding tables of the disassembler.
+    Parameters:
+        - dis: Pointer to a zero initialized disassembler.
+    Returns:
+        - void
+*/
+void initDisassembler(disassembler *dis);
+
+
+/*
+    Function: decodeInstructionWord
+    Description: Finds the instruction of an encoded word.
+    Parameters:
+        - dis: Pointer to the disassembler.
+        - data: Pointer to the encoded word.
+    Returns:
+        - const instructionWord*: The instruction, NULL if the opcode/funct of the word isn't defined.
+*/
+const instructionWord *decodeInstructionWord(const disassembler *dis, const codeType *data);
+
+
+/*
+    Function: parseObjectWordLine
+    Description: Parses a line of the object file - the address, and up to 4 bytes in hexadecimal.
+    Parameters:
+        - line: Pointer to the line (an error is set in it if it's invalid).
+        - address: Pointer to store the address of the line.
+        - bytes: Array to store the bytes of the line (4 bytes).
+        - numOfBytes: Pointer to store the number of bytes in the line.
+    Returns:
+        - state: The state of the line. VALID / INVALID.
+    Notes:
+        - The digits are decoded through a 256-entry table, a byte costs two lookups.
+*/
+state parseObjectWordLine(newLine *line, long *address, unsigned char *bytes, int *numOfBytes);
+
+
+/*
+    Function: loadEntryLabels
+    Description: Reads the labels of the '.ent' file and writes a '.entry' directive for each of them.
+    Parameters:
+        - dis: Pointer to the disassembler.
+        - fileName: The name of the '.ent' file.
+    Returns:
+        - state: VALID if the file is valid or doesn't exist, INVALID otherwise (an error is printed).
+    Notes:
+        - The directives are written by the order of the file, so the source yields the same '.ent' file.
+        - The labels are sorted by address for the lookups of the disassembly.
+*/
+state loadEntryLabels(disassembler *dis, const char *fileName);
+
+
+/*
+    Function: writeExternDirectives
+    Description: Reads the '.ext' file and writes a '.extern' directive for each label it names.
+    Parameters:
+        - dis: Pointer to the disassembler.
+        - fileName: The name of the '.ext' file.
+    Returns:
+        - state: VALID if the file is valid or doesn't exist, INVALID otherwise (an error is printed).
+    Notes:
+        - A label is written once for every run of lines that name it (repeating '.extern' is allowed).
+        - The file is left open, it's read again along with the code (see 'nextExternalReference').
+*/
+state writeExternDirectives(disassembler *dis, const char *fileName);
+
+
+/*
+    Function: nextExternalReference
+    Description: Reads the next line of the '.ext' file into 'external' of the disassembler.
+    Parameters:
+        - dis: Pointer to the disassembler.
+    Returns:
+        - state: VALID if the line is valid or the file is over ('address' is -1), INVALID otherwise.
+*/
+state nextExternalReference(disassembler *dis);
+
+
+/*
+    Function: collectTargets
+    Description: Reads the code of the object file and collects the addresses its instructions refer to.
+    Parameters:
+        - dis: Pointer to the disassembler.
+        - stream: Pointer to the object file, right after its header.
+    Returns:
+        - state: VALID if the object file is valid, INVALID otherwise (an error is printed).
+    Notes:
+        - The addresses are sorted and repeats are removed, so they're looked up by binary search.
+*/
+state collectTargets(disassembler *dis, lineStream *stream);
+
+
+/*
+    Function: noteLabelName
+    Description: Makes sure the made up labels don't clash with a label of the program.
+    Parameters:
+        - dis: Pointer to the disassembler.
+        - name: A label of the '.ent' or the '.ext' file.
+    Returns:
+        - void
+    Notes:
+        - The made up labels are 'syntheticLabelCharacter' repeated, followed by the address. If the given label is
+          made of the character repeated as many times or more, followed by digits, the made up labels get longer.
+*/
+void noteLabelName(disassembler *dis, const char *name);
+
+
+/*
+    Function: compareSymbolAddresses
+    Description: Orders two labels by their address, then by their name (for 'qsort').
+    Parameters:
+        - first: Pointer to the first label (disassemblySymbol).
+        - second: Pointer to the second label (disassemblySymbol).
+    Returns:
+        - int: Negative, zero or positive, like 'strcmp'.
+*/
+int compareSymbolAddresses(const void *first, const void *second);
+
+
+/*
+    Function: compareAddresses
+    Description: Orders two addresses (for 'qsort').
+    Parameters:
+        - first: Pointer to the first address (long).
+        - second: Pointer to the second address (long).
+    Returns:
+        - int: Negative, zero or positive, like 'strcmp'.
+*/
+int compareAddresses(const void *first, const void *second);
+
+
+/*
+    Function: findEntryLabel
+    Description: Searches the labels of the '.ent' file for an address.
+    Parameters:
+        - dis: Pointer to the disassembler.
+        - address: The address.
+    Returns:
+        - const char*: The first label at the address, NULL if there's none.
+*/
+const char *findEntryLabel(const disassembler *dis, long address);
+
+
+/*
+    Function: isTarget
+    Description: Checks if an instruction refers to an address.
+    Parameters:
+        - dis: Pointer to the disassembler.
+        - address: The address.
+    Returns:
+        - bool: TRUE if the address was collected by 'collectTargets', FALSE otherwise.
+*/
+bool isTarget(const disassembler *dis, long address);
+
+
+/*
+    Function: writeLabel
+    Description: Writes the name of the label at an address - its '.ent' label, or a made up one.
+    Parameters:
+        - dis: Pointer to the disassembler.
+        - address: The address.
+    Returns:
+        - void
+*/
+void writeLabel(disassembler *dis, long address);
+
+
+/*
+    Function: writeLabelDefinition
+    Description: Starts the source line of an address - its label if it has one, and a tab.
+    Parameters:
+        - dis: Pointer to the disassembler.
+        - address: The address of the line.
+    Returns:
+        - void
+*/
+void writeLabelDefinition(disassembler *dis, long address);
+
+
+/*
+    Function: labelAddressState
+    Description: Checks if a label can be defined at an address of the image.
+    Parameters:
+        - dis: Pointer to the disassembler.
+        - address: The address.
+    Returns:
+        - state: VALID for the address of an instruction or of a data byte, INVALID otherwise.
+*/
+state labelAddressState(const disassembler *dis, long address);
+
+
+/*
+    Function: disassembleInstruction
+    Description: Writes the source line of an encoded instruction.
+    Parameters:
+        - dis: Pointer to the disassembler.
+        - line: Pointer to the line of the instruction in the object file (an error is set in it if it can't be written).
+        - address: The address of the instruction.
+        - word: The encoded instruction.
+    Returns:
+        - state: VALID if the line was written, INVALID if the word can't be written as source (a comment is written).
+    Notes:
+        - The external reference at the address, if any, is consumed.
+*/
+state disassembleInstruction(disassembler *dis, newLine *line, long address, unsigned int word);
+
+
+/*
+    Function: disassembleData
+    Description: Writes the source lines of data bytes, as '.db' directives.
+    Parameters:
+        - dis: Pointer to the disassembler.
+        - address: The address of the first byte.
+        - bytes: The bytes.
+        - numOfBytes: The number of bytes.
+    Returns:
+        - void
+    Notes:
+        - A new directive starts at every address that's referred to, so its label can be defined.
+*/
+void disassembleData(disassembler *dis, long address, const unsigned char *bytes, int numOfBytes);
+
+
+/*
+    Function: disassembleObjectFile
+    Description: Writes the source code of an object file, using its '.ent' and '.ext' files if they exist.
+    Parameters:
+        - dis: Pointer to an initialized disassembler.
+        - baseName: The name of the files without their extension.
+        - out: The stream to write the source to.
+    Returns:
+        - state: VALID if every word was written as source, INVALID otherwise (the errors are printed).
+*/
+state disassembleObjectFile(disassembler *dis, const char *baseName, FILE *out);
+
+
+/*
+    Function: freeDisassembler
+    Description: Releases the labels of the disassembler and closes its files.
+    Parameters:
+        - dis: Pointer to the disassembler.
+    Returns:
+        - void
+*/
+void freeDisassembler(disassembler *dis);
+
+
+#endif
@@ -18,18 +18,14 @@
         Processes the given file and checks if it's valid by performing the first and second passes of the assembly.
     Parameters:
         - fileName: Name of the file to be processed.
-        - codeImage: Pointer to the code image table.
-        - dataImage: Pointer to the data image table.
-        - attrTab: Pointer to the attributes table.
-        - ICF: Pointer to the Instruction Counter Final value.
-        - DCF: Pointer to the Data Counter Final value.
+        - context: Pointer to the assembly context of the file (zero initialized).
     Returns:
         - state: Returns the state (VALID/INVALID) indicating whether the file is valid or not.
     Notes:
-        - Manages the opening, processing, and validation of the assembly file.
-        - Invokes the first and second passes of the assembly process.
+        - Reads the file with 'readInputFile', and validates it with 'sourceIsValid'.
+        - Whether the file is valid or not, the context has to be released by 'freeAssemblyContext'.
 */
-state fileIsValid(const char *fileName, codeTable *codeImage, dataTable *dataImage, attributesTable *attrTab, long *ICF, long *DCF);
+state fileIsValid(const char *fileName, assemblyContext *context);
 
 
 /*
@@ -40,67 +36,103 @@ state fileIsValid(const char *fileName, codeTable *codeImage, dataTable *dataIma
         - fileDescriptor: Pointer to the file descriptor.
         - fileName: Name of the file to be opened.
         - mode: Mode for opening the file (read/write).
+        - errors: The stream the diagnostics of the current file are printed to.
     Returns:
         - state: Returns the state (VALID/INVALID) indicating the success of file opening.
     Notes:
         - Manages file opening according to the specified mode (read/write).
         - If the file opening fails, prints an error.
 */
-state openFile(FILE **fileDescriptor, const char *fileName, char *mode);
+state openFile(FILE **fileDescriptor, const char *fileName, char *mode, FILE *errors);
 
 
 /*
     Function: getFileFullName
     Description: Generates the full name of the file, including the extension.
     Parameters:
-        - fileName: Name of the file without the extension.
+        - fileName: Name of the input file, its extension (if any) is replaced.
         - fileExtension: File extension to be added to the file name.
     Returns:
         - char*: Returns the full file name including the extension.
     Notes:
         - Allocates memory for the full file name and returns the generated name.
+        - The extension is the part of the file's own name (not of its directories) that starts with the last '.'.
+        - The given name isn't modified, so it may be shared by concurrently assembled files.
 */
-char * getFileFullName(char *fileName, char *fileExtension);
+char * getFileFullName(const char *fileName, char *fileExtension);
 
 
 /*
     Function: updateValues
-    Description: Updates the final values of the Instruction Counter, Data Counter, symbol table, and data table
+    Description: Updates the final values of the Instruction Counter, Data Counter and symbol table
                  based on the first pass processing.
     Parameters:
         - ICF: Pointer to the Instruction Counter Final value.
         - DCF: Pointer to the Data Counter Final value.
         - IC: Final value of the Instruction Counter.
         - DC: Final value of the Data Counter.
-        - symTab: Symbol table containing information about symbols.
-        - dataTab: Data table containing information about data elements.
+        - symTab: Pointer to the symbol table containing information about symbols.
     Returns:
         - void
     Notes:
         - Updates the dataType of each symbol in the symbol table that characterized as 'data'.
-        - Updates the addresses of all data entries in the data image table by incrementing each address with ICF value.
+        - The data image itself holds no addresses, it is placed right after the code image when exported.
         - Preserves the final values of IC and DC
 */
-void updateValues(long *ICF, long *DCF, long IC, long DC, symbolTable symTab, dataTable dataTab);
+void updateValues(long *ICF, long *DCF, long IC, long DC, symbolHashTable *symTab);
 
 
 /*
-    Function: processFile
-    Description: Processes the given file, handling the first and second passes, and updating relevant values.
+    Function: readInputFile
+    Description: Reads the entire input file into the source buffer of the context.
     Parameters:
-        - codeImage: Pointer to the code image table.
-        - dataImage: Pointer to the data image table.
-        - attrTab: Pointer to the attributes table.
-        - ICF: Pointer to the Instruction Counter Final value.
-        - DCF: Pointer to the Data Counter Final value.
-        - fd: Pointer to the file descriptor.
+        - fileName: Name of the input file.
+        - context: Pointer to the assembly context of the file.
+    Returns:
+        - state: VALID if the file was read, INVALID if it couldn't be opened (the error is printed).
+*/
+state readInputFile(const char *fileName, assemblyContext *context);
+
+
+/*
+    Function: sourceIsValid
+    Description: Checks if the source in the source buffer of the context is valid, by performing the first and second passes.
+    Parameters:
+        - fileName: Name of the input file (the diagnostics refer to it).
+        - context: Pointer to the assembly context, whose source buffer is already filled.
+    Returns:
+        - state: Returns the state (VALID/INVALID) indicating whether the source is valid or not.
+*/
+state sourceIsValid(const char *fileName, assemblyContext *context);
+
+
+/*
+    Function: completeSource
+    Description: Completes the assembly of a source once its first pass is over - relaxes the branches,
+                 updates the values and performs the second pass.
+    Parameters:
+        - context: Pointer to the assembly context, after the first pass.
+        - line: Pointer to the structure representing a line of code, its number is past the last line of the source.
+        - firstPassState: The state of the first pass.
+        - instructionCounter: The Instruction Counter at the end of the first pass.
+    Returns:
+        - state: Returns the state (VALID/INVALID) indicating the success of the processing.
+*/
+state completeSource(assemblyContext *context, newLine *line, state firstPassState, long instructionCounter);
+
+
+/*
+    Function: processSource
+    Description: Processes the source code in the source buffer of the context, handling the first and second passes.
+    Parameters:
+        - context: Pointer to the assembly context, whose source buffer is already filled.
         - line: Pointer to the structure representing a line of code.
     Returns:
-        - state: Returns the state (VALID/INVALID) indicating the success of file processing.
+        - state: Returns the state (VALID/INVALID) indicating the success of the processing.
     Notes:
-        - Invokes first and second passes, updates values, and manages file processing.
+        - Invokes the first pass, then 'completeSource', and leaves the tables in the context.
 */
-state processFile(codeTable *codeImage, dataTable *dataImage, attributesTable *attrTab, long *ICF, long *DCF, FILE *fd, newLine *line);
+state processSource(assemblyContext *context, newLine *line);
 
 
 #endif
\ No newline at end of file
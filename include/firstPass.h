@@ -17,18 +17,31 @@
     Parameters:
         - line: Pointer to the structure representing a line of code.
         - IC: Pointer to the Instruction Counter.
-        - DC: Pointer to the Data Counter.
-        - symTab: Pointer to the symbol table.
-        - cImage: Pointer to the code image table.
-        - dImage: Pointer to the data image table.
-        - fd: Pointer to the input file descriptor.
+        - context: Pointer to the assembly context - its lines are read from its source buffer,
+                   and its tables are filled by the first pass (the size of its data image is the Data Counter).
     Returns:
         - Returns the validation state of the input file after the first pass. state variable: VALID / INVALID.
     Notes:
         - Uses lineFirstPass() function for each line's processing.
         - Handles directives, instructions, labels, and line errors during the assembly's first pass.
 */
-state firstPass(newLine *line, long *IC, long *DC, symbolTable *symTab, codeTable *cImage, dataTable *dImage, FILE *fd);
+state firstPass(newLine *line, long *IC, assemblyContext *context);
+
+
+/*
+    Function: firstPassFrom
+    Description: Executes the first pass on the lines of the source buffer, numbering them from the given line.
+    Parameters:
+        - line: Pointer to the structure representing a line of code.
+        - firstLineNumber: The number of the first line of the buffer in the input file.
+        - IC: Pointer to the Instruction Counter.
+        - context: Pointer to the assembly context, its lines are read from its source buffer.
+    Returns:
+        - Returns the validation state of the lines after the first pass. state variable: VALID / INVALID.
+    Notes:
+        - The buffer may be a chunk of the input file ('chunkedFirstPass'), the diagnostics carry the lines' numbers in the file.
+*/
+state firstPassFrom(newLine *line, long firstLineNumber, long *IC, assemblyContext *context);
 
 
 /*
@@ -37,16 +50,13 @@ state firstPass(newLine *line, long *IC, long *DC, symbolTable *symTab, codeTabl
     Parameters:
         - line: Pointer to the structure representing a line of code.
         - IC: Pointer to the Instruction Counter.
-        - DC: Pointer to the Data Counter.
-        - symTab: Pointer to the symbol table.
-        - cImage: Pointer to the code image table.
-        - dImage: Pointer to the data image table.
+        - context: Pointer to the assembly context of the current file.
     Returns:
         - The validation state of the line, after the first pass.  state variable: VALID / INVALID.
     Notes:
         - Handles line-specific processing including label settings, directives, and instructions.
 */
-state lineFirstPass(newLine *line, long *IC, long *DC, symbolTable *symTab, codeTable *cImage, dataTable *dImage);
+state lineFirstPass(newLine *line, long *IC, assemblyContext *context);
 
 
 #endif
\ No newline at end of file
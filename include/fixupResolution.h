@@ -0,0 +1,75 @@
+#ifndef UNTITLED_FIXUPRESOLUTION_H
+#define UNTITLED_FIXUPRESOLUTION_H
+
+#include <pthread.h>
+#include "structs.h"
+
+
+/*
+   This file contains the functions resolving the fixups of a large file on several threads ('--fixup-threads N').
+   Once the addresses are final the symbol table is only read, and every fixup completes an instruction of its own,
+   so the fixup table is split into contiguous ranges, one for each thread.
+   Each thread collects the errors and the external references of its range, and the ranges are concatenated
+   by their order - the '.ext' file and the diagnostics are those of a serial second pass.
+*/
+
+
+/*
+   Struct: fixupResolver
+   Description: Represents a range of the fixup table, resolved on a thread of its own.
+   Fields:
+     - context: Pointer to the assembly context of the file.
+     - first: The index of the first fixup of the range.
+     - last: The index right after the last fixup of the range.
+     - externals: The external references of the range, by the order of the fixups.
+     - numOfExternals: The number of external references.
+     - externalsCapacity: The number of external references the array can hold before it has to grow.
+     - errors: The fixups of the range that couldn't be resolved, by their order.
+     - numOfErrors: The number of errors.
+     - errorsCapacity: The number of errors the array can hold before it has to grow.
+     - thread: The thread the range is resolved on.
+     - threadStarted: Whether the range is resolved on its own thread (FALSE if the thread couldn't be created).
+*/
+typedef struct fixupResolver
+{
+    assemblyContext *context;
+    unsigned long first;
+    unsigned long last;
+    externalReference *externals;
+    unsigned long numOfExternals;
+    unsigned long externalsCapacity;
+    fixupError *errors;
+    unsigned long numOfErrors;
+    unsigned long errorsCapacity;
+    pthread_t thread;
+    bool threadStarted;
+} fixupResolver;
+
+
+/*
+    Function: fixupResolverWorker
+    Description: Encodes the fixups of a range, collecting its errors and its external references.
+    Parameters:
+        - resolver: Pointer to the range (fixupResolver *).
+    Returns:
+        - NULL.
+*/
+void *fixupResolverWorker(void *resolver);
+
+
+/*
+    Function: resolveFixupsInParallel
+    Description: Resolves all the fixups of a file, split between the threads of '--fixup-threads'.
+    Parameters:
+        - context: Pointer to the assembly context, after the addresses of the labels are final.
+        - resolved: Pointer to store the fixups that couldn't be resolved (ordered by index), reported by the second pass.
+    Returns:
+        - bool: TRUE if the fixups were resolved, FALSE if the file has fewer than two threads' worth of fixups
+                ('fixupChunkSize', see 'assemblerOptions'), they're left to the second pass.
+    Notes:
+        - The external references are appended to the attributes table by the order of the fixups.
+*/
+bool resolveFixupsInParallel(assemblyContext *context, resolvedFixups *resolved);
+
+
+#endif
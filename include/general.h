@@ -25,13 +25,44 @@
 void *callocWithCheck(unsigned long size);
 
 
+/*
+    Function: reallocWithCheck
+    Description: Changes the size of the given memory block to the specified size.
+    Parameters:
+        - block: Pointer to the memory block to be resized (may be NULL).
+        - size: The new size of the memory block.
+    Returns:
+        - A pointer to the resized memory block.
+    Notes:
+        - Exits the program if memory allocation fails.
+*/
+void *reallocWithCheck(void *block, unsigned long size);
+
+
+/*
+    Function: openMemoryStream
+    Description: Opens a stream that writes into a growing memory buffer.
+    Parameters:
+        - buffer: Pointer to store the buffer, which is '\0' terminated once the stream is flushed or closed.
+        - size: Pointer to store the number of characters written to the buffer.
+    Returns:
+        - The opened stream.
+    Notes:
+        - Exits the program if memory allocation fails.
+        - The caller is responsible for closing the stream, and then freeing the buffer.
+*/
+FILE *openMemoryStream(char **buffer, size_t *size);
+
+
 /*
     Function: addError
-    Description: Allocates memory for the provided error message, and returns a pointer to it.
+    Description: Returns the error message to be stored in the line object.
     Parameters:
        - error: The error message string.
     Returns:
-        - A pointer to the allocated memory containing the error message.
+        - A pointer to the error message.
+    Notes:
+        - All the error messages are string literals, so no memory is allocated for them.
 */
 char *addError(char *error);
 
@@ -41,11 +72,10 @@ char *addError(char *error);
     Description: Prints the first error encountered in the current line.
     Parameters:
         - line: Pointer to the structure representing the current line.
+        - errors: The stream the diagnostics of the current file are printed to.
         Returns: void
-    Notes:
-        - The memory allocated for the error is released after printing the error message.
 */
-void printLineError(newLine *line);
+void printLineError(newLine *line, FILE *errors);
 
 
 /*
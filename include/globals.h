@@ -9,13 +9,16 @@
 */
 
 
-/* Maximum line length from source file - not including '\n' */
-#define maxLineLength 80
+/* Default maximum line length from source file - not including '\n' (a longer line is reported, 0 means no limit) */
+#define defaultMaxLineLength 80
 
 /* Initial the dataType of IC(instruction counter) */
 #define ICInitialValue 100
 
 #define maxLabelLength 31
+
+/* Size of a buffer for a scanned label - one character beyond the maximum length is kept to detect longer labels */
+#define labelBufferLength (maxLabelLength + 2)
 #define maxRegisterLength 2
 
 /* Characteristics of a signed integer consisting of one byte (including +/- sign) */
@@ -38,11 +41,112 @@
 #define min25BitsIntVal (-16777216)
 
 #define maxInstructionLength 5
-#define maxDirectiveName 7
+#define maxInstructionOperands 3
+/* Size of a directive name buffer - one character beyond the longest directive is kept, so longer words never match */
+#define maxDirectiveName 8
 
 #define minRegister 0
 #define maxRegister 31
 
+/* Initial number of slots in the hash index of the symbol table (must be a power of 2) */
+#define symbolTableInitialCapacity 64
+
+/* Initial number of entries in the code image array */
+#define codeImageInitialCapacity 256
+
+/* Initial number of bytes in the data image buffer */
+#define dataImageInitialCapacity 1024
+
+/* Initial number of entries in the fixup table */
+#define fixupTableInitialCapacity 64
+
+/* Initial number of entries in the table of the '.entry' directives */
+#define deferredEntriesInitialCapacity 16
+
+/* Number of slots in the perfect hash table of the reserved words (must be a power of 2) */
+#define reservedWordTableSize 64
+
+/* Number of bytes read from the input file at once, the whole file is kept in a single buffer */
+#define sourceReadChunkSize 65536
+
+/* Number of bytes the output writer collects before writing them to the file */
+#define outputBufferSize 65536
+
+/* Number of bytes in a block of the per-file arena (larger allocations get a block of their own) */
+#define arenaBlockSize 16384
+
+/* Version of the assembler, part of the key of every cached file - changing it invalidates the whole cache */
+#define assemblerVersion "1.3"
+
+/* Number of hexadecimal digits in the key (and the name) of a cache entry */
+#define cacheKeyLength 16
+
+/* Default maximum size of the assembly cache, in megabytes */
+#define defaultCacheSizeLimit 256
+
+/* Name of the object file written by the linker, unless another name is given */
+#define defaultLinkedFileName "linked.ob"
+
+/* Number of registers of the machine, '$0' to '$31' */
+#define numOfRegisters (maxRegister + 1)
+
+/* Number of bytes of memory of the simulated machine - every address a 'J' instruction can hold (25 bits) */
+#define simulatorMemorySize 33554432UL
+
+/* Number of instructions a conditional branch can span (its 'immed' field holds a distance of up to 32767 bytes) */
+#define relaxationWindow ((max2BytesIntVal + 1) / 4 + 1)
+
+/* Number of opcodes an instruction can hold (6 bits), and the largest funct of the 'R' instructions */
+#define numOfOpcodes 64
+#define maxFunct 5
+
+/* Number of bytes of the object file the disassembler reads at once, only the current lines are kept */
+#define streamChunkSize 16384
+
+/* The character the labels the disassembler makes up for addresses no '.ent' file names start with */
+#define syntheticLabelCharacter 'L'
+
+/* Default minimum number of bytes in a chunk of the parallel first pass ('--first-pass-chunk'), a smaller source isn't
+   split between threads. A chunk is about 9 ms of parsing, so splitting and merging it (about 1 ms) costs a tenth of it */
+#define firstPassChunkMinimumSize 262144
+
+/* Default minimum number of fixups resolved by a thread ('--fixup-chunk'), a file with fewer fixups resolves them in the
+   second pass. A thread resolves them in 1-3 ms, so starting and joining it (0.1-0.25 ms) costs about a tenth of it */
+#define fixupChunkMinimumSize 16384
+
+/* Number of items a queue between two stages of the pipeline holds (must be a power of 2) */
+#define pipelineQueueSize 64
+
+/* Number of bytes the reader stage of the pipeline reads at once, a block holds the whole lines among them */
+#define pipelineBlockSize 65536
+
+/* Number of times a stage of the pipeline checks a full or an empty queue before it sleeps until the queue changes */
+#define pipelineSpinLimit 64
+
+/* The name of the default socket of the assembler server, in a directory of the user (see 'defaultServerSocketPath') */
+#define defaultServerSocketName "assembler.sock"
+
+/* The directory of the default socket when 'XDG_RUNTIME_DIR' isn't set, followed by the id of the user */
+#define fallbackSocketDirectory "/tmp/assembler-"
+
+/* Maximum length of a line of a request to the assembler server (not including '\n') */
+#define serverLineLength 4096
+
+/* Number of connections waiting to be accepted by the assembler server */
+#define serverBacklog 16
+
+/* Maximum number of bytes of a section of a request to the assembler server (an inline source or an argument) */
+#define maxRequestSection 268435456UL
+
+/* Maximum number of arguments of a command line run by the assembler server */
+#define maxRequestArguments 1048576L
+
+/* Number of seconds the assembler server waits for the next bytes of a request, before it drops the connection */
+#define serverReceiveTimeout 10
+
+/* Number of descriptors a client passes along with a 'RUN' request: stdin, stdout, stderr and its directory */
+#define numOfPassedDescriptors 4
+
 /* true/false definition */
 typedef enum bool{FALSE,TRUE} bool;
 
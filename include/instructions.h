@@ -34,6 +34,8 @@ state instructionWordState(newLine *line, instructionWord *instructionToken, int
         - instructionToken: Pointer to the instruction token structure.
     Returns:
         - The validation state of the instruction. state variable: VALID \ INVALID.
+    Notes:
+        - The instruction is found in the perfect hash table of the reserved words, with a single compare.
 */
 state searchInstruction(instructionWord *instructionToken);
 
@@ -43,14 +45,14 @@ state searchInstruction(instructionWord *instructionToken);
     Description: Checks if the instruction line is valid, verifying syntax and operands.
     Parameters:
         - line: Pointer to the current line being processed.
-        - instructionToken: The instruction token structure.
+        - instructionIR: Pointer to the scanned instruction line, its operands are filled while they're checked.
         - contentIndex: Index in the line content.
     Returns:
         - The instruction line validation state. state variable: VALID \ INVALID.
     Notes:
         - The validation process is carry out according to the instruction token.
 */
-state instructionLineState(newLine *line, instructionWord instructionToken, int contentIndex);
+state instructionLineState(newLine *line, instructionLine *instructionIR, int contentIndex);
 
 
 /*
@@ -58,14 +60,15 @@ state instructionLineState(newLine *line, instructionWord instructionToken, int
     Description: Checks the syntax of J-dataType instruction.
     Parameters:
         - line: Pointer to the current line being processed.
-        - opcode: Unsigned integer representing the opcode.
-        - symbol: Pointer to a character symbol.
+        - instructionIR: Pointer to the scanned instruction line (the name of a label operand is stored in it).
+        - operand: Pointer to the operand being scanned.
         - index: Pointer to the index in the line content.
         - numOfScannedOperands: Pointer to the number of scanned operands.
     Returns:
         - void
 */
-void checkJOperandsSyntax(newLine *line, unsigned int opcode, char *symbol, int *index, int *numOfScannedOperands);
+void checkJOperandsSyntax(newLine *line, instructionLine *instructionIR, instructionOperand *operand, int *index,
+        int *numOfScannedOperands);
 
 
 /*
@@ -73,14 +76,15 @@ void checkJOperandsSyntax(newLine *line, unsigned int opcode, char *symbol, int
     Description: Checks the syntax of I-dataType instruction.
     Parameters:
         - line: Pointer to the current line being processed.
-        - opcode: Unsigned integer representing the opcode.
-        - symbol: Pointer to a character symbol.
+        - instructionIR: Pointer to the scanned instruction line (the name of a label operand is stored in it).
+        - operand: Pointer to the operand being scanned.
         - index: Pointer to the index in the line content.
         - numOfScannedOperands: Pointer to the number of scanned operands.
     Returns:
         - void
 */
-void checkIOperandsSyntax(newLine *line, unsigned int opcode, char *symbol, int *index, int *numOfScannedOperands);
+void checkIOperandsSyntax(newLine *line, instructionLine *instructionIR, instructionOperand *operand, int *index,
+        int *numOfScannedOperands);
 
 
 /*
@@ -88,14 +92,14 @@ void checkIOperandsSyntax(newLine *line, unsigned int opcode, char *symbol, int
     Description: Checks the validation of an instruction operand based on the instruction dataType.
     Parameters:
         - line: Pointer to the current line being processed.
-        - opcode: Unsigned integer representing the opcode.
-        - symbol: Pointer to a character symbol.
+        - instructionIR: Pointer to the scanned instruction line.
         - index: Pointer to the index in the line content.
-        - numOfScannedOperands: Pointer to the number of scanned operands.
     Returns:
         - void
+    Notes:
+        - The operand (its kind, value and position in the line) is added to the operands of the instruction line.
 */
-void checkOperandByType(newLine *line, unsigned int opcode, char *symbol, int *index, int *numOfScannedOperands);
+void checkOperandByType(newLine *line, instructionLine *instructionIR, int *index);
 
 
 /*
@@ -103,27 +107,14 @@ void checkOperandByType(newLine *line, unsigned int opcode, char *symbol, int *i
     Description: Checks the syntax and validation of an instruction line.
     Parameters:
         - line: Pointer to the current line being processed.
-        - opcode: Unsigned integer representing the opcode.
+        - instructionIR: Pointer to the scanned instruction line.
         - contentIndex: Index in the line content.
     Returns:
         - void
     Notes:
         - The validation of the syntax and operands of an instruction line based on the opcode and the contentIndex.
 */
-void checkInstructionSyntax(newLine *line, unsigned int opcode, int contentIndex);
-
-
-/*
-    Function: getInstruction
-    Description: Retrieves the instruction from the content at a specific index and updates the instructionToken.
-    Parameters:
-        - content: Pointer to the content being processed.
-        - contentIndex: Pointer to the index in the content.
-        - instructionToken: Pointer to the instruction word structure.
-    Returns:
-        - void
-*/
-void getInstruction(const char *content, int *contentIndex, instructionWord *instructionToken);
+void checkInstructionSyntax(newLine *line, instructionLine *instructionIR, int contentIndex);
 
 
 /*
@@ -167,28 +158,27 @@ state addressState(newLine *line, symbolTable label, instructionType type, long
         - index: Pointer to the index in the content.
         - labelSet: Boolean indicating if a label is set for the instruction.
         - label: Pointer to the label string.
-        - symTab: Pointer to the symbol table.
-        - cImage: Pointer to the code image table.
+        - context: Pointer to the assembly context of the current file.
         - IC: Pointer to the instruction counter.
     Returns:
         - void
+    Notes:
+        - The line is scanned once into an 'instructionLine', from which the code image entry and the fixup are made.
+        - If the instruction has a label operand, records a fixup for it,
+          the binary encoding of the instruction is completed in the second pass.
 */
-void processInstruction(newLine *line, int *index, bool labelSet , char *label, symbolTable *symTab, codeTable *cImage, long *IC);
+void processInstruction(newLine *line, int *index, bool labelSet , char *label, assemblyContext *context, long *IC);
 
 
 /*
     Function: instructionWithLabelOperand
     Description: Determines if the instruction has a label operand.
     Parameters:
-        - line: Pointer to the current line being processed.
-        - index: Index in the content.
-        - opcode: Unsigned integer representing the instruction opcode.
+        - instructionIR: Pointer to the scanned instruction line.
     Returns:
         - If the instruction has a label operand. bool variable: TRUE / FALSE.
-    Notes:
-        - Determines if the instruction has a label operand based on the provided opcode.
 */
-bool instructionWithLabelOperand(newLine *line, int index, unsigned int opcode);
+bool instructionWithLabelOperand(const instructionLine *instructionIR);
 
 
 /*
@@ -200,6 +190,8 @@ bool instructionWithLabelOperand(newLine *line, int index, unsigned int opcode);
         - Pointer to the array of reserved instruction words. pointer to instructionWord variable.
     Notes:
         - Each instruction contains information about its name, opcode, funct and dataType.
+        - The perfect hash table in 'reservedWords.c' refers to the instructions by their index in this array,
+          so its order must be kept.
 */
 instructionWord *getReservedInstructions(int *numberOfInstructions);
 
@@ -0,0 +1,309 @@
+#ifndef UNTITLED_JOBS_H
+#define UNTITLED_JOBS_H
+
+#include <pthread.h>
+#include "structs.h"
+
+
+/*
+   This file contains the functions responsible for assembling the input files - one after the other,
+   or concurrently on a pool of worker threads ('-j N').
+   Each file is assembled in its own context, so the files are independent of each other. When running in parallel,
+   the diagnostics of each file are collected in a buffer and printed in the order of the files in the command line,
+   so the output is identical to the output of a sequential run.
+   The sizes of the files may differ by orders of magnitude, so the pool schedules the largest files first: they're
+   dealt to the queues of the workers by their sizes, each worker takes the largest file left in its own queue,
+   and a worker whose queue is empty steals from the queue with the most work left. A few huge files don't end up
+   alone at the end of the run, and a file that takes longer than its size suggests is balanced by the stealing.
+*/
+
+
+/*
+   Struct: assemblyJob
+   Description: Represents an input file assembled by the worker pool.
+   Fields:
+     - fileName: The name of the input file.
+     - diagnostics: The diagnostics printed while assembling the file (not terminated by '\0').
+     - diagnosticsSize: The number of characters in 'diagnostics'.
+     - done: Whether the assembly of the file is over.
+     - outcome: How the outputs of the file were obtained (see 'cacheOutcome').
+     - statistics: The statistics of the file, collected when '--stats' or '--stats-json' was given.
+     - size: The size of the file in bytes, the estimate of its work (0 if it can't be read).
+*/
+typedef struct assemblyJob
+{
+    const char *fileName;
+    unsigned long size;
+    char *diagnostics;
+    size_t diagnosticsSize;
+    bool done;
+    cacheOutcome outcome;
+    assemblyStatistics statistics;
+} assemblyJob;
+
+
+/*
+   Struct: jobQueue
+   Description: Represents the files scheduled on a worker, a slice of the schedule of the pool.
+   Fields:
+     - first: The index in the schedule of the next file of the queue (the largest one left).
+     - last: The index in the schedule right after the last file of the queue.
+     - remainingBytes: The total size of the files left in the queue.
+     - lock: Protects the queue, it's taken from by its worker and by the workers that steal from it.
+*/
+typedef struct jobQueue
+{
+    int first;
+    int last;
+    unsigned long remainingBytes;
+    pthread_mutex_t lock;
+} jobQueue;
+
+
+/*
+   Struct: workerPool
+   Description: Represents the state shared by the worker threads and the thread that prints the diagnostics.
+   Fields:
+     - jobs: Array of the jobs, one for each input file, by the order of the command line.
+     - numOfJobs: The number of jobs.
+     - schedule: The indexes of the jobs, the queue of every worker is a slice of it, ordered from the largest file.
+     - queues: The queues of the workers, one for each worker.
+     - numOfQueues: The number of queues.
+     - options: Pointer to the options of the assembler.
+     - contexts: The contexts the files are kept in for the linker, one for each job (whole-program mode),
+                 NULL if every worker assembles its files in a context of its own.
+     - timings: The time of every job, by the order of the jobs ('--timings'), NULL if the files aren't timed.
+     - lock: Protects the 'done' flags of the jobs.
+     - jobDone: Signaled every time a job is done.
+*/
+typedef struct workerPool
+{
+    assemblyJob *jobs;
+    int numOfJobs;
+    int *schedule;
+    jobQueue *queues;
+    int numOfQueues;
+    const assemblerOptions *options;
+    assemblyContext *contexts;
+    fileTiming *timings;
+    pthread_mutex_t lock;
+    pthread_cond_t jobDone;
+} workerPool;
+
+
+/*
+   Struct: poolWorker
+   Description: Represents a worker thread of the pool.
+   Fields:
+     - pool: Pointer to the pool.
+     - index: The number of the worker, the index of its queue.
+     - thread: The thread of the worker.
+*/
+typedef struct poolWorker
+{
+    workerPool *pool;
+    int index;
+    pthread_t thread;
+} poolWorker;
+
+
+/*
+    Function: assembleFile
+    Description: Assembles a single input file, and creates its output files if it's valid.
+    Parameters:
+        - fileName: The name of the input file.
+        - options: Pointer to the options of the assembler.
+        - errors: The stream the diagnostics of the file are printed to.
+        - context: Pointer to a zero initialized assembly context.
+        - statistics: Pointer to zero initialized statistics the file is timed and counted into, NULL if it isn't.
+    Returns:
+        - cacheOutcome: cacheHit/cacheMiss when the cache is used and the file was read, cacheUnused otherwise.
+    Notes:
+        - With a cache directory, the outputs of an unchanged file are restored from the cache (cache.h),
+          and the outputs of a file assembled without diagnostics are stored in it.
+        - The context is released once the output files are created, and left zero initialized for the next file.
+        - In whole-program mode ('--link') no output file is created, and the context of a valid file is kept
+          for the linker (the context of an invalid file is still released).
+        - When compiled with 'ARENA_STATS' defined, the allocation counters of the file's arena are printed.
+*/
+cacheOutcome assembleFile(const char *fileName, const assemblerOptions *options, FILE *errors, assemblyContext *context,
+        assemblyStatistics *statistics);
+
+
+/*
+    Function: inputFileSize
+    Description: Finds the size of an input file, without reading it.
+    Parameters:
+        - fileName: The name of the file.
+    Returns:
+        - unsigned long: The size of the file in bytes, 0 if it can't be read (the error is reported once it's assembled).
+*/
+unsigned long inputFileSize(const char *fileName);
+
+
+/*
+    Function: compareJobSizes
+    Description: Compares two jobs by the sizes of their files, for 'qsort'.
+    Parameters:
+        - first: Pointer to a pointer to the first job (assemblyJob **).
+        - second: Pointer to a pointer to the second job (assemblyJob **).
+    Returns:
+        - int: Negative if the first job comes first (its file is larger), positive if the second one comes first.
+    Notes:
+        - Jobs of the same size keep the order of the command line, so the schedule is the same in every run.
+*/
+int compareJobSizes(const void *first, const void *second);
+
+
+/*
+    Function: scheduleJobs
+    Description: Deals the jobs of the pool to the queues of its workers, the largest files first.
+    Parameters:
+        - pool: Pointer to the pool, holding the jobs and their sizes.
+        - numOfQueues: The number of queues (the number of workers).
+    Returns:
+        - void
+    Notes:
+        - Every file, from the largest to the smallest, is added to the queue with the fewest bytes so far,
+          so the queues start with about the same amount of work, and each queue is ordered from its largest file.
+*/
+void scheduleJobs(workerPool *pool, int numOfQueues);
+
+
+/*
+    Function: takeFromQueue
+    Description: Takes the next job of a queue.
+    Parameters:
+        - pool: Pointer to the pool.
+        - queue: Pointer to the queue, locked by the caller.
+    Returns:
+        - int: The index of the job, -1 if the queue is empty.
+*/
+int takeFromQueue(workerPool *pool, jobQueue *queue);
+
+
+/*
+    Function: takeJob
+    Description: Takes the next job of a worker - from its own queue, or stolen from another worker when it's empty.
+    Parameters:
+        - pool: Pointer to the pool.
+        - worker: The number of the worker.
+    Returns:
+        - int: The index of the job, -1 if no job is left in any queue.
+    Notes:
+        - The stolen job is the largest one left in the queue with the most bytes left, the file most likely
+          to delay the end of the run.
+*/
+int takeJob(workerPool *pool, int worker);
+
+
+/*
+    Function: assemblyWorker
+    Description: The function run by each worker thread - takes the next job until no job is left.
+    Parameters:
+        - worker: Pointer to the worker (poolWorker *).
+    Returns:
+        - NULL
+    Notes:
+        - The diagnostics of each file are printed into a memory stream, and kept in its job.
+*/
+void *assemblyWorker(void *worker);
+
+
+/*
+    Function: runAssembler
+    Description: Runs a command line of the assembler - assembles the input files it names, or serves requests.
+    Parameters:
+        - argc: Number of command line arguments.
+        - argv: Array of command line argument strings.
+        - isServed: Whether the command line is run by the assembler server for a client ('--serve' isn't allowed).
+    Returns:
+        - int: The exit status of the assembler, 0.
+    Notes:
+        - The options and the input files are parsed by 'parseOptions' (options.h).
+        - With '--serve SOCKET' the assembler serves requests on SOCKET instead (see server.h).
+*/
+int runAssembler(int argc, char *argv[], bool isServed);
+
+
+/*
+    Function: assembleFiles
+    Description: Assembles all the given input files.
+    Parameters:
+        - files: Array of the names of the input files.
+        - numOfFiles: The number of input files.
+        - options: Pointer to the options of the assembler.
+    Returns:
+        - void
+    Notes:
+        - With '-j N' (N > 1) and more than one file, the files are assembled by up to N worker threads,
+          while the calling thread prints the diagnostics of each file, by the order of the files, once it's done.
+        - Otherwise, the files are assembled one after the other, and the diagnostics are printed directly to stderr.
+        - Once all the files are done, the cache is trimmed to its size limit, and its statistics are printed
+          to stdout if '--cache-stats' was given.
+        - With '--stats' or '--stats-json' the statistics of each file are printed to stdout, by the order of the files.
+        - With '--timings' a summary of the time of every file is printed to stdout once they're all done.
+        - In whole-program mode ('--link') the cache isn't used, the files are kept in their contexts
+          and linked in memory once they're all done (see 'linkProgram').
+*/
+void assembleFiles(char **files, int numOfFiles, const assemblerOptions *options);
+
+
+/*
+    Function: assembleSequentially
+    Description: Assembles the input files one after the other.
+    Parameters:
+        - files: Array of the names of the input files.
+        - numOfFiles: The number of input files.
+        - options: Pointer to the options of the assembler.
+        - contexts: Array of zero initialized contexts to keep the files in (one for each file), NULL if the files
+                    aren't kept.
+        - statistics: Pointer to the statistics of the cache, the outcome of every file is counted.
+        - timings: Array to store the time of every file in (one for each file), NULL if the files aren't timed.
+    Returns:
+        - void
+*/
+void assembleSequentially(char **files, int numOfFiles, const assemblerOptions *options, assemblyContext *contexts,
+        cacheStatistics *statistics, fileTiming *timings);
+
+
+/*
+    Function: assembleInParallel
+    Description: Assembles the input files on a pool of up to '-j N' worker threads.
+    Parameters:
+        - files: Array of the names of the input files.
+        - numOfFiles: The number of input files.
+        - options: Pointer to the options of the assembler.
+        - contexts: Array of zero initialized contexts to keep the files in (one for each file), NULL if the files
+                    aren't kept.
+        - statistics: Pointer to the statistics of the cache, the outcome of every file is counted.
+        - timings: Array to store the time of every file in (one for each file), NULL if the files aren't timed.
+    Returns:
+        - int: The number of workers the files were scheduled on.
+    Notes:
+        - The files are scheduled by their sizes (see 'scheduleJobs'), and the workers steal from each other.
+        - The calling thread prints the diagnostics of each file, by the order of the files, once it's done.
+*/
+int assembleInParallel(char **files, int numOfFiles, const assemblerOptions *options, assemblyContext *contexts,
+        cacheStatistics *statistics, fileTiming *timings);
+
+
+/*
+    Function: linkProgram
+    Description: Links the files of a program, assembled in memory, into a single object file (whole-program mode).
+    Parameters:
+        - files: Array of the names of the input files, by the order they're linked in.
+        - numOfFiles: The number of input files.
+        - contexts: The contexts the files were kept in.
+        - options: Pointer to the options of the assembler, holding the name of the linked object file.
+    Returns:
+        - void
+    Notes:
+        - The '.extern' labels of every file are resolved against the '.entry' labels of the other files directly
+          from their tables, no '.ob', '.ent' or '.ext' file is written or read.
+        - If any of the files is invalid, or an external label can't be resolved, the object file isn't created.
+*/
+void linkProgram(char **files, int numOfFiles, assemblyContext *contexts, const assemblerOptions *options);
+
+
+#endif
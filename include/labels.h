@@ -30,12 +30,14 @@ void checkAttributeValidity(newLine *line, imageType type, symbolTable table);
     Parameters:
         - label: Pointer to the label string.
         - line: Pointer to the structure representing the current line.
-        - head: Pointer to the symbol table head.
+        - table: Pointer to the symbol table.
         - type: The image type.
     Returns:
         - If the given label is defined. bool variable: TRUE / FALSE.
+    Notes:
+        - The label is looked up through the hash index of the symbol table.
 */
-bool labelIsDefined(char *label, newLine *line, symbolTable head, imageType type);
+bool labelIsDefined(char *label, newLine *line, symbolHashTable *table, imageType type);
 
 
 /*
@@ -55,10 +57,12 @@ state labelIsValid(newLine *line, char *label);
     Description: Checks if the string that starts in given index of the given represents label definition.
     Parameters:
         - lineContent: Pointer to the content of the line.
-        - symbol: Pointer to the symbol string.
+        - symbol: Pointer to the symbol string (of size labelBufferLength).
         - contentIndex: Pointer to the index of the content.
     Returns:
         - If it's a label definition. bool variable: TRUE / FALSE.
+    Notes:
+        - Lines aren't limited in length, so only the beginning of a longer word is stored in 'symbol'.
 */
 bool symbolIsLabelDefinition(const char *lineContent, char *symbol, int *contentIndex);
 
@@ -69,44 +73,16 @@ bool symbolIsLabelDefinition(const char *lineContent, char *symbol, int *content
     Parameters:
         - content: Pointer to the content string.
         - index: Pointer to the current index in the content.
-        - label: Pointer to store the extracted label string.
+        - label: Pointer to store the extracted label string (of size labelBufferLength).
     Returns:
         - void
     Notes:
         - Extracts the label from the content at the current index position into 'label'.
+        - A label longer than the buffer is cut, it's still longer than maxLabelLength and reported as such.
 */
 void getLabelName(const char *content, int *index, char *label);
 
 
-/*
-    Function: skipLabelDefinition
-    Description: Skips the label definition in the content.
-    Parameters:
-        - content: Pointer to the content string.
-        - index: Pointer to the current index in the content.
-    Returns:
-        - void
-    Notes:
-        - Skips the label definition (if any) and updates the index accordingly.
-*/
-void skipLabelDefinition(const char *content, int *index);
-
-
-/*
-    Function: extractLabelFromLine
-    Description: Finds and extracts the label from the content.
-    Parameters:
-        - symbol: Pointer to store the extracted label string.
-        - content: Pointer to the content string.
-        - index: The current index in the content.
-    Returns:
-        - void
-    Notes:
-        - Searches for a label in the content and extracts it to the 'symbol' variable.
-*/
-void extractLabelFromLine(char *symbol, const char *content, int index);
-
-
 /*
     Function: getLabelFromTable
     Description: Trying to extract label from the symbol table.
@@ -114,14 +90,14 @@ void extractLabelFromLine(char *symbol, const char *content, int index);
         - line: Pointer to the structure representing the current line.
         - symbol: Pointer to the string representing label's name.
         - label: Pointer to the storage location of the label, if found.
-        - table: The symbol table.
+        - table: Pointer to the symbol table.
     Returns:
         - If the required label has been found. state variable - VALID / INVALID.
     Notes:
         - Searches for a label in the symbol table by the name stored in 'symbol' and retrieves it into 'label'.
         - If failed to find the required label, adds the proper error to the line object.
 */
-state getLabelFromTable(newLine *line, char *symbol, symbolTable *label, symbolTable table);
+state getLabelFromTable(newLine *line, char *symbol, symbolTable *label, symbolHashTable *table);
 
 
 /*
@@ -140,22 +116,6 @@ state getLabelFromTable(newLine *line, char *symbol, symbolTable *label, symbolT
 void checkForLabelSetting(newLine *line, char *symbol, int *contentIndex, bool *labelSetting);
 
 
-/*
-    Function: defineLabelAsEntry
-    Description: Adds 'entry' attribute to a defined label.
-    Parameters:
-        - line: Pointer to the structure representing the current line.
-        - symbolTab: Symbol table.
-        - index: Pointer to the current index.
-        - label: Pointer to the label string.
-    Returns:
-        - void
-    Notes:
-        - Marks the given label as an 'entry' in the symbol table.
-*/
-void defineLabelAsEntry(newLine *line, symbolTable symbolTab, int *index, char *label);
-
-
 /*
     Function: labelNameIsReservedWord
     Description: Checks if the label name is a reserved word representing an instruction or directive.
@@ -164,8 +124,8 @@ void defineLabelAsEntry(newLine *line, symbolTable symbolTab, int *index, char *
     Returns:
         - If the label name is a reserved instruction/directive word. bool variable: TRUE / FALSE.
     Notes:
-        - The determination is carried out by iterating over all the instruction and directive words,
-          and checking whether the given label is equal to one of them.
+        - The determination is carried out by a single lookup in the perfect hash table of the reserved words,
+          which holds both the instruction and the directive words.
 */
 bool labelNameIsReservedWord(char *label);
 
@@ -0,0 +1,74 @@
+#ifndef UNTITLED_LIBASSEMBLER_H
+#define UNTITLED_LIBASSEMBLER_H
+
+#include <stdio.h>
+#include "structs.h"
+#include "options.h"
+#include "tables.h"
+
+
+/*
+   This file is the interface of the assembler library (libassembler), which assembles source code from memory
+   into in-memory structures, without reading or writing any file.
+   All the state of an assembly is kept in its assembly context, so any number of contexts can be assembled
+   concurrently in one process, each by a single thread.
+   The results are the tables of the context (see 'assemblyContext' in structs.h):
+     - codeImage/dataImage: The code and data images, with the final counters 'ICF' and 'DCF'.
+     - symbolTab: The symbol table (use 'findSymbol' to look a symbol up, or walk it from 'symbolTab.head').
+     - attributesTab: The entry and external labels, with their addresses.
+     - diagnostics: The errors found in the source, one per line, in the format of the command line assembler.
+   Everything the context owns is released by 'freeAssemblyContext' (tables.h).
+*/
+
+
+/*
+    Function: assembleSource
+    Description: Assembles source code held in memory.
+    Parameters:
+        - context: Pointer to a zero initialized assembly context.
+        - options: Pointer to the options of the assembler, NULL for the default options (see 'setDefaultOptions').
+        - sourceName: The name the diagnostics refer to the source by.
+        - source: The source code (not necessarily terminated by '\0').
+        - size: The number of characters in 'source'.
+    Returns:
+        - state: VALID if the source was assembled without errors, INVALID otherwise.
+    Notes:
+        - The source is copied, so it can be released once the function returns.
+        - If 'errors' of the context is NULL, the diagnostics are collected in 'diagnostics' of the context,
+          otherwise they're printed to the given stream (e.g. stderr).
+        - The tables are left in the context even if the source isn't valid, until the context is released.
+*/
+state assembleSource(assemblyContext *context, const assemblerOptions *options, const char *sourceName,
+                     const char *source, unsigned long size);
+
+
+/*
+    Function: objectFileImage
+    Description: Formats the object file of an assembled source into memory.
+    Parameters:
+        - context: Pointer to the assembly context of a valid source.
+        - size: Pointer to store the number of characters in the image.
+    Returns:
+        - char*: The content of the object file ('\0' terminated), identical to the '.ob' file of the command line assembler.
+    Notes:
+        - The caller is responsible for freeing the returned image.
+*/
+char *objectFileImage(assemblyContext *context, size_t *size);
+
+
+/*
+    Function: attributesFileImage
+    Description: Formats the entries or externals file of an assembled source into memory.
+    Parameters:
+        - context: Pointer to the assembly context of a valid source.
+        - type: 'entry' for the content of the '.ent' file, 'external' for the content of the '.ext' file.
+        - size: Pointer to store the number of characters in the image (0 if there are no such labels).
+    Returns:
+        - char*: The content of the file ('\0' terminated).
+    Notes:
+        - The caller is responsible for freeing the returned image.
+*/
+char *attributesFileImage(assemblyContext *context, imageType type, size_t *size);
+
+
+#endif
@@ -7,38 +7,118 @@
 
 /*
    This file provides functions for handling and analyzing lines from an input file,
-   including skipping to the next line, checking line length validity,
+   including reading the input file into a buffer and handing out its lines, checking line length validity,
    identifying empty or comment lines and printing line error.
 */
 
 
 /*
-    Function: skipToTheNextLine
-    Description: Skips to the beginning of the next line in the input file.
+    Function: readSourceFile
+    Description: Reads the entire content of the input file into a single buffer.
     Parameters:
         - fileDescriptor: Pointer to the file being read.
+        - source: Pointer to the source buffer to be filled.
     Returns:
         - void
     Notes:
-        - This function reads characters from the file descriptor until the next line or the end of the file.
+        - The file is read in large chunks until its end, so it may also be a pipe or another non-seekable stream.
+        - If the last line doesn't end with '\n', one is appended, so every line in the buffer ends with '\n'.
+        - The buffer is terminated by '\0', it's released along with the assembly context.
 */
-void skipToTheNextLine(FILE *fileDescriptor);
+void readSourceFile(FILE *fileDescriptor, sourceBuffer *source);
+
+
+/*
+    Function: loadSourceBuffer
+    Description: Copies source code that's already in memory into the source buffer.
+    Parameters:
+        - content: The source code (not necessarily terminated by '\0').
+        - size: The number of characters in 'content'.
+        - source: Pointer to the source buffer to be filled.
+    Returns:
+        - void
+    Notes:
+        - The same as 'readSourceFile', the buffer ends with '\n' and '\0', and it's released along with the assembly context.
+*/
+void loadSourceBuffer(const char *content, unsigned long size, sourceBuffer *source);
+
+
+/*
+    Function: countSourceLines
+    Description: Counts the lines of the source buffer.
+    Parameters:
+        - source: Pointer to the source buffer.
+    Returns:
+        - long: The number of lines, the same number the first pass counts.
+*/
+long countSourceLines(const sourceBuffer *source);
+
+
+/*
+    Function: nextSourceLine
+    Description: Hands out the next line of the source buffer, as a view into the buffer.
+    Parameters:
+        - source: Pointer to the source buffer.
+        - line: Pointer to the structure representing the current line.
+    Returns:
+        - TRUE if a line was handed out, FALSE at the end of the source. bool variable: TRUE/FALSE
+    Notes:
+        - Sets the content and the length of 'line', the line itself isn't copied.
+*/
+bool nextSourceLine(sourceBuffer *source, newLine *line);
+
+
+/*
+    Function: openLineStream
+    Description: Prepares the given stream for reading the given file line by line.
+    Parameters:
+        - stream: Pointer to the line stream.
+        - fileDescriptor: The file to be read, from its current position.
+    Returns:
+        - void
+*/
+void openLineStream(lineStream *stream, FILE *fileDescriptor);
+
+
+/*
+    Function: nextStreamLine
+    Description: Hands out the next line of the file, as a view into the window of the stream.
+    Parameters:
+        - stream: Pointer to the line stream.
+        - line: Pointer to the structure representing the current line.
+    Returns:
+        - TRUE if a line was handed out, FALSE at the end of the file. bool variable: TRUE/FALSE
+    Notes:
+        - The line is valid until the next call, the window is refilled from the file once its lines run out.
+        - Like 'nextSourceLine', the length doesn't include the '\n', and the last line may lack one.
+*/
+bool nextStreamLine(lineStream *stream, newLine *line);
+
+
+/*
+    Function: closeLineStream
+    Description: Releases the window of the stream and closes its file.
+    Parameters:
+        - stream: Pointer to the line stream.
+    Returns:
+        - void
+*/
+void closeLineStream(lineStream *stream);
 
 
 /*
     Function: lineLength
     Description: Checks if the line length is valid and updates the line state accordingly.
     Parameters:
-        - inputLine: Pointer to the content of the line being processed.
         - line: Pointer to the structure representing the current line.
-        - fd: Pointer to the file being read.
+        - maxLength: The maximum length of a line (not including '\n'), 0 means no limit.
     Returns:
         - The state of the line. state variable: valid/invalid.
     Notes:
-        - This function checks if the length of the line exceeds the maximum allowed length.
-        - If the line length is invalid, it adds an error to the line structure and skips to the next line.
+        - The maximum length is only a diagnostic - lines of any length are held in the source buffer.
+        - If the line length is invalid, it adds an error to the line structure.
 */
-state lineLength(const char *inputLine, newLine *line, FILE *fd);
+state lineLength(newLine *line, long maxLength);
 
 
 /*
@@ -70,9 +150,10 @@ bool commentLine(const char *lineContent, int *currentIndex);
     Description: Prints an error message associated with the line if there's any error present.
     Parameters:
         - line: Pointer to the structure representing the current line.
+        - errors: The stream the diagnostics of the current file are printed to.
     Returns:
         - void
 */
-void printLineError(newLine *line);
+void printLineError(newLine *line, FILE *errors);
 
 #endif
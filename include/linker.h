@@ -0,0 +1,361 @@
+#ifndef UNTITLED_LINKER_H
+#define UNTITLED_LINKER_H
+
+#include <stdio.h>
+#include "structs.h"
+
+
+/*
+   This file contains the functions of the linker, which links the outputs of separately assembled files (modules)
+   into one object file.
+   The code images of the modules are placed one after the other starting at address 100, followed by their data images,
+   one after the other. The addresses held by the instructions are relocated accordingly, the entries of all the modules
+   ('.ent' files) make up a hash table of global symbols, and every external reference ('.ext' files) is patched with
+   the linked address of its symbol.
+   Every file is read once and every line is handled once, so the linking is linear in the total size of the modules.
+*/
+
+
+/*
+    Function: instructionTypeOf
+    Description: Finds the type of an instruction by its opcode.
+    Parameters:
+        - opcode: The opcode of the instruction.
+    Returns:
+        - instructionType: R, I or J.
+*/
+instructionType instructionTypeOf(unsigned int opcode);
+
+
+/*
+    Function: appendCodeWord
+    Description: Appends an encoded instruction to a code image.
+    Parameters:
+        - table: Pointer to the code image table.
+        - word: The encoded instruction (32-bit).
+        - address: The address of the instruction.
+        - lineNumber: The line of the instruction in its object file.
+    Returns:
+        - void
+    Notes:
+        - Doubles the capacity of the array when it is full, so appending takes amortized constant time.
+*/
+void appendCodeWord(codeImageTable *table, unsigned int word, long address, long lineNumber);
+
+
+/*
+    Function: hexDigitValue
+    Description: Converts a hexadecimal digit to its value.
+    Parameters:
+        - digit: The digit (upper or lower case).
+    Returns:
+        - int: The value of the digit, -1 if it's not a hexadecimal digit.
+*/
+int hexDigitValue(char digit);
+
+
+/*
+    Function: parseObjectLine
+    Description: Scans the bytes of a line of an object file (after the header line).
+    Parameters:
+        - line: Pointer to the line (an error is set in it if the line is invalid).
+        - bytes: Pointer to the table the bytes are appended to.
+    Returns:
+        - state: The state of the line. VALID / INVALID.
+    Notes:
+        - A line is an address followed by up to 4 bytes, the bytes are taken by their order in the file.
+*/
+state parseObjectLine(newLine *line, dataImageTable *bytes);
+
+
+/*
+    Function: scanDecimal
+    Description: Scans a non-negative decimal number in a line.
+    Parameters:
+        - line: Pointer to the line.
+        - index: Pointer to the index in the line, advanced past the number.
+        - value: Pointer to store the number.
+    Returns:
+        - bool: TRUE if at least one digit was scanned, FALSE otherwise.
+*/
+bool scanDecimal(const newLine *line, unsigned long *index, long *value);
+
+
+/*
+    Function: parseObjectHeader
+    Description: Scans the header line of an object file.
+    Parameters:
+        - line: Pointer to the line (an error is set in it if the line is invalid).
+        - codeSize: Pointer to store the size of the code image, in bytes.
+        - dataSize: Pointer to store the size of the data image, in bytes.
+    Returns:
+        - state: The state of the line. VALID / INVALID.
+*/
+state parseObjectHeader(newLine *line, long *codeSize, long *dataSize);
+
+
+/*
+    Function: parseSymbolLine
+    Description: Scans a line of an entries or externals file.
+    Parameters:
+        - line: Pointer to the line (an error is set in it if the line is invalid).
+        - name: Buffer (of labelBufferLength characters) to store the name of the symbol.
+        - address: Pointer to store the address.
+    Returns:
+        - state: The state of the line. VALID / INVALID.
+*/
+state parseSymbolLine(newLine *line, char *name, long *address);
+
+
+/*
+    Function: parseObjectFile
+    Description: Parses an object file, appending its code and its data to the given images.
+    Parameters:
+        - content: Pointer to the content of the object file.
+        - line: Pointer to a line with the name of the file set (an error is set in it if the file is invalid).
+        - codeImage: Pointer to the code image the instructions are appended to.
+        - dataImage: Pointer to the data image the data is appended to.
+        - codeBase: The address the first instruction is given in the code image.
+        - codeSize: Pointer to store the size of the code image of the file, in bytes.
+        - dataSize: Pointer to store the size of the data image of the file, in bytes.
+    Returns:
+        - state: VALID if the file is valid, INVALID otherwise (nothing is appended to the images).
+    Notes:
+        - Every instruction keeps the line of the object file it was read from, for the errors found later.
+*/
+state parseObjectFile(sourceBuffer *content, newLine *line, codeImageTable *codeImage, dataImageTable *dataImage,
+        long codeBase, long *codeSize, long *dataSize);
+
+
+/*
+    Function: readModuleFile
+    Description: Reads an output file of a module.
+    Parameters:
+        - linker: Pointer to the linker context.
+        - moduleName: The name of the module.
+        - extension: The extension of the file ('.ob', '.ent' or '.ext').
+        - content: Pointer to the buffer the file is read into.
+        - required: Whether the file must exist - a module without entries or externals has no '.ent' or '.ext' file.
+    Returns:
+        - state: VALID if the file was read, INVALID otherwise (an error is reported only for a required file).
+*/
+state readModuleFile(linkerContext *linker, const char *moduleName, char *extension, sourceBuffer *content,
+        bool required);
+
+
+/*
+    Function: reportLinkerError
+    Description: Prints the error of a line of a module file, and counts it.
+    Parameters:
+        - linker: Pointer to the linker context.
+        - line: Pointer to the line holding the error.
+    Returns:
+        - void
+*/
+void reportLinkerError(linkerContext *linker, newLine *line);
+
+
+/*
+    Function: moduleFileName
+    Description: Finds the name of the file the errors of a module refer to.
+    Parameters:
+        - module: Pointer to the module.
+        - extension: The extension of the output file the errors are found in ('.ob', '.ent' or '.ext').
+    Returns:
+        - char*: The name of the file (allocated). The source file when the module was assembled in memory,
+                 the output file of the module otherwise.
+*/
+char *moduleFileName(const linkerModule *module, char *extension);
+
+
+/*
+    Function: loadObjectFile
+    Description: Loads the object file of a module, appending its code and data to the linked images.
+    Parameters:
+        - linker: Pointer to the linker context.
+        - module: Pointer to the module, its name already set.
+    Returns:
+        - void
+    Notes:
+        - Sets the sizes of the module, the address its code is loaded at and the index of its first instruction.
+        - The data is appended to the linked data image, its address is known only once all the code is loaded.
+*/
+void loadObjectFile(linkerContext *linker, linkerModule *module);
+
+
+/*
+    Function: loadAssembledModule
+    Description: Loads a module assembled in memory, appending its code and data to the linked images.
+    Parameters:
+        - linker: Pointer to the linker context.
+        - module: Pointer to the module, its name and context already set.
+    Returns:
+        - void
+    Notes:
+        - The same as 'loadObjectFile', the code and data are copied from the tables of the context
+          instead of being read from the object file, and the instructions keep their source line numbers.
+*/
+void loadAssembledModule(linkerContext *linker, linkerModule *module);
+
+
+/*
+    Function: relocateAddress
+    Description: Converts an address within a module to its address in the linked image.
+    Parameters:
+        - module: Pointer to the module.
+        - address: The address within the module (in its code image or in its data image).
+        - linkedAddress: Pointer to store the address in the linked image.
+    Returns:
+        - state: VALID if the address is in the module, INVALID otherwise.
+*/
+state relocateAddress(const linkerModule *module, long address, long *linkedAddress);
+
+
+/*
+    Function: relocateModule
+    Description: Relocates the addresses held by the instructions of a module.
+    Parameters:
+        - linker: Pointer to the linker context.
+        - module: Pointer to the module.
+    Returns:
+        - void
+    Notes:
+        - The label operands of 'jmp'/'la'/'call' (J instructions) hold the address of the label, it's relocated.
+        - A conditional branch holds the distance to its label, it changes only if the label is in the data image.
+        - External references hold 0 until they're patched, they're left as they are.
+*/
+void relocateModule(linkerContext *linker, linkerModule *module);
+
+
+/*
+    Function: addGlobalEntry
+    Description: Adds an entry of a module to the global symbols, at its linked address.
+    Parameters:
+        - linker: Pointer to the linker context.
+        - module: Pointer to the module.
+        - line: Pointer to the line the entry comes from (an error is set in it if the entry is invalid).
+        - name: The name of the entry.
+        - address: The address of the entry within the module.
+    Returns:
+        - void
+    Notes:
+        - An entry already defined by another module is an error, an entry repeated by the same module is ignored.
+*/
+void addGlobalEntry(linkerContext *linker, const linkerModule *module, newLine *line, char *name, long address);
+
+
+/*
+    Function: patchExternalReference
+    Description: Patches an external reference of a module with the linked address of its symbol.
+    Parameters:
+        - linker: Pointer to the linker context.
+        - module: Pointer to the module.
+        - line: Pointer to the line the reference comes from (an error is set in it if the reference can't be patched).
+        - name: The name of the external label.
+        - address: The address of the referencing instruction within the module.
+    Returns:
+        - void
+*/
+void patchExternalReference(linkerContext *linker, const linkerModule *module, newLine *line, char *name,
+        long address);
+
+
+/*
+    Function: loadEntries
+    Description: Adds the entries of a module ('.ent' file, or the '.entry' directives of a module assembled in memory)
+                 to the global symbols, at their linked addresses.
+    Parameters:
+        - linker: Pointer to the linker context.
+        - module: Pointer to the module.
+    Returns:
+        - void
+    Notes:
+        - An entry defined by more than one module is reported.
+*/
+void loadEntries(linkerContext *linker, linkerModule *module);
+
+
+/*
+    Function: patchExternals
+    Description: Patches every external reference of a module ('.ext' file, or the attributes table of a module
+                 assembled in memory) with the linked address of its symbol.
+    Parameters:
+        - linker: Pointer to the linker context.
+        - module: Pointer to the module.
+    Returns:
+        - void
+    Notes:
+        - A reference to a symbol that isn't an entry of any module is reported.
+*/
+void patchExternals(linkerContext *linker, linkerModule *module);
+
+
+/*
+    Function: resolveModules
+    Description: Places the data images of the loaded modules, relocates the modules and resolves their external references.
+    Parameters:
+        - linker: Pointer to the linker context, all its modules already loaded.
+    Returns:
+        - state: VALID if no error was found, INVALID otherwise.
+*/
+state resolveModules(linkerContext *linker);
+
+
+/*
+    Function: linkModules
+    Description: Links the given modules.
+    Parameters:
+        - linker: Pointer to a zero initialized linker context, with 'errors' set.
+        - moduleNames: The names of the modules (with or without an extension), by the order they're linked in.
+        - numOfModules: The number of modules.
+    Returns:
+        - state: VALID if the modules were linked without errors, INVALID otherwise.
+    Notes:
+        - The linked image is left in the context, see 'writeLinkedImage'.
+*/
+state linkModules(linkerContext *linker, char **moduleNames, int numOfModules);
+
+
+/*
+    Function: linkAssembledFiles
+    Description: Links files assembled in this process, straight from their assembly contexts (whole-program mode).
+    Parameters:
+        - linker: Pointer to a zero initialized linker context, with 'errors' set.
+        - contexts: The contexts of the assembled files, all of them valid.
+        - fileNames: The names of the source files, by the order they're linked in.
+        - numOfFiles: The number of files.
+    Returns:
+        - state: VALID if the files were linked without errors, INVALID otherwise.
+    Notes:
+        - Links the same way as 'linkModules', without writing and reading back the '.ob', '.ent' and '.ext' files.
+        - The contexts are only read, they're still owned (and released) by the caller.
+*/
+state linkAssembledFiles(linkerContext *linker, assemblyContext *contexts, char **fileNames, int numOfFiles);
+
+
+/*
+    Function: writeLinkedImage
+    Description: Writes the linked image as an object file.
+    Parameters:
+        - linker: Pointer to the linker context.
+        - outputName: The name of the object file to be created.
+    Returns:
+        - void
+    Notes:
+        - The object file has the same format as the object files of the assembler (see 'createObjectFile').
+*/
+void writeLinkedImage(linkerContext *linker, const char *outputName);
+
+
+/*
+    Function: freeLinkerContext
+    Description: Releases everything the linker context owns, and leaves it zero initialized.
+    Parameters:
+        - linker: Pointer to the linker context.
+    Returns:
+        - void
+*/
+void freeLinkerContext(linkerContext *linker);
+
+
+#endif
@@ -0,0 +1,119 @@
+#ifndef UNTITLED_OPTIONS_H
+#define UNTITLED_OPTIONS_H
+
+#include "structs.h"
+
+
+/*
+   This file contains the functions responsible for parsing the command line of the assembler,
+   separating the options from the names of the input files.
+*/
+
+
+/*
+    Function: setDefaultOptions
+    Description: Sets the default values of all the options.
+    Parameters:
+        - options: Pointer to the options structure.
+    Returns:
+        - void
+*/
+void setDefaultOptions(assemblerOptions *options);
+
+
+/*
+    Function: scanOptionValue
+    Description: Converts the value of a numeric option.
+    Parameters:
+        - optionName: The name of the option (used in the error message).
+        - value: The value following the option in the command line, NULL if the option is the last argument.
+        - result: Pointer to store the converted value.
+    Returns:
+        - The state of the conversion. state variable: VALID / INVALID.
+    Notes:
+        - Prints an error if the value is missing or isn't a non-negative integer.
+*/
+state scanOptionValue(const char *optionName, const char *value, long *result);
+
+
+/*
+    Function: addInputFile
+    Description: Appends the name of an input file to the list of the input files.
+    Parameters:
+        - files: Pointer to the list of the input files.
+        - name: The name of the file, it isn't copied.
+    Returns:
+        - void
+*/
+void addInputFile(inputFileList *files, char *name);
+
+
+/*
+    Function: readFileList
+    Description: Reads a list file ('@FILE', '--files-from FILE') and appends the names of the input files in it.
+    Parameters:
+        - listName: The name of the list file, '-' reads the list from stdin.
+        - files: Pointer to the list of the input files.
+    Returns:
+        - The state of the reading. state variable: VALID / INVALID.
+    Notes:
+        - The list holds a name on every line, the spaces around a name are ignored, so a name may contain spaces.
+        - Empty lines and lines starting with '#' are skipped.
+        - The list is kept in 'files', the names point into it.
+        - Prints an error if the list file can't be opened.
+*/
+state readFileList(const char *listName, inputFileList *files);
+
+
+/*
+    Function: freeInputFileList
+    Description: Releases the names of the input files and the list files they were read from.
+    Parameters:
+        - files: Pointer to the list of the input files, left empty.
+    Returns:
+        - void
+*/
+void freeInputFileList(inputFileList *files);
+
+
+/*
+    Function: parseOptions
+    Description: Parses the command line, stores the received options and collects the names of the input files.
+    Parameters:
+        - argc: Number of command line arguments.
+        - argv: Array of command line argument strings.
+        - options: Pointer to the options structure, already holding the default values.
+        - files: Pointer to an empty list to store the names of the input files in.
+    Returns:
+        - The state of the parsing. state variable: VALID / INVALID.
+    Notes:
+        - Options may appear anywhere in the command line, every other argument is the name of an input file.
+        - '@FILE' and '--files-from FILE' read the names of input files from FILE, one on each line (see 'readFileList'),
+          for builds with more files than a command line can hold. They're assembled in the place of the list.
+        - Supported options:
+            --max-line-length N : Reports lines longer than N characters (default 80, 0 means no limit).
+            -j N                : Assembles up to N files concurrently (default 1).
+            --first-pass-threads N : Splits the first pass of a large file between N threads (default 1).
+            --fixup-threads N   : Resolves the label operands of a large file on N threads (default 1).
+            --first-pass-chunk N: Splits the first pass in chunks of at least N bytes (default 262144).
+            --fixup-chunk N     : Resolves at least N label operands on each thread (default 16384).
+            --pipeline          : Reads, parses and writes each file on a pipeline of threads (see pipeline.h).
+                                  With '--cache-dir' only the files missing from the cache go through the pipeline,
+                                  from the source read for the cache key. It can't be used with '--link'.
+            --cache-dir DIR     : Restores the outputs of unchanged files from the assembly cache in DIR (see cache.h).
+            --cache-size N      : Limits the assembly cache to N megabytes (default 256).
+            --cache-stats       : Prints the hits and misses of the assembly cache once all the files are done.
+            --stats             : Prints the time of each phase, the sizes of the tables and the allocations of each file.
+            --stats-json        : The same as '--stats', a JSON object per file (one per line).
+            --timings           : Prints the time of every file, the slowest first, once all the files are done.
+            --files-from FILE   : Reads the names of input files from FILE ('-' for stdin), the same as '@FILE'.
+            --serve [SOCKET]    : Serves assembly requests on the Unix-domain socket SOCKET (default: the socket of the user,
+                                  see server.h), until asked to stop.
+            --link FILE         : Assembles the files as one program, and links them in memory into the object file FILE.
+        - Any other argument that starts with '-' is reported as an unknown option.
+        - Prints an error for an unknown option, an invalid option value or options that can't be used together.
+*/
+state parseOptions(int argc, char *argv[], assemblerOptions *options, inputFileList *files);
+
+
+#endif
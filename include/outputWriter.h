@@ -0,0 +1,118 @@
+#ifndef UNTITLED_OUTPUTWRITER_H
+#define UNTITLED_OUTPUTWRITER_H
+
+#include <stdio.h>
+#include "structs.h"
+
+
+/*
+   This file contains the functions of the output writer, used for exporting the object file.
+   The addresses and bytes are formatted into the buffer of the writer (bytes through a 256-entry hex lookup table),
+   and the buffer is written to the file only when it fills up, so a large image is written with few calls.
+*/
+
+
+/*
+    Function: initOutputWriter
+    Description: Prepares the given writer for writing to the given file.
+    Parameters:
+        - writer: Pointer to the output writer.
+        - fd: The file to write to.
+    Returns:
+        - void
+*/
+void initOutputWriter(outputWriter *writer, FILE *fd);
+
+
+/*
+    Function: reserveOutput
+    Description: Makes sure the buffer of the writer has room for the given number of bytes.
+    Parameters:
+        - writer: Pointer to the output writer.
+        - numOfBytes: The number of bytes about to be written (at most outputBufferSize).
+    Returns:
+        - void
+    Notes:
+        - Flushes the buffer if there isn't enough room left in it.
+*/
+void reserveOutput(outputWriter *writer, unsigned long numOfBytes);
+
+
+/*
+    Function: writeHexByte
+    Description: Writes the given byte as two uppercase hexadecimal digits (like "%02X").
+    Parameters:
+        - writer: Pointer to the output writer.
+        - byte: The byte to be written.
+    Returns:
+        - void
+*/
+void writeHexByte(outputWriter *writer, unsigned char byte);
+
+
+/*
+    Function: writeDecimal
+    Description: Writes the given number in decimal, padded with zeros to the given number of digits (like "%04ld").
+    Parameters:
+        - writer: Pointer to the output writer.
+        - number: The number to be written.
+        - minDigits: The minimal number of digits to be written.
+    Returns:
+        - void
+*/
+void writeDecimal(outputWriter *writer, long number, int minDigits);
+
+
+/*
+    Function: writeChar
+    Description: Writes a single character.
+    Parameters:
+        - writer: Pointer to the output writer.
+        - character: The character to be written.
+    Returns:
+        - void
+*/
+void writeChar(outputWriter *writer, char character);
+
+
+/*
+    Function: writeString
+    Description: Writes a '\0' terminated string, of any length (see 'writeBlock').
+    Parameters:
+        - writer: Pointer to the output writer.
+        - string: The string to be written.
+    Returns:
+        - void
+*/
+void writeString(outputWriter *writer, const char *string);
+
+
+/*
+    Function: writeBlock
+    Description: Writes a block of characters, of any size.
+    Parameters:
+        - writer: Pointer to the output writer.
+        - block: The characters to be written (NULL if size is 0).
+        - size: The number of characters.
+    Returns:
+        - void
+    Notes:
+        - A block larger than the buffer is written to the file directly, without being copied.
+*/
+void writeBlock(outputWriter *writer, const char *block, unsigned long size);
+
+
+/*
+    Function: flushOutputWriter
+    Description: Writes the bytes collected in the buffer of the writer to its file, and empties the buffer.
+    Parameters:
+        - writer: Pointer to the output writer.
+    Returns:
+        - void
+    Notes:
+        - Must be called once the writing is over, before the file is closed.
+*/
+void flushOutputWriter(outputWriter *writer);
+
+
+#endif
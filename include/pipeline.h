@@ -0,0 +1,307 @@
+#ifndef UNTITLED_PIPELINE_H
+#define UNTITLED_PIPELINE_H
+
+#include <pthread.h>
+#include "structs.h"
+
+
+/*
+   This file contains the functions of the pipelined assembly of a file ('--pipeline').
+   The file goes through three stages, each on a thread of its own, connected by bounded single-producer
+   single-consumer queues:
+     - The reader reads the file in blocks of whole lines ('pipelineBlockSize' bytes).
+     - The parser runs the first pass on every block as soon as it's read. After each block it resolves the fixups
+       of the longest prefix of the code image whose labels are already known, and hands its instructions on.
+     - The writer formats the lines of the object file for those instructions, while the parser goes on.
+   Once the source is parsed, the second pass runs as usual and only the rest of the code image is formatted,
+   so the time of the file is bounded by its slowest stage rather than by the sum of the stages.
+   A label in the data image gets its address only once the code image is complete, so a prefix stops at the
+   first instruction that refers to one. If branch relaxation changes the code image, the formatted prefix is dropped.
+   The outputs and the diagnostics are the same as those of the other modes.
+*/
+
+
+/*
+   Struct: pipelineQueue
+   Description: Represents a bounded queue between two stages of the pipeline (a single producer and a single consumer).
+   Fields:
+     - items: The ring of the queued items.
+     - head: The number of items taken from the queue (written only by the consumer).
+     - tail: The number of items put in the queue (written only by the producer).
+     - waiters: The number of stages sleeping on the queue (0 or 1).
+     - spinLimit: The number of times a stage checks a full or an empty queue before it sleeps.
+     - lock: Protects the sleep of a stage, and 'head' and 'tail' where the compiler has no atomic operations.
+     - changed: Signaled when 'head' or 'tail' changes while a stage sleeps on the queue.
+   Notes:
+     - With GCC (or a compatible compiler) the queue is lock-free while neither stage waits for the other,
+       'head' and 'tail' are read and written atomically.
+     - A NULL item marks the end of the stream.
+*/
+typedef struct pipelineQueue
+{
+    void *items[pipelineQueueSize];
+    unsigned long head;
+    unsigned long tail;
+    unsigned long waiters;
+    int spinLimit;
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+} pipelineQueue;
+
+
+/*
+   Struct: sourceBlock
+   Description: Represents a block of whole lines of the source, read by the reader stage.
+   Fields:
+     - source: The lines of the block, every line ends with '\n'.
+*/
+typedef struct sourceBlock
+{
+    sourceBuffer source;
+} sourceBlock;
+
+
+/*
+   Struct: codeBatch
+   Description: Represents instructions whose encoding is complete, handed by the parser stage to the writer stage.
+   Fields:
+     - entries: Copies of the instructions (the code image may move while the parser goes on).
+     - count: The number of instructions.
+*/
+typedef struct codeBatch
+{
+    codeImageEntry *entries;
+    unsigned long count;
+} codeBatch;
+
+
+/*
+   Struct: assemblyPipeline
+   Description: Represents the state shared by the stages of the pipeline.
+   Fields:
+     - input: The input file, read by the reader stage.
+     - blocks: The queue of the source blocks, from the reader to the parser.
+     - batches: The queue of the encoded instructions, from the parser to the writer.
+     - codeText: The lines of the object file formatted by the writer (not terminated by '\0').
+     - codeTextSize: The number of characters in 'codeText'.
+     - formatted: The number of instructions handed to the writer.
+     - nextFixup: The index of the first fixup after the handed instructions.
+     - prefixBlocked: Whether no more instructions are handed to the writer (a branch that needs relaxation was found).
+     - reader: The thread of the reader stage.
+     - writer: The thread of the writer stage.
+*/
+typedef struct assemblyPipeline
+{
+    FILE *input;
+    pipelineQueue blocks;
+    pipelineQueue batches;
+    char *codeText;
+    size_t codeTextSize;
+    unsigned long formatted;
+    unsigned long nextFixup;
+    bool prefixBlocked;
+    pthread_t reader;
+    pthread_t writer;
+} assemblyPipeline;
+
+
+/*
+    Function: initPipelineQueue
+    Description: Initializes an empty queue, its lock and its condition.
+    Parameters:
+        - queue: Pointer to the queue.
+    Returns:
+        - void
+    Notes:
+        - With a single processor online a stage sleeps at once, the other stage can't move while it spins.
+*/
+void initPipelineQueue(pipelineQueue *queue);
+
+
+/*
+    Function: loadQueueIndex
+    Description: Reads the head or the tail of a queue, written by the other stage.
+    Parameters:
+        - queue: Pointer to the queue.
+        - index: Pointer to the head or the tail of the queue.
+    Returns:
+        - unsigned long: The value of the index.
+    Notes:
+        - An acquire load, so the items published before the index was written are visible.
+*/
+unsigned long loadQueueIndex(pipelineQueue *queue, unsigned long *index);
+
+
+/*
+    Function: storeQueueIndex
+    Description: Writes the head or the tail of a queue, read by the other stage, and wakes the other stage if it sleeps.
+    Parameters:
+        - queue: Pointer to the queue.
+        - index: Pointer to the head or the tail of the queue.
+        - value: The new value of the index.
+    Returns:
+        - void
+    Notes:
+        - The items written before the store are visible to the other stage along with the index.
+        - The store and the check for a sleeping stage are sequentially consistent, so either the sleeping stage sees
+          the new value before it sleeps, or the store sees the stage and wakes it.
+*/
+void storeQueueIndex(pipelineQueue *queue, unsigned long *index, unsigned long value);
+
+
+/*
+    Function: waitForQueue
+    Description: Waits for the other stage of a full or an empty queue to change the head or the tail of the queue.
+    Parameters:
+        - queue: Pointer to the queue.
+        - index: Pointer to the head or the tail of the queue, written by the other stage.
+        - value: The value of the index the stage waits to change.
+        - spins: Pointer to the number of times the stage already waited for the queue.
+    Returns:
+        - void
+    Notes:
+        - The first 'spinLimit' waits return at once (the other stage is usually about to move),
+          later ones sleep on the queue until the index changes, so a stage never takes a processor while it waits.
+*/
+void waitForQueue(pipelineQueue *queue, unsigned long *index, unsigned long value, int *spins);
+
+
+/*
+    Function: pushPipelineQueue
+    Description: Puts an item in a queue, waiting while the queue is full.
+    Parameters:
+        - queue: Pointer to the queue.
+        - item: The item, NULL marks the end of the stream.
+    Returns:
+        - void
+*/
+void pushPipelineQueue(pipelineQueue *queue, void *item);
+
+
+/*
+    Function: popPipelineQueue
+    Description: Takes the next item from a queue, waiting while the queue is empty.
+    Parameters:
+        - queue: Pointer to the queue.
+    Returns:
+        - void *: The item, NULL at the end of the stream.
+    Notes:
+        - A waiting stage spins 'spinLimit' times, then sleeps until the queue changes (see 'waitForQueue').
+*/
+void *popPipelineQueue(pipelineQueue *queue);
+
+
+/*
+    Function: readerStage
+    Description: Reads the input file into blocks of whole lines and queues them for the parser.
+    Parameters:
+        - pipeline: Pointer to the pipeline (assemblyPipeline *).
+    Returns:
+        - NULL.
+    Notes:
+        - A line longer than a block is kept whole, its block grows until it holds it.
+        - Like 'readSourceFile', a last line without '\n' gets one.
+*/
+void *readerStage(void *pipeline);
+
+
+/*
+    Function: writerStage
+    Description: Formats the lines of the object file for the queued instructions, until the end of the stream.
+    Parameters:
+        - pipeline: Pointer to the pipeline (assemblyPipeline *).
+    Returns:
+        - NULL.
+*/
+void *writerStage(void *pipeline);
+
+
+/*
+    Function: handResolvedPrefix
+    Description: Resolves the fixups of the instructions parsed so far, from the first one not handed to the writer,
+                 and hands the instructions to the writer until an instruction whose label isn't known yet.
+    Parameters:
+        - pipeline: Pointer to the pipeline.
+        - context: Pointer to the assembly context, in the middle of the first pass.
+    Returns:
+        - void
+    Notes:
+        - A label is known once it's defined in the code image, or declared '.extern' for a 'J' instruction.
+        - A branch to a known label that's out of range blocks the prefix for good (the branch is relaxed later).
+*/
+void handResolvedPrefix(assemblyPipeline *pipeline, assemblyContext *context);
+
+
+/*
+    Function: parserStage
+    Description: Runs the first pass on the queued blocks, handing the resolved prefix to the writer after each block.
+    Parameters:
+        - pipeline: Pointer to the pipeline.
+        - line: Pointer to the structure representing a line of code, its number is set past the last line.
+        - IC: Pointer to the Instruction Counter.
+        - context: Pointer to the assembly context.
+    Returns:
+        - The state of the first pass. state variable: VALID / INVALID.
+*/
+state parserStage(assemblyPipeline *pipeline, newLine *line, long *IC, assemblyContext *context);
+
+
+/*
+    Function: assembleStreamPipelined
+    Description: Assembles a source read from a stream through the pipeline, and creates its output files if it's valid.
+    Parameters:
+        - fileName: The name of the input file (the output files and the diagnostics are named after it).
+        - input: The stream of the source, at its start (left open).
+        - context: Pointer to the assembly context of the file.
+    Returns:
+        - The state of the file. state variable: VALID / INVALID.
+    Notes:
+        - Without the threads of the stages the source is assembled serially (see 'assembleStreamSerially').
+*/
+state assembleStreamPipelined(const char *fileName, FILE *input, assemblyContext *context);
+
+
+/*
+    Function: assembleStreamSerially
+    Description: Assembles a source read from a stream like the serial modes do, and creates its output files if it's valid.
+    Parameters:
+        - fileName: The name of the input file.
+        - input: The stream of the source (rewound to its start, left open).
+        - context: Pointer to the assembly context of the file.
+    Returns:
+        - The state of the file. state variable: VALID / INVALID.
+*/
+state assembleStreamSerially(const char *fileName, FILE *input, assemblyContext *context);
+
+
+/*
+    Function: assemblePipelined
+    Description: Assembles an input file through the pipeline, and creates its output files if it's valid.
+    Parameters:
+        - fileName: The name of the input file.
+        - context: Pointer to the assembly context of the file.
+    Returns:
+        - The state of the file. state variable: VALID / INVALID.
+    Notes:
+        - The source isn't kept in the context, every block is released once it's parsed.
+*/
+state assemblePipelined(const char *fileName, assemblyContext *context);
+
+
+/*
+    Function: assembleSourcePipelined
+    Description: Assembles the source already read into the context through the pipeline, and creates its output files if
+                 it's valid.
+    Parameters:
+        - fileName: The name of the input file.
+        - context: Pointer to the assembly context of the file, holding its source.
+    Returns:
+        - The state of the file. state variable: VALID / INVALID.
+    Notes:
+        - Used on a miss of the assembly cache: the pipeline parses the very bytes the cache key was made of.
+        - The source stays in the context, released along with it. An empty source is assembled serially.
+*/
+state assembleSourcePipelined(const char *fileName, assemblyContext *context);
+
+
+#endif
@@ -0,0 +1,132 @@
+#ifndef UNTITLED_RELAXATION_H
+#define UNTITLED_RELAXATION_H
+
+#include "structs.h"
+
+
+/*
+   This file contains the functions of the branch relaxation, which runs between the first pass and the second pass.
+   A conditional branch whose label is too far for its 16-bit 'immed' field is replaced by an inverted branch over a
+   'jmp' to the label:
+       bne $1, $2, L   ->   beq $1, $2, (+8)            blt $1, $2, L   ->   bgt $1, $2, (+12)
+                            jmp L                                            beq $1, $2, (+8)
+                                                                             jmp L
+   ('bgt' is relaxed like 'blt', with 'blt' first). A relaxed branch moves the instructions after it, which may push
+   other branches out of range, so the sizes are recomputed until they converge:
+     - Every branch that doesn't fit when no branch is relaxed is relaxed at once (the distances only grow).
+     - All the branches are checked once more, then every relaxed branch is put in a worklist, and only the branches
+       around it ('relaxationWindow' instructions, the longest span of a branch that fits) are checked again.
+   The addresses are kept in a Fenwick tree of the added bytes, and the code image is rebuilt once, at the end.
+   A file whose branches all fit is left untouched.
+*/
+
+
+/*
+    Function: addGrowth
+    Description: Records the bytes added to an instruction.
+    Parameters:
+        - relaxation: Pointer to the relaxation state.
+        - index: The index of the instruction (in the code image of the first pass).
+        - bytes: The number of added bytes.
+    Returns:
+        - void
+*/
+void addGrowth(branchRelaxation *relaxation, unsigned long index, long bytes);
+
+
+/*
+    Function: relaxedAddress
+    Description: Computes the address of an instruction, with the bytes added to the instructions before it.
+    Parameters:
+        - relaxation: Pointer to the relaxation state.
+        - index: The index of the instruction (in the code image of the first pass).
+    Returns:
+        - long: The address of the instruction.
+*/
+long relaxedAddress(const branchRelaxation *relaxation, unsigned long index);
+
+
+/*
+    Function: branchFits
+    Description: Checks if the distance of a branch to its label fits its 'immed' field, with the current addresses.
+    Parameters:
+        - relaxation: Pointer to the relaxation state.
+        - branch: Pointer to the branch.
+    Returns:
+        - bool: TRUE if the distance fits, FALSE otherwise.
+    Notes:
+        - The address of a data label is the end of the code image (ICF) plus its address in the data image.
+*/
+bool branchFits(const branchRelaxation *relaxation, const relaxedBranch *branch);
+
+
+/*
+    Function: relaxBranch
+    Description: Relaxes a branch - records the words it's replaced by, and adds it to the worklist.
+    Parameters:
+        - relaxation: Pointer to the relaxation state.
+        - branch: Pointer to the branch.
+        - image: Pointer to the code image.
+    Returns:
+        - void
+*/
+void relaxBranch(branchRelaxation *relaxation, relaxedBranch *branch, const codeImageTable *image);
+
+
+/*
+    Function: checkBranchesAround
+    Description: Relaxes the branches around a relaxed branch that no longer fit.
+    Parameters:
+        - relaxation: Pointer to the relaxation state.
+        - index: The index (in the code image) of the relaxed branch.
+        - image: Pointer to the code image.
+    Returns:
+        - void
+    Notes:
+        - Only the branches within 'relaxationWindow' instructions of the index are checked, they're found by binary search.
+*/
+void checkBranchesAround(branchRelaxation *relaxation, unsigned long index, const codeImageTable *image);
+
+
+/*
+    Function: collectBranches
+    Description: Collects the conditional branches whose label is defined in the file.
+    Parameters:
+        - relaxation: Pointer to the relaxation state.
+        - context: Pointer to the assembly context, after the first pass.
+    Returns:
+        - void
+    Notes:
+        - A branch to an undefined or an external label is left to the second pass, which reports it.
+*/
+void collectBranches(branchRelaxation *relaxation, assemblyContext *context);
+
+
+/*
+    Function: expandCodeImage
+    Description: Rebuilds the code image with the relaxed branches, and moves the labels, the fixups and the
+                 instructions to their new addresses.
+    Parameters:
+        - relaxation: Pointer to the relaxation state.
+        - context: Pointer to the assembly context.
+    Returns:
+        - void
+    Notes:
+        - The fixup of a relaxed branch becomes a 'J' fixup of its 'jmp', all the added words keep the line of the branch.
+*/
+void expandCodeImage(branchRelaxation *relaxation, assemblyContext *context);
+
+
+/*
+    Function: relaxBranches
+    Description: Relaxes the conditional branches of the file whose labels are out of their range.
+    Parameters:
+        - context: Pointer to the assembly context, after a successful first pass.
+        - IC: Pointer to the instruction counter, updated to the end of the rebuilt code image.
+    Returns:
+        - void
+*/
+void relaxBranches(assemblyContext *context, long *IC);
+
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef UNTITLED_RESERVEDWORDS_H
+#define UNTITLED_RESERVEDWORDS_H
+
+#include "structs.h"
+
+
+/*
+   This file contains the functions used for classifying a word as one of the reserved words of the language -
+   the instruction names and the directive names.
+   The reserved words are kept in a perfect hash table, so classifying a word costs one hash and one compare.
+*/
+
+
+/*
+    Function: hashReservedWord
+    Description: Computes the slot of the given word in the perfect hash table of the reserved words.
+    Parameters:
+        - word: The word to be hashed.
+    Returns:
+        - The slot of the word, between 0 and reservedWordTableSize - 1.
+    Notes:
+        - The hash combines the length, the first two characters and the last character of the word.
+          Its multipliers were chosen so that each reserved word falls into a slot of its own.
+*/
+unsigned int hashReservedWord(const char *word);
+
+
+/*
+    Function: findReservedWord
+    Description: Searches the given word in the perfect hash table of the reserved words.
+    Parameters:
+        - word: The word to be searched.
+    Returns:
+        - A pointer to the slot of the reserved word, or NULL if the word isn't reserved.
+    Notes:
+        - The slot holds the index of the word in the instructions/directives table, according to its type.
+*/
+const reservedWord *findReservedWord(const char *word);
+
+
+#endif
@@ -1,53 +1,55 @@
-
 #ifndef UNTITLED_SECONDPASS_H
 #define UNTITLED_SECONDPASS_H
 
 #include "structs.h"
 
 
-/* This file contains functions responsible for performing the second of the two passes on the input file */
+/*
+   This file contains functions responsible for performing the second of the two passes on the input file.
+   The second pass doesn't read the input file again, it backpatches the lines recorded during the first pass.
+*/
 
 
 /*
     Function: secondPass
-    Description: Performs a second pass on a single input file, checking the validity of each line.
+    Description: Performs a second pass on a single input file, completing what the first pass couldn't.
     Parameters:
         - line: Pointer to the structure representing the current line.
-        - symbolTab: Pointer to the symbol table structure.
-        - codeImage: Pointer to the code image table structure.
-        - attributesTab: Pointer to the attributes table structure.
-        - fd: Pointer to the input file stream.
+        - context: Pointer to the assembly context, holding the fixups and '.entry' directives recorded in the first pass.
     Returns:
         - The state of the process. state variable: VALID / INVALID.
     Notes:
-        - This function processes each line from the input file, performing a second pass.
-        - It checks the validity of each line and performs necessary operations based on the line type (directive/instruction).
+        - Called once the symbol table is complete, so every label operand and every '.entry' operand can be resolved.
+        - Handles the recorded fixups and '.entry' directives together, by the order of their lines,
+          so the errors are printed in the same order as they appear in the input file.
+        - With '--fixup-threads N' the fixups of a large file are resolved on several threads first,
+          and only their errors are reported along with the '.entry' directives.
         - Updates the attributes table, symbol table, and code image table as required during the second pass.
         - Returns the state of the overall process.
           Returns VALID if all line are processed without errors, otherwise, returns INVALID.
 */
-state secondPass(newLine *line, symbolTable symbolTab, codeTable codeImage, attributesTable *attributesTab, FILE *fd);
+state secondPass(newLine *line, assemblyContext *context);
 
 
 /*
     Function: lineSecondPass
-    Description: Performs a second pass on a single line from the input file.
+    Description: Performs the second pass on the next recorded line - a fixup or an '.entry' directive.
     Parameters:
         - line: Pointer to the structure representing the current line.
-        - symbolTab: Pointer to the symbol table structure.
-        - codeImage: Pointer to the code image table structure.
-        - attributesTab: Pointer to the attributes table structure.
+        - fixupIndex: Pointer to the index of the next fixup to be resolved.
+        - entryIndex: Pointer to the index of the next '.entry' directive to be applied.
+        - resolved: The errors of the fixups, when they were resolved in parallel ('resolveFixupsInParallel'),
+                    NULL if the fixup is resolved here.
+        - context: Pointer to the assembly context of the current file.
     Returns:
         - The state of the line's validation. state variable: VALID / INVALID.
-        - The state of the line's validation. state variable: VALID / INVALID.
     Notes:
-        - This function processes a single line from the input file during the second pass.
-        - It checks the type of line (directive/instruction) and performs appropriate actions based on the line type.
-        - Updates the symbol table, code image table, and attributes table as required for the line.
-        - Returns the state of the line's validation.
-          Returns VALID if the line is processed without errors; otherwise, returns INVALID.
+        - Both tables are ordered by line number, the one whose next line comes first is handled,
+          and its index is advanced.
+        - Sets the line number of 'line' to the number of the handled line.
 */
-state lineSecondPass(newLine *line, symbolTable symbolTab, codeTable codeImage, attributesTable *attributesTab);
+state lineSecondPass(newLine *line, unsigned long *fixupIndex, unsigned long *entryIndex, resolvedFixups *resolved,
+        assemblyContext *context);
 
 
 #endif
@@ -0,0 +1,336 @@
+#ifndef UNTITLED_SERVER_H
+#define UNTITLED_SERVER_H
+
+#include "structs.h"
+
+
+/*
+   This file contains the functions of the assembler server ('--serve SOCKET') and of its clients.
+   The server stays up between requests, so they don't pay for the start of a process: its allocator, the pages of
+   its tables and the directory of its assembly cache stay warm.
+   It listens on a Unix-domain socket, and serves a single request on every connection. Only the user that runs the
+   server can connect to it: the socket is created for the user alone, and a connection of another user is refused
+   (the client likewise never passes its streams to a server of another user). The default socket is
+   '$XDG_RUNTIME_DIR/assembler.sock', or 'assembler.sock' in a directory '/tmp/assembler-<uid>' only the user can reach.
+   A request is a line, followed by the bytes it announces:
+     - ASSEMBLE <path>          Assembles a file with the options of the server, like the command line assembler.
+                                A relative path is relative to the directory the server was started in.
+     - SOURCE <size> <name>     Assembles <size> bytes of source that follow the line (and a '\n'), without writing
+                                any file. The diagnostics refer to the source by <name>.
+     - RUN <argc>               Runs a command line of the assembler, given as <argc> arguments (including the name
+                                of the program), each as a line holding its length, followed by its bytes and a '\n'.
+                                The stdin, stdout and stderr of the client, and its directory, are passed along with
+                                the request line, so the command runs as if the client ran it.
+     - SHUTDOWN                 Stops the server.
+   The reply of ASSEMBLE and SOURCE is made of lines, a section announces its size and is followed by its bytes and a '\n':
+     status valid|invalid
+     diagnostics <size>         The errors of the source, in the format of the command line assembler.
+     output <path>              ASSEMBLE: an output file of a valid source ('.ob', '.ent', '.ext'), one line each.
+     object <size>              SOURCE: the sections of the output files of a valid source, the same as the files the
+     entries <size>                     command line assembler writes (a section whose file isn't written is left out).
+     externals <size>
+     end
+   RUN is replied with 'exit <status>' once the command is done, a malformed request with 'error <message>'.
+   Every connection is served by a process forked from the server, so requests are served side by side and a client
+   that stalls holds up nobody but itself (RUN changes the directory and the standard streams of that process freely).
+*/
+
+
+/*
+    Function: initConnection
+    Description: Starts reading a connection.
+    Parameters:
+        - connection: Pointer to the connection.
+        - socket: The socket of the connection.
+    Returns:
+        - void
+*/
+void initConnection(serverConnection *connection, int socket);
+
+
+/*
+    Function: closeConnection
+    Description: Closes a connection, along with the descriptors passed on it.
+    Parameters:
+        - connection: Pointer to the connection.
+    Returns:
+        - void
+*/
+void closeConnection(serverConnection *connection);
+
+
+/*
+    Function: receiveIntoConnection
+    Description: Receives more bytes of a connection into its buffer, with the descriptors passed along with them.
+    Parameters:
+        - connection: Pointer to the connection.
+    Returns:
+        - state: VALID if bytes were received, INVALID at the end of the connection, on an error or if the buffer is full.
+    Notes:
+        - The consumed bytes are dropped from the buffer first.
+        - Descriptors beyond the first ones passed on the connection are closed.
+*/
+state receiveIntoConnection(serverConnection *connection);
+
+
+/*
+    Function: readConnectionLine
+    Description: Reads the next line of a connection.
+    Parameters:
+        - connection: Pointer to the connection.
+    Returns:
+        - char*: The line, without its '\n' and terminated by '\0' in the buffer of the connection (it's valid until
+                 the connection is read again), NULL at the end of the connection or if the line is too long.
+*/
+char *readConnectionLine(serverConnection *connection);
+
+
+/*
+    Function: readConnectionSection
+    Description: Reads a section of a connection, the given number of bytes followed by a '\n'.
+    Parameters:
+        - connection: Pointer to the connection.
+        - size: The number of bytes of the section.
+    Returns:
+        - char*: The bytes of the section, terminated by '\0', NULL if the connection ends before the section does.
+    Notes:
+        - The caller is responsible for freeing the returned section.
+*/
+char *readConnectionSection(serverConnection *connection, unsigned long size);
+
+
+/*
+    Function: writeToSocket
+    Description: Writes bytes to a socket, until all of them are written.
+    Parameters:
+        - socket: The socket.
+        - bytes: The bytes to write.
+        - size: The number of bytes.
+    Returns:
+        - state: VALID if the bytes were written, INVALID if the other side is gone.
+*/
+state writeToSocket(int socket, const char *bytes, unsigned long size);
+
+
+/*
+    Function: sendSection
+    Description: Writes a section of a reply: its name and size on a line, its bytes and a '\n'.
+    Parameters:
+        - socket: The socket.
+        - name: The name of the section.
+        - bytes: The bytes of the section.
+        - size: The number of bytes.
+    Returns:
+        - void
+*/
+void sendSection(int socket, const char *name, const char *bytes, unsigned long size);
+
+
+/*
+    Function: sendOutputLocation
+    Description: Writes the 'output' line of an output file of an assembled file, if the file exists.
+    Parameters:
+        - socket: The socket.
+        - fileName: The name of the assembled file.
+        - extension: The extension of the output file.
+        - written: Whether the output file was written by the assembly.
+        - restored: Whether the outputs were restored from the cache (then an existing output file is reported).
+    Returns:
+        - void
+*/
+void sendOutputLocation(int socket, const char *fileName, char *extension, bool written, bool restored);
+
+
+/*
+    Function: serveAssembleRequest
+    Description: Serves an 'ASSEMBLE' request.
+    Parameters:
+        - connection: Pointer to the connection of the request.
+        - fileName: The name of the file to assemble.
+        - options: Pointer to the options of the server.
+    Returns:
+        - void
+    Notes:
+        - With a cache directory, the cache is trimmed to its size limit after every file stored in it.
+*/
+void serveAssembleRequest(serverConnection *connection, const char *fileName, const assemblerOptions *options);
+
+
+/*
+    Function: serveSourceRequest
+    Description: Serves a 'SOURCE' request.
+    Parameters:
+        - connection: Pointer to the connection of the request, positioned at the source.
+        - sourceName: The name the diagnostics refer to the source by.
+        - size: The number of bytes of the source.
+        - options: Pointer to the options of the server.
+    Returns:
+        - void
+*/
+void serveSourceRequest(serverConnection *connection, const char *sourceName, unsigned long size,
+        const assemblerOptions *options);
+
+
+/*
+    Function: serveRunRequest
+    Description: Serves a 'RUN' request.
+    Parameters:
+        - connection: Pointer to the connection of the request, positioned at the arguments.
+        - argc: The number of arguments.
+    Returns:
+        - void
+    Notes:
+        - Runs in the process of the connection, whose directory and standard streams become those of the client.
+        - Replies once the command is done.
+*/
+void serveRunRequest(serverConnection *connection, long argc);
+
+
+/*
+    Function: serveConnection
+    Description: Reads a request from a connection and serves it.
+    Parameters:
+        - connection: Pointer to the connection.
+        - options: Pointer to the options of the server.
+    Returns:
+        - bool: FALSE if the request stops the server, TRUE otherwise.
+*/
+bool serveConnection(serverConnection *connection, const assemblerOptions *options);
+
+
+/*
+    Function: serveForkedConnection
+    Description: Serves a connection in a process forked from the server for it.
+    Parameters:
+        - client: The socket of the connection.
+        - options: Pointer to the options of the server.
+        - stopSignal: The pipe the server is stopped through, written once a 'SHUTDOWN' request is served.
+    Returns:
+        - void
+    Notes:
+        - The connection is dropped if the client stalls for 'serverReceiveTimeout' seconds in the middle of a request.
+*/
+void serveForkedConnection(int client, const assemblerOptions *options, int stopSignal);
+
+
+/*
+    Function: defaultServerSocketPath
+    Description: Makes the name of the default socket of the user's server.
+    Parameters:
+        - None
+    Returns:
+        - char*: '$XDG_RUNTIME_DIR/assembler.sock', or '/tmp/assembler-<uid>/assembler.sock' when 'XDG_RUNTIME_DIR'
+                 isn't set.
+    Notes:
+        - The caller is responsible for freeing the returned name.
+*/
+char *defaultServerSocketPath(void);
+
+
+/*
+    Function: checkSocketDirectory
+    Description: Checks that the directory of a socket is private to the user, so nobody else can make or reach the socket.
+    Parameters:
+        - socketPath: The name of the socket.
+        - create: Whether to create the directory (for the user alone) if it doesn't exist.
+    Returns:
+        - state: VALID if the directory is a directory (not a link) owned by the user, that no other user can access,
+                 INVALID otherwise.
+    Notes:
+        - Prints an error for a directory that isn't private, a directory that doesn't exist isn't an error.
+*/
+state checkSocketDirectory(const char *socketPath, bool create);
+
+
+/*
+    Function: checkPeerUser
+    Description: Checks that the process on the other side of a connection runs as the user of this process.
+    Parameters:
+        - socket: The socket of the connection.
+    Returns:
+        - state: VALID if the peer runs as the same user, INVALID if it doesn't or its user can't be told.
+    Notes:
+        - Uses 'SO_PEERCRED' where the system has it, 'getpeereid' otherwise.
+*/
+state checkPeerUser(int socket);
+
+
+/*
+    Function: connectToServer
+    Description: Connects to the assembler server.
+    Parameters:
+        - socketPath: The name of the socket of the server.
+        - server: Pointer to store the socket of the connection.
+    Returns:
+        - state: VALID if connected, INVALID if no server serves the socket.
+*/
+state connectToServer(const char *socketPath, int *server);
+
+
+/*
+    Function: openServerSocket
+    Description: Creates the listening socket of the server.
+    Parameters:
+        - socketPath: The name of the socket.
+        - listener: Pointer to store the listening socket.
+    Returns:
+        - state: VALID if the server can listen on the socket, INVALID otherwise (the error is printed).
+    Notes:
+        - A socket left behind by a server that stopped is replaced, a socket another server serves is an error.
+        - The socket is created under a umask that leaves it to the user alone.
+*/
+state openServerSocket(const char *socketPath, int *listener);
+
+
+/*
+    Function: serveRequests
+    Description: Serves requests on a socket, until a 'SHUTDOWN' request.
+    Parameters:
+        - socketPath: The name of the socket, the default socket of the user if empty (see 'defaultServerSocketPath').
+        - options: Pointer to the options the server was started with.
+    Returns:
+        - state: INVALID if the server couldn't listen on the socket, VALID once it's stopped.
+    Notes:
+        - The cache directory is opened once, for all the requests. '--link' doesn't apply to the served requests.
+        - The directory of the default socket is created for the user alone if it doesn't exist.
+        - Every connection is served by a forked process (see 'serveForkedConnection'), a connection of another
+          user is refused.
+        - The socket is removed once the server stops.
+*/
+state serveRequests(const char *socketPath, const assemblerOptions *options);
+
+
+/*
+    Function: sendWithDescriptors
+    Description: Writes bytes to a socket, passing descriptors along with them.
+    Parameters:
+        - socket: The socket.
+        - bytes: The bytes to write (a short line, written at once).
+        - size: The number of bytes.
+        - descriptors: The descriptors to pass.
+        - numOfDescriptors: The number of descriptors (at most 'numOfPassedDescriptors').
+    Returns:
+        - state: VALID if the bytes and the descriptors were sent, INVALID otherwise.
+*/
+state sendWithDescriptors(int socket, const char *bytes, unsigned long size, const int *descriptors,
+        int numOfDescriptors);
+
+
+/*
+    Function: runOnServer
+    Description: Runs a command line of the assembler on the assembler server, as if it ran in this process.
+    Parameters:
+        - socketPath: The name of the socket of the server.
+        - argc: Number of command line arguments.
+        - argv: Array of command line argument strings.
+    Returns:
+        - int: The exit status of the command, -1 if the server couldn't be reached or runs as another user (nothing
+               was run).
+    Notes:
+        - The standard streams and the directory of this process are passed to the server, which writes the
+          diagnostics and the output files itself.
+*/
+int runOnServer(const char *socketPath, int argc, char *argv[]);
+
+
+#endif
@@ -0,0 +1,122 @@
+#ifndef UNTITLED_SIMULATOR_H
+#define UNTITLED_SIMULATOR_H
+
+#include <stdio.h>
+#include "structs.h"
+
+
+/*
+   This file contains the functions of the simulator, which runs assembled programs.
+   The code image is loaded at address 100 and the data image right after it (ICF), and every instruction is decoded
+   once, when the program is loaded, into a compact record (see 'simulatorOp'): the registers, the immediate value, and
+   the index of the target instruction of a jump. Running the program executes the records without looking at the
+   bits of the instructions again, and every record points at the code executing it (threaded dispatch).
+*/
+
+
+/*
+    Function: decodeOpKind
+    Description: Finds the operation of an encoded instruction.
+    Parameters:
+        - data: Pointer to the encoded instruction.
+    Returns:
+        - simulatorOpKind: The operation of the instruction, 'opIllegal' if its opcode/funct isn't defined.
+*/
+simulatorOpKind decodeOpKind(const codeType *data);
+
+
+/*
+    Function: instructionIndex
+    Description: Finds the index of the instruction at an address.
+    Parameters:
+        - machine: Pointer to the simulator.
+        - address: The address.
+    Returns:
+        - long: The index of the instruction in the code image, -1 if there's no instruction at the address.
+*/
+long instructionIndex(const simulator *machine, long address);
+
+
+/*
+    Function: predecodeInstruction
+    Description: Decodes the instruction held in memory at the given index of the code image into its record.
+    Parameters:
+        - machine: Pointer to the simulator.
+        - index: The index of the instruction.
+    Returns:
+        - void
+    Notes:
+        - A branch/'jmp'/'call' whose target isn't an instruction becomes 'opBadTarget', which faults once it's reached.
+        - Used when the program is loaded, and again when the program stores into its own code.
+*/
+void predecodeInstruction(simulator *machine, unsigned long index);
+
+
+/*
+    Function: loadSimulator
+    Description: Loads a program into the memory of the simulator and predecodes its instructions.
+    Parameters:
+        - machine: Pointer to a zero initialized simulator.
+        - codeImage: Pointer to the code image of the program.
+        - dataImage: Pointer to the data image of the program.
+    Returns:
+        - state: VALID if the program was loaded, INVALID if it doesn't fit in the memory of the machine.
+    Notes:
+        - The registers are zero, and the run isn't limited until 'maxSteps' is changed.
+*/
+state loadSimulator(simulator *machine, const codeImageTable *codeImage, const dataImageTable *dataImage);
+
+
+/*
+    Function: loadObjectImage
+    Description: Loads the program of an object file into the simulator.
+    Parameters:
+        - machine: Pointer to a zero initialized simulator.
+        - fileName: The name of the object file.
+        - errors: The stream to print errors to.
+    Returns:
+        - state: VALID if the program was loaded, INVALID otherwise (an error is printed).
+*/
+state loadObjectImage(simulator *machine, const char *fileName, FILE *errors);
+
+
+/*
+    Function: runSimulator
+    Description: Runs the loaded program from its current state until it stops.
+    Parameters:
+        - machine: Pointer to the simulator.
+    Returns:
+        - state: VALID if the program reached 'stop', INVALID if it faulted or ran 'maxSteps' instructions ('fault' is set).
+    Notes:
+        - The registers are 32-bit, 'blt'/'bgt' compare them as signed values.
+        - 'mvhi'/'mvlo' move the upper/lower 16 bits of 'rs' to the lower 16 bits of 'rd'.
+        - 'lb'/'lh' sign extend the loaded value, the memory is little endian, like the object file.
+        - 'call' stores the address of the next instruction in '$0', 'la' stores the address in '$0'.
+*/
+state runSimulator(simulator *machine);
+
+
+/*
+    Function: printRegisters
+    Description: Prints the registers of the simulator.
+    Parameters:
+        - machine: Pointer to the simulator.
+        - out: The stream to print to.
+    Returns:
+        - void
+*/
+void printRegisters(const simulator *machine, FILE *out);
+
+
+/*
+    Function: freeSimulator
+    Description: Releases the memory and the program of the simulator.
+    Parameters:
+        - machine: Pointer to the simulator.
+    Returns:
+        - void
+*/
+void freeSimulator(simulator *machine);
+
+
+#endif
@@ -0,0 +1,140 @@
+#ifndef UNTITLED_STATISTICS_H
+#define UNTITLED_STATISTICS_H
+
+#include <stdio.h>
+#include "structs.h"
+
+
+/*
+   This file contains the functions responsible for the statistics of the assembled files ('--stats', '--stats-json'):
+   the wall time of each phase, the sizes of the tables the file produced and the allocations it made.
+   The statistics of each file are printed to stdout by the order of the files, as a few lines of text,
+   or as a single line holding a JSON object (one object per file), for tools that collect them.
+*/
+
+
+/*
+    Function: secondsNow
+    Description: Reads the monotonic clock.
+    Parameters: None
+    Returns:
+        - double: The current time in seconds, from an arbitrary starting point.
+*/
+double secondsNow(void);
+
+
+/*
+    Function: phaseStart
+    Description: Starts timing a phase of the assembly of a file.
+    Parameters:
+        - context: Pointer to the assembly context of the file.
+    Returns:
+        - double: The starting time of the phase, 0 if the phases of the file aren't timed.
+*/
+double phaseStart(const assemblyContext *context);
+
+
+/*
+    Function: phaseEnd
+    Description: Adds the time passed since the start of a phase to the statistics of the file.
+    Parameters:
+        - context: Pointer to the assembly context of the file.
+        - phase: The timed phase.
+        - start: The value returned by 'phaseStart'.
+    Returns:
+        - void
+    Notes:
+        - Does nothing if the phases of the file aren't timed (the context has no statistics).
+*/
+void phaseEnd(const assemblyContext *context, assemblyPhase phase, double start);
+
+
+/*
+    Function: countAssembly
+    Description: Copies the number of symbols, code words, data bytes, fixups and attributes of a file into statistics.
+    Parameters:
+        - context: Pointer to the assembly context of the file.
+        - statistics: Pointer to the statistics to be filled.
+    Returns:
+        - void
+*/
+void countAssembly(const assemblyContext *context, assemblyStatistics *statistics);
+
+
+/*
+    Function: collectStatistics
+    Description: Copies the sizes of the tables and the allocation counters of a file into its statistics.
+    Parameters:
+        - context: Pointer to the assembly context of the file, before it's released.
+        - statistics: Pointer to the statistics of the file, whose outcome is already set.
+    Returns:
+        - void
+    Notes:
+        - On a cache hit only the lines of the restored source are counted - the other counts are the ones of the
+          assembly the cache entry came from (see 'restoreFromCache'), and the file has no arena and no tables.
+*/
+void collectStatistics(const assemblyContext *context, assemblyStatistics *statistics);
+
+
+/*
+    Function: printJsonString
+    Description: Prints a string as a JSON string (quoted, with the quotes, backslashes and control characters escaped).
+    Parameters:
+        - string: The string to print.
+        - out: The stream to print to.
+    Returns:
+        - void
+*/
+void printJsonString(const char *string, FILE *out);
+
+
+/*
+    Function: printStatistics
+    Description: Prints the statistics of a file.
+    Parameters:
+        - fileName: The name of the file.
+        - statistics: Pointer to the statistics of the file.
+        - format: The format of the statistics (text or JSON).
+        - out: The stream to print to.
+    Returns:
+        - void
+    Notes:
+        - The throughput is the number of lines divided by the total wall time of the file.
+        - In JSON a phase the file didn't reach is null, the times are in seconds.
+*/
+void printStatistics(const char *fileName, const assemblyStatistics *statistics, statisticsFormat format, FILE *out);
+
+
+/*
+    Function: compareFileTimings
+    Description: Compares the times of two files, for 'qsort'.
+    Parameters:
+        - first: Pointer to the time of the first file (fileTiming *).
+        - second: Pointer to the time of the second file (fileTiming *).
+    Returns:
+        - int: Negative if the first file took longer, positive if the second one did (the larger file, then the name
+               decide between equal times).
+*/
+int compareFileTimings(const void *first, const void *second);
+
+
+/*
+    Function: printTimingSummary
+    Description: Prints the summary of the times of all the assembled files ('--timings').
+    Parameters:
+        - timings: The times of the files, sorted in place from the slowest file.
+        - numOfFiles: The number of files.
+        - numOfWorkers: The number of workers the files were assembled by.
+        - wallSeconds: The wall time of the whole run.
+        - out: The stream to print to.
+    Returns:
+        - void
+    Notes:
+        - The first line holds the totals: the wall time, the time of all the files together and the share of the
+          workers' time spent on files, a low share means that the workers waited (e.g. a large file was left to the end).
+        - Every file then gets a line, with its time, its size and the worker that assembled it.
+*/
+void printTimingSummary(fileTiming *timings, int numOfFiles, int numOfWorkers, double wallSeconds, FILE *out);
+
+
+#endif
@@ -45,13 +45,13 @@ state checkForComma(newLine *line, int *index, int numOfVariables);
         - maxVal: Maximum allowed value for the integer.
         - minVal: Minimum allowed value for the integer.
     Returns:
-        - void
+        - The extracted integer. int variable.
     Notes:
         - This function extracts an integer from the line's content at the specified index.
         - It validates whether the extracted integer falls within the specified range.
         - If the integer is valid, it increments the count of encountered variables.
 */
-void checkInteger(newLine* line, int* contentIndex, int* numOfVariables, int maxNumLength, int maxVal, int minVal);
+int checkInteger(newLine* line, int* contentIndex, int* numOfVariables, int maxNumLength, int maxVal, int minVal);
 
 
 /*
@@ -62,13 +62,13 @@ void checkInteger(newLine* line, int* contentIndex, int* numOfVariables, int max
         - contentIndex: Pointer to the index in the line's content.
         - numOfScannedOperands: Pointer to the count of scanned operands.
     Returns:
-        - void
+        - The extracted register number. int variable (0 if the register isn't valid).
     Notes:
         - This function checks for the presence of a register in the line's content at the specified index.
         - It verifies if the register starts with '$' and represents a valid register number (0-31).
         - If a valid register is found, it increments the count of scanned operands.
 */
-void checkRegister(newLine *line, int *contentIndex, int *numOfScannedOperands);
+int checkRegister(newLine *line, int *contentIndex, int *numOfScannedOperands);
 
 
 /*
@@ -89,54 +89,6 @@ void checkRegister(newLine *line, int *contentIndex, int *numOfScannedOperands);
 void checkOperandsAmount(newLine* line, unsigned int opcode, int numOfScannedOperands, bool endOfScan);
 
 
-/*
-    Function: getRegister
-    Description: Extracts the register number from the content at the specified index.
-    Parameters:
-        - content: Pointer to the string containing the content to extract the register from.
-        - index: Pointer to the current index position within the content.
-    Returns:
-        - The extracted register number. int variable.
-    Notes:
-        - This function searches for and extracts the register number from the given content.
-        - It navigates the content based on the index, identifying the register number.
-        - Returns the extracted register number found in the content at the specified index.
-*/
-int getRegister(const char *content, int *index);
-
-
-/*
-    Function: get2BytesInt
-    Description: Extracts a 2-byte integer from the content at the specified index.
-    Parameters:
-        - content: Pointer to the string containing the content to extract the integer from.
-        - index: Pointer to the current index position within the content.
-    Returns:
-        - An integer representing the extracted 2-byte integer.
-    Notes:
-        - This function scans the content at the provided index to extract a 2-byte integer.
-        - It navigates the content based on the index and retrieves the integer value.
-        - Returns the extracted 2-byte integer found in the content at the specified index.
-*/
-int get2BytesInt(const char *content, int *index);
-
-
-/*
-    Function: isRegister
-    Description: Checks whether the given content from the given position contains a valid register.
-    Parameters:
-        - content: Pointer to the string containing the content to check.
-        - index: Index position within the content to start checking.
-    Returns:
-        - If a valid register been has found. bool variable: TRUE / FALSE.
-    Notes:
-        - This function scans the content starting from the provided index, searching for a valid register.
-        - It checks for the presence of a valid register pattern ('$' followed by a number) at the given index.
-        - Returns TRUE if a valid register pattern is found; otherwise, returns FALSE.
-*/
-bool isRegister(const char *content, int index);
-
-
 /*
     Function: getFileFullName
     Description: Concatenates the provided file name and file extension to a new string and returns pointer to it.
@@ -151,7 +103,7 @@ bool isRegister(const char *content, int index);
         - Concatenates the given file extension to the extracted filename to create the full file name.
         - Returns the newly created full file name string.
 */
-char* getFileFullName(char *fileName, char *fileExtension);
+char* getFileFullName(const char *fileName, char *fileExtension);
 
 
 /*
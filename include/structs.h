@@ -2,6 +2,7 @@
 #ifndef UNTITLED_STRUCTS_H
 #define UNTITLED_STRUCTS_H
 
+#include <stdio.h>
 #include "globals.h"
 
 /*
@@ -53,6 +54,50 @@ typedef struct instructionWord {
 } instructionWord;
 
 
+/*
+   Enum: operandKind
+   Description: Represents the kinds of instruction operands (register, immediate integer, label).
+*/
+typedef enum operandKind {registerOperand, immediateOperand, labelOperand} operandKind;
+
+
+/*
+   Structure: instructionOperand
+   Description: Represents an operand of an instruction, as scanned by the first pass.
+   Fields:
+     - kind: The kind of the operand (register, immediate or label).
+     - value: The register number or the immediate value (0 for a label, its address is resolved by a fixup).
+     - start: The index of the operand in the content of the line.
+     - length: The number of characters of the operand in the content of the line.
+*/
+typedef struct instructionOperand {
+    operandKind kind;
+    long value;
+    int start;
+    int length;
+} instructionOperand;
+
+
+/*
+   Structure: instructionLine
+   Description: Represents an instruction line once it's scanned - the intermediate form the encoding and the fixups are made of.
+   Fields:
+     - word: The instruction (opcode, funct and type).
+     - operands: The operands of the instruction, by their order in the line.
+     - numOfOperands: The number of operands scanned in the line.
+     - symbol: The name of the label operand, empty if the instruction has no label operand.
+   Notes:
+     - The line is scanned exactly once, the encoding and the fixups don't go back to its text.
+     - 'numOfOperands' may exceed 'maxInstructionOperands' on an invalid line, only the first operands are kept.
+*/
+typedef struct instructionLine {
+    instructionWord word;
+    instructionOperand operands[maxInstructionOperands];
+    int numOfOperands;
+    char symbol[labelBufferLength];
+} instructionLine;
+
+
 /*
    Structure: directiveWord
    Description: Represents the definition of a directive word.
@@ -68,6 +113,28 @@ typedef struct directiveWord {
 } directiveWord;
 
 
+/*
+   Enum: reservedWordType
+   Description: Represents the kinds of reserved words (instruction names and directive names).
+*/
+typedef enum reservedWordType {reservedInstruction, reservedDirective} reservedWordType;
+
+
+/*
+   Structure: reservedWord
+   Description: Represents a slot in the perfect hash table of the reserved words.
+   Fields:
+     - name: The reserved word, NULL if the slot is empty.
+     - type: Whether the word is an instruction name or a directive name.
+     - index: The index of the word in the table returned by 'getReservedInstructions'/'getReservedDirectives'.
+*/
+typedef struct reservedWord {
+    const char *name;
+    reservedWordType type;
+    int index;
+} reservedWord;
+
+
 /*
    Structure: typeRInstruction
    Description: Represents the binary structure of an R-type instructionWord.
@@ -173,8 +240,80 @@ typedef struct symbolTableEntry
     struct symbolTableEntry *next;
 } symbolTableEntry;
 
-/* Pointer to a structure representing an entry in the code image table */
-typedef struct codeImageEntry *codeTable;
+
+/*
+   Struct: arenaBlock
+   Description: Represents a block of memory owned by an arena, the allocations are carved from it one after the other.
+   Fields:
+     - next: Pointer to the block that was allocated before this one.
+     - size: The number of bytes in the block (not including this header).
+     - used: The number of bytes already handed out from the block.
+   Notes:
+     - The memory of the block starts right after this header, aligned to 'arenaAlignment'.
+*/
+typedef struct arenaBlock
+{
+    struct arenaBlock *next;
+    unsigned long size;
+    unsigned long used;
+} arenaBlock;
+
+
+/*
+   Union: arenaAlignment
+   Description: Represents the strictest alignment required by the structures allocated from an arena.
+*/
+typedef union arenaAlignment
+{
+    long longValue;
+    double doubleValue;
+    void *pointerValue;
+} arenaAlignment;
+
+
+/*
+   Struct: arena
+   Description: Represents a bump allocator - memory is handed out from large blocks and released all at once.
+   Fields:
+     - blocks: Pointer to the most recently allocated block, the rest of the blocks are linked from it.
+     - allocations: The number of allocations served by the arena.
+     - blockCount: The number of blocks allocated by the arena (each one is a single call to the system allocator).
+     - bytes: The number of bytes handed out by the arena.
+   Notes:
+     - A zero initialized structure represents an empty arena.
+     - The allocated memory is zero initialized, like the memory returned by 'callocWithCheck'.
+*/
+typedef struct arena
+{
+    arenaBlock *blocks;
+    unsigned long allocations;
+    unsigned long blockCount;
+    unsigned long bytes;
+} arena;
+
+
+/*
+   Struct: symbolHashTable
+   Description: Represents the symbol table,
+                keeps the symbols in a linked list (by order of insertion) and indexes them by name,
+                using an open-addressing hash table.
+   Fields:
+     - head: Pointer to the first symbol in the list.
+     - tail: Pointer to the last symbol in the list, allows appending without traversing the list.
+     - slots: Array of pointers to the symbols, an empty slot is represented by NULL.
+     - capacity: The number of slots in the hash table (always a power of 2).
+     - count: The number of symbols stored in the table.
+   Notes:
+     - A zero initialized structure represents an empty symbol table.
+*/
+typedef struct symbolHashTable
+{
+    symbolTable head;
+    symbolTable tail;
+    symbolTable *slots;
+    unsigned long capacity;
+    unsigned long count;
+} symbolHashTable;
 
 /*
    Struct: codeImageEntry
@@ -184,43 +323,216 @@ typedef struct codeImageEntry *codeTable;
      - lineNumber: The line number in the source code where the instruction is located.
      - address: The memory address where the instruction is stored.
      - type: The type of instruction: R, I, or J.
-     - data: Pointer to the machine code representation of the instruction (32-bit).
-     - next: Pointer to the next entry in the code image.
+     - data: The machine code representation of the instruction (32-bit).
 */
 typedef struct codeImageEntry {
     long lineNumber;
     int address;
     instructionType type;
-    codeType *data;
-    struct codeImageEntry *next;
+    codeType data;
 } codeImageEntry;
 
 
-/* Pointer to a structure representing an entry in the data image table */
-typedef struct dataImageEntry *dataTable;
+/*
+   Struct: codeImageTable
+   Description: Represents the code image - a growable array of code image entries, ordered by address.
+   Fields:
+     - entries: Pointer to the contiguous array of the code image entries.
+     - count: The number of entries in the code image.
+     - capacity: The number of entries the array can hold before it has to grow.
+   Notes:
+     - A zero initialized structure represents an empty code image.
+     - The entry of the instruction at address 'a' is located at index (a - ICInitialValue) / 4.
+*/
+typedef struct codeImageTable {
+    codeImageEntry *entries;
+    unsigned long count;
+    unsigned long capacity;
+} codeImageTable;
+
+
+/*
+   Struct: dataImageTable
+   Description: Represents the data image - a growable buffer of bytes,
+                maintains the encoding of data extracted from the source file (command lines of type: .db/.dh/.dw/.asciz).
+   Fields:
+     - bytes: Pointer to the buffer, variables are stored in it in little-endian order.
+     - size: The number of bytes stored in the buffer (equals to the Data Counter).
+     - capacity: The number of bytes the buffer can hold before it has to grow.
+   Notes:
+     - A zero initialized structure represents an empty data image.
+     - The byte at offset 'o' is located at address ICF + o, once the first pass is over.
+*/
+typedef struct dataImageTable
+{
+    unsigned char *bytes;
+    unsigned long size;
+    unsigned long capacity;
+} dataImageTable;
+
+
+/*
+   Struct: fixupEntry
+   Description: Represents an instruction whose label operand is resolved only after the first pass,
+                once the addresses of all the labels are known.
+   Fields:
+     - codeIndex: The index of the instruction in the code image.
+     - type: The type of the instruction, determines the field to be completed: I ('immed') or J ('address').
+     - symbol: The name of the label operand.
+     - lineNumber: The line number in the source code where the instruction is located.
+*/
+typedef struct fixupEntry
+{
+    unsigned long codeIndex;
+    instructionType type;
+    char *symbol;
+    long lineNumber;
+} fixupEntry;
+
+
+/*
+   Struct: fixupTable
+   Description: Represents the list of the fixups recorded in the first pass - a growable array ordered by line number.
+   Fields:
+     - entries: Pointer to the contiguous array of the fixup entries.
+     - count: The number of entries in the table.
+     - capacity: The number of entries the array can hold before it has to grow.
+   Notes:
+     - A zero initialized structure represents an empty fixup table.
+*/
+typedef struct fixupTable
+{
+    fixupEntry *entries;
+    unsigned long count;
+    unsigned long capacity;
+} fixupTable;
+
 
 /*
-   Struct: dataImageEntry
-   Description: Represents an entry in the data image table,
-                maintains the encoding of data extracted from the source file (command lines of type: .db/.dw/.dh).
-     - address: The address where the data is stored.
-     - dataType: The directive type associated with the data (DB, DH, DW, ASCIZ, ENTRY, EXTERN, NONE).
-     - variableSize: The size of a single data variable in bytes.
-     - numOfVariables: The number of variables stored in the data entry.
-     - data: Pointer to the stored data.
-     - dataSize: The size of the current data in bytes.
-     - next: Pointer to the next entry in the data image.
+   Struct: externalReference
+   Description: Represents an instruction that refers to an external label, found while the fixups are resolved in parallel.
+   Fields:
+     - name: The name of the external label (owned by the symbol table).
+     - address: The address of the instruction.
 */
-typedef struct dataImageEntry
+typedef struct externalReference
 {
+    char *name;
     long address;
-    directiveType dataType;
-	int variableSize;
-    unsigned int numOfVariables;
-    void *data;
-    int dataSize;
-    struct dataImageEntry *next;
-} dataImageEntry;
+} externalReference;
+
+
+/*
+   Struct: fixupError
+   Description: Represents a fixup that couldn't be resolved, found while the fixups are resolved in parallel.
+   Fields:
+     - fixupIndex: The index of the fixup in the fixup table.
+     - error: The error of the line of the fixup.
+*/
+typedef struct fixupError
+{
+    unsigned long fixupIndex;
+    char *error;
+} fixupError;
+
+
+/*
+   Struct: resolvedFixups
+   Description: Represents the outcome of resolving all the fixups of a file ahead of the second pass.
+   Fields:
+     - errors: The fixups that couldn't be resolved, ordered by their index.
+     - count: The number of errors.
+     - next: The index of the next error to be reported by the second pass.
+   Notes:
+     - The second pass reports the errors along with the '.entry' directives, by the order of the lines.
+*/
+typedef struct resolvedFixups
+{
+    fixupError *errors;
+    unsigned long count;
+    unsigned long next;
+} resolvedFixups;
+
+
+/*
+   Struct: relaxedBranch
+   Description: Represents a conditional branch ('bne'/'beq'/'blt'/'bgt') whose distance may not fit its 'immed' field.
+   Fields:
+     - fixupIndex: The index of the fixup of the branch.
+     - codeIndex: The index of the branch in the code image.
+     - targetIndex: The index of the instruction the label refers to, -1 if the label is in the data image.
+     - dataOffset: The address of the label in the data image (before ICF is added), if it's a data label.
+     - isLong: Whether the branch was relaxed - replaced by an inverted branch over a 'jmp' to the label.
+*/
+typedef struct relaxedBranch
+{
+    unsigned long fixupIndex;
+    unsigned long codeIndex;
+    long targetIndex;
+    long dataOffset;
+    bool isLong;
+} relaxedBranch;
+
+
+/*
+   Struct: branchRelaxation
+   Description: Represents the state of the relaxation of the branches of a file.
+   Fields:
+     - branches: The conditional branches, by the order of the code.
+     - count: The number of branches.
+     - growth: A Fenwick tree of the bytes added to every instruction, for the address of an instruction in log time.
+     - extraWords: The number of words added to every instruction (0 for an instruction that isn't relaxed).
+     - numOfWords: The number of instructions in the code image of the first pass.
+     - totalGrowth: The number of bytes added to the code image.
+     - worklist: The indexes (in the code image) of the relaxed branches whose neighbours weren't checked yet.
+     - pending: The number of indexes in the worklist.
+   Notes:
+     - Relaxing a branch only moves the instructions after it, so only the branches that span it may need relaxing,
+       and a branch that still fits spans at most 'relaxationWindow' instructions.
+*/
+typedef struct branchRelaxation
+{
+    relaxedBranch *branches;
+    unsigned long count;
+    long *growth;
+    unsigned char *extraWords;
+    unsigned long numOfWords;
+    long totalGrowth;
+    unsigned long *worklist;
+    unsigned long pending;
+} branchRelaxation;
+
+
+/*
+   Struct: deferredEntry
+   Description: Represents an '.entry' directive, recorded in the first pass and applied once the symbol table is complete.
+   Fields:
+     - name: The name of the label to be marked as entry.
+     - lineNumber: The line number in the source code where the directive is located.
+*/
+typedef struct deferredEntry
+{
+    char *name;
+    long lineNumber;
+} deferredEntry;
+
+
+/*
+   Struct: deferredEntryTable
+   Description: Represents the list of the '.entry' directives - a growable array ordered by line number.
+   Fields:
+     - entries: Pointer to the contiguous array of the deferred entries.
+     - count: The number of entries in the table.
+     - capacity: The number of entries the array can hold before it has to grow.
+   Notes:
+     - A zero initialized structure represents an empty table.
+*/
+typedef struct deferredEntryTable
+{
+    deferredEntry *entries;
+    unsigned long count;
+    unsigned long capacity;
+} deferredEntryTable;
 
 
 /* Pointer to a structure representing an entry in the attributes table */
@@ -243,13 +555,310 @@ typedef struct attributesTableEntry
     struct attributesTableEntry *next;
 } attributesTableEntry;
 
+/*
+   Struct: sourceBuffer
+   Description: Represents the entire content of an input file, read once into a single buffer.
+   Fields:
+     - content: Pointer to the content of the file, every line in it (including the last one) ends with '\n'.
+     - size: The number of characters in the buffer (not including the terminating '\0').
+     - position: The offset of the next line to be handed out.
+   Notes:
+     - A zero initialized structure represents an empty source.
+     - The lines are handed out as views into the buffer, they're never copied.
+*/
+typedef struct sourceBuffer
+{
+    char *content;
+    unsigned long size;
+    unsigned long position;
+} sourceBuffer;
+
+
+/*
+    Enum: statisticsFormat
+    Description: Represents how the statistics of the assembled files are reported ('--stats', '--stats-json'), if at all.
+*/
+typedef enum statisticsFormat {noStatistics, textStatistics, jsonStatistics} statisticsFormat;
+
+
+/*
+   Struct: assemblerOptions
+   Description: Represents the options received from the command line, shared by the assembly of all the files.
+   Fields:
+     - maxLineLength: The maximum length of a source line (not including '\n'), a longer line is reported.
+                      0 means that the length of the lines isn't limited.
+     - jobs: The number of files assembled concurrently (1 means the files are assembled one after the other).
+     - firstPassThreads: The number of threads the first pass of a large file is split between (1 means it isn't split).
+     - fixupThreads: The number of threads the fixups of a large file are resolved on (1 means they're resolved in
+                     the second pass, one line at a time).
+     - firstPassChunkSize: The minimum number of bytes of a chunk of the split first pass ('--first-pass-chunk').
+     - fixupChunkSize: The minimum number of fixups resolved by a thread ('--fixup-chunk').
+     - pipelined: Whether each file is read, parsed and written by a pipeline of threads ('--pipeline', see pipeline.h).
+     - cacheDirectory: The directory of the assembly cache, NULL if the cache isn't used.
+     - cacheSizeLimit: The maximum size of the assembly cache, in megabytes.
+     - cacheStats: Whether the hits and misses of the assembly cache are reported.
+     - linkedFileName: The object file the input files are linked into (whole-program mode), NULL if every file
+                       gets its own output files.
+     - statistics: How the statistics of each file are reported to stdout (see 'statisticsFormat').
+     - timingSummary: Whether the time of every file is summarized to stdout once all the files are done ('--timings').
+     - serverSocket: The socket the assembler serves requests on ('--serve', see server.h), empty for the default
+                     socket of the user, NULL if it assembles the files of its command line.
+*/
+typedef struct assemblerOptions
+{
+    long maxLineLength;
+    long jobs;
+    long firstPassThreads;
+    long fixupThreads;
+    long firstPassChunkSize;
+    long fixupChunkSize;
+    bool pipelined;
+    const char *cacheDirectory;
+    long cacheSizeLimit;
+    bool cacheStats;
+    const char *linkedFileName;
+    statisticsFormat statistics;
+    bool timingSummary;
+    const char *serverSocket;
+} assemblerOptions;
+
+
+/*
+   Struct: inputFileList
+   Description: Represents the names of the input files, from the command line and from the list files it names.
+   Fields:
+     - names: The names of the input files, by the order they were given in.
+     - count: The number of names.
+     - capacity: The number of names the array can hold before it has to grow.
+     - lists: The contents of the list files ('@FILE', '--files-from FILE'), the names read from them point into these.
+     - numOfLists: The number of list files read.
+   Notes:
+     - A zero initialized structure represents an empty list.
+*/
+typedef struct inputFileList
+{
+    char **names;
+    int count;
+    int capacity;
+    sourceBuffer *lists;
+    int numOfLists;
+} inputFileList;
+
+
+/*
+    Enum: cacheOutcome
+    Description: Represents how the outputs of a file were obtained (without the cache, from the cache, or assembled and cached).
+*/
+typedef enum cacheOutcome {cacheUnused, cacheHit, cacheMiss} cacheOutcome;
+
+
+/*
+    Enum: assemblyPhase
+    Description: Represents the timed phases of the assembly of a file, 'numOfAssemblyPhases' is their number.
+*/
+typedef enum assemblyPhase
+{
+    readPhase, firstPassPhase, relaxationPhase, updateValuesPhase, secondPassPhase, objectFilePhase, attributesFilesPhase,
+    numOfAssemblyPhases
+} assemblyPhase;
+
+
+/*
+   Struct: assemblyStatistics
+   Description: Represents the statistics of the assembly of a single file ('--stats').
+   Fields:
+     - seconds: The wall time of each phase (see 'assemblyPhase'), 0 for a phase the file didn't reach.
+     - totalSeconds: The wall time of the whole file, including the cache and the release of the context.
+     - isValid: Whether the file was assembled without errors.
+     - outcome: How the outputs of the file were obtained (see 'cacheOutcome').
+     - lines: The number of lines of the file (counted by the first pass, or in the source restored from the cache).
+     - symbols: The number of symbols in the symbol table.
+     - codeWords: The number of instructions in the code image.
+     - dataBytes: The number of bytes in the data image.
+     - fixups: The number of label operands recorded in the first pass.
+     - attributes: The number of entry and external labels exported to the '.ent'/'.ext' files.
+     - arenaAllocations: The number of allocations served by the arena of the file.
+     - arenaBytes: The number of bytes handed out by the arena.
+     - arenaBlocks: The number of blocks the arena allocated from the system.
+     - tableBytes: The number of bytes held by the growable arrays of the file (the source, the images and the tables).
+   Notes:
+     - A zero initialized structure represents a file that wasn't assembled yet.
+     - The phases are timed only when the context of the file points at its statistics.
+     - On a cache hit, the counts are the ones of the assembly the cache entry came from, and the arena and table
+       fields are left 0 (printed as n/a) since the file wasn't assembled.
+*/
+typedef struct assemblyStatistics
+{
+    double seconds[numOfAssemblyPhases];
+    double totalSeconds;
+    bool isValid;
+    cacheOutcome outcome;
+    long lines;
+    unsigned long symbols;
+    unsigned long codeWords;
+    unsigned long dataBytes;
+    unsigned long fixups;
+    unsigned long attributes;
+    unsigned long arenaAllocations;
+    unsigned long arenaBytes;
+    unsigned long arenaBlocks;
+    unsigned long tableBytes;
+} assemblyStatistics;
+
+
+/*
+   Struct: fileTiming
+   Description: Represents the time an input file took to assemble, for the summary printed at the end ('--timings').
+   Fields:
+     - fileName: The name of the file.
+     - size: The size of the file in bytes (0 if it can't be read).
+     - seconds: The wall time of the file, from reading it to releasing its context.
+     - worker: The number of the worker thread the file was assembled by (0 when the files are assembled one after
+               the other).
+*/
+typedef struct fileTiming
+{
+    const char *fileName;
+    unsigned long size;
+    double seconds;
+    int worker;
+} fileTiming;
+
+
+/*
+   Struct: cacheStatistics
+   Description: Represents the counters of the assembly cache over a run of the assembler.
+   Fields:
+     - hits: The number of files whose outputs were restored from the cache.
+     - misses: The number of files that were assembled since they weren't in the cache.
+     - evictions: The number of least recently used entries removed to keep the cache within its size limit.
+     - entries: The number of entries left in the cache.
+     - size: The size of the entries left in the cache, in bytes.
+*/
+typedef struct cacheStatistics
+{
+    long hits;
+    long misses;
+    long evictions;
+    long entries;
+    unsigned long size;
+} cacheStatistics;
+
+
+/*
+   Struct: serverConnection
+   Description: Represents a connection to the assembler server, from which a request is read.
+   Fields:
+     - socket: The socket of the connection.
+     - buffer: The bytes received and not consumed yet, a line of the request is terminated in place.
+     - used: The number of bytes received into the buffer.
+     - position: The offset of the first byte not consumed yet.
+     - passed: The descriptors passed along with the request (see 'numOfPassedDescriptors').
+     - numOfPassed: The number of passed descriptors.
+   Notes:
+     - The descriptors may only be passed along with the first bytes of the request.
+*/
+typedef struct serverConnection
+{
+    int socket;
+    char buffer[serverLineLength + 1];
+    unsigned long used;
+    unsigned long position;
+    int passed[numOfPassedDescriptors];
+    int numOfPassed;
+} serverConnection;
+
+
+/*
+   Struct: cacheEntryInfo
+   Description: Represents an entry found in the cache directory, while the cache is trimmed.
+   Fields:
+     - name: The name of the entry (the key of its source).
+     - lastUse: The time the entry was last stored or restored (its modification time).
+     - size: The size of the entry, in bytes.
+*/
+typedef struct cacheEntryInfo
+{
+    char name[cacheKeyLength + 1];
+    long lastUse;
+    unsigned long size;
+} cacheEntryInfo;
+
+
+/*
+   Struct: outputWriter
+   Description: Represents a buffered writer of an output file, the text is formatted into a large buffer
+                and written to the file in big blocks.
+   Fields:
+     - fd: The file the text is written to.
+     - used: The number of bytes collected in the buffer.
+     - buffer: The bytes not written to the file yet.
+   Notes:
+     - The buffer is part of the structure, a single allocation holds the whole writer.
+*/
+typedef struct outputWriter
+{
+    FILE *fd;
+    unsigned long used;
+    char buffer[outputBufferSize];
+} outputWriter;
+
+
+/*
+   Struct: assemblyContext
+   Description: Represents everything the assembly of a single input file produces, from the first pass to the output files.
+   Fields:
+     - options: Pointer to the options of the assembler.
+     - errors: The stream the diagnostics of the file are printed to (stderr, or a buffer when files run in parallel).
+     - diagnostics: The diagnostics of the file, when it's assembled from memory by 'assembleSource' ('\0' terminated).
+     - diagnosticsSize: The number of characters in 'diagnostics'.
+     - reportedLines: The number of lines reported to 'errors' (a valid file may still have too long lines reported).
+     - statistics: The statistics the phases of the file are timed into ('--stats'), NULL if they aren't timed.
+     - source: The content of the input file.
+     - memory: The arena from which the symbols, attributes and recorded names of the file are allocated.
+     - symbolTab: The symbol table of the file.
+     - codeImage: The code image of the file.
+     - dataImage: The data image of the file.
+     - fixups: The label operands recorded in the first pass, resolved in the second pass.
+     - entries: The '.entry' directives recorded in the first pass, applied in the second pass.
+     - attributesTab: The entry and external labels to be exported to the '.ent'/'.ext' files.
+     - attributesTail: The last entry of 'attributesTab', new entries are appended after it.
+     - ICF: The final value of the Instruction Counter.
+     - DCF: The final value of the Data Counter.
+   Notes:
+     - A zero initialized structure (with 'options' and 'errors' set) represents the context of a file that wasn't processed yet.
+     - Everything the context owns is released at once by 'freeAssemblyContext', whether the file is valid or not.
+*/
+typedef struct assemblyContext
+{
+    const assemblerOptions *options;
+    FILE *errors;
+    char *diagnostics;
+    size_t diagnosticsSize;
+    long reportedLines;
+    assemblyStatistics *statistics;
+    sourceBuffer source;
+    arena memory;
+    symbolHashTable symbolTab;
+    codeImageTable codeImage;
+    dataImageTable dataImage;
+    fixupTable fixups;
+    deferredEntryTable entries;
+    attributesTable attributesTab;
+    attributesTable attributesTail;
+    long ICF;
+    long DCF;
+} assemblyContext;
+
+
 /*
    Struct: newLine
    Description: Represents a line read from the source file during the assembly process.
    Fields:
      - number: Line number in the source file.
      - sourceFileName: Name of the file from which the line was extracted.
-     - content: Content of the line read from the source file.
+     - content: Pointer to the beginning of the line in the source buffer, the line ends with '\n'.
+     - length: The number of characters in the line (not including '\n').
      - error: Indicates any encountered error during processing of the line.
    Notes:
      - Encapsulates the details of a line read from the source file during assembly.
@@ -260,8 +869,210 @@ typedef struct line
     long number;
     const char *sourceFileName;
     const char *content;
+    unsigned long length;
     char *error;
 } newLine;
 
 
+/*
+   Struct: linkerModule
+   Description: Represents a module (the outputs of one assembled file) loaded by the linker.
+   Fields:
+     - name: The name of the module, as received by the linker (its outputs are named after it).
+     - codeSize: The size of the code image of the module, in bytes.
+     - dataSize: The size of the data image of the module, in bytes.
+     - codeBase: The address the code image of the module is loaded at, in the linked image.
+     - dataBase: The address the data image of the module is loaded at, in the linked image.
+     - firstCodeEntry: The index of the first instruction of the module in the linked code image.
+     - assembled: The context of the module when it was assembled in the same process (whole-program mode),
+                  NULL when the module is loaded from its output files.
+   Notes:
+     - Within the module, the code starts at address 100 and the data right after it, as the assembler laid them out.
+*/
+typedef struct linkerModule
+{
+    const char *name;
+    long codeSize;
+    long dataSize;
+    long codeBase;
+    long dataBase;
+    unsigned long firstCodeEntry;
+    assemblyContext *assembled;
+} linkerModule;
+
+
+/*
+   Struct: linkerContext
+   Description: Represents everything the linker builds, from the loaded modules to the linked image.
+   Fields:
+     - modules: Array of the modules, by the order they're linked in.
+     - numOfModules: The number of modules.
+     - globals: The global symbols - the entries of all the modules, at their linked addresses.
+     - codeImage: The linked code image, the code images of all the modules one after the other.
+     - dataImage: The linked data image, the data images of all the modules one after the other.
+     - memory: The arena the global symbols are allocated from.
+     - errors: The stream the errors are printed to.
+     - errorCount: The number of errors found.
+   Notes:
+     - A zero initialized structure (with 'errors' set) represents an empty link.
+*/
+typedef struct linkerContext
+{
+    linkerModule *modules;
+    int numOfModules;
+    symbolHashTable globals;
+    codeImageTable codeImage;
+    dataImageTable dataImage;
+    arena memory;
+    FILE *errors;
+    long errorCount;
+} linkerContext;
+
+
+/*
+    Enum: simulatorOpKind
+    Description: Represents the operation of a predecoded instruction of the simulator.
+    Notes:
+        - The operations of the instruction set, then the operations that only report a fault:
+          an illegal word, a jump whose target isn't an instruction, and running past the last instruction.
+        - 'numOfSimulatorOps' is the number of operations.
+*/
+typedef enum simulatorOpKind
+{
+    opAdd, opSub, opAnd, opOr, opNor, opMove, opMvhi, opMvlo,
+    opAddi, opSubi, opAndi, opOri, opNori, opBne, opBeq, opBlt, opBgt,
+    opLb, opSb, opLw, opSw, opLh, opSh, opJmp, opJmpRegister, opLa, opCall, opStop,
+    opIllegal, opBadTarget, opRanPastEnd, numOfSimulatorOps
+} simulatorOpKind;
+
+
+/*
+   Struct: simulatorOp
+   Description: Represents an instruction of the simulated program, decoded once when the program is loaded.
+   Fields:
+     - handler: The address of the code executing the operation (threaded dispatch), NULL until the program is run.
+     - operand: The immediate value, the index of the target instruction of a branch/'jmp'/'call', or the address of 'la'.
+     - kind: The operation (see 'simulatorOpKind').
+     - rs, rt, rd: The registers of the instruction.
+   Notes:
+     - The record is 16 bytes, so the records of the hot instructions of a program share few cache lines.
+*/
+typedef struct simulatorOp
+{
+    const void *handler;
+    int operand;
+    unsigned char kind;
+    unsigned char rs;
+    unsigned char rt;
+    unsigned char rd;
+} simulatorOp;
+
+
+/*
+   Struct: simulator
+   Description: Represents the simulated machine - its memory, its registers and its predecoded program.
+   Fields:
+     - ops: The predecoded instructions of the code image, followed by an 'opRanPastEnd' record.
+     - numOfOps: The number of instructions in the code image.
+     - memory: The memory of the machine, the code image is loaded at address 100, and the data image right after it.
+     - memorySize: The number of bytes of memory.
+     - codeEnd: The address right after the last instruction (ICF).
+     - registers: The 32 registers of the machine.
+     - steps: The number of instructions executed.
+     - maxSteps: The number of instructions after which the run is stopped.
+     - pc: The address of the instruction at which the run stopped.
+     - fault: Why the run was stopped, NULL if the program reached 'stop'.
+   Notes:
+     - A zero initialized structure represents a machine with no program loaded.
+*/
+typedef struct simulator
+{
+    simulatorOp *ops;
+    unsigned long numOfOps;
+    unsigned char *memory;
+    unsigned long memorySize;
+    long codeEnd;
+    unsigned int registers[numOfRegisters];
+    unsigned long steps;
+    unsigned long maxSteps;
+    long pc;
+    const char *fault;
+} simulator;
+
+
+/*
+   Struct: lineStream
+   Description: Represents a file read line by line through a fixed window, for files too large to be held in memory.
+   Fields:
+     - fd: The file being read.
+     - window: The part of the file read so far and not handed out yet, the lines are views into it.
+     - capacity: The number of bytes allocated for the window.
+     - end: Whether the end of the file was reached.
+   Notes:
+     - The window holds a chunk of 'streamChunkSize' bytes, it only grows for a line longer than that.
+*/
+typedef struct lineStream
+{
+    FILE *fd;
+    sourceBuffer window;
+    unsigned long capacity;
+    bool end;
+} lineStream;
+
+
+/*
+   Struct: disassemblySymbol
+   Description: Represents a label of the disassembled program, read from its '.ent' file.
+   Fields:
+     - name: The name of the label.
+     - address: The address of the label.
+*/
+typedef struct disassemblySymbol
+{
+    char name[maxLabelLength + 1];
+    long address;
+} disassemblySymbol;
+
+
+/*
+   Struct: disassembler
+   Description: Represents the state of the disassembly of one object file.
+   Fields:
+     - opcodes: The instruction of every opcode, NULL if the opcode isn't defined (the 'R' opcodes aren't set).
+     - functs: The 'R' instructions of opcodes 0 and 1, by their funct.
+     - entries: The labels of the '.ent' file, sorted by address.
+     - numOfEntries: The number of labels in 'entries'.
+     - targets: The addresses the instructions refer to, sorted and without repeats.
+     - numOfTargets: The number of addresses in 'targets'.
+     - externals: The '.ext' file, read along with the code (its lines are sorted by address).
+     - external: The label and the address of the next external reference, 'address' is -1 if there are no more.
+     - labelPrefixLength: The number of 'syntheticLabelCharacter' the made up labels start with (see 'noteLabelName').
+     - codeSize, dataSize: The sizes of the code image and the data image, in bytes.
+     - writer: The writer of the disassembled source.
+     - fileName: The name of the object file.
+     - errors: The stream to print errors to.
+     - errorCount: The number of words that can't be written as source.
+   Notes:
+     - Only the labels are held in memory, the object file itself is read line by line.
+*/
+typedef struct disassembler
+{
+    const instructionWord *opcodes[numOfOpcodes];
+    const instructionWord *functs[2][maxFunct + 1];
+    disassemblySymbol *entries;
+    unsigned long numOfEntries;
+    long *targets;
+    unsigned long numOfTargets;
+    lineStream externals;
+    disassemblySymbol external;
+    int labelPrefixLength;
+    long codeSize;
+    long dataSize;
+    outputWriter *writer;
+    const char *fileName;
+    FILE *errors;
+    long errorCount;
+} disassembler;
+
+
 #endif
\ No newline at end of file
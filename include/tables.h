@@ -31,96 +31,141 @@
 void setSymbolTableEntryValues(long address, imageType type, symbolTable newEntry, char *labelName);
 
 
+/*
+   Function: hashSymbolName
+   Description: Calculates the hash value of a symbol name (FNV-1a).
+   Parameters:
+     - name: The name of the symbol.
+   Returns:
+     - The hash value of the given name.
+*/
+unsigned long hashSymbolName(const char *name);
+
+
+/*
+   Function: findSymbol
+   Description: Searches the symbol table for a symbol with the given name.
+   Parameters:
+     - table: Pointer to the symbol table.
+     - name: The name of the required symbol.
+   Returns:
+     - Pointer to the symbol table entry if found, otherwise NULL.
+   Notes:
+     - Probes the hash index linearly, starting from the slot that matches the hash value of the name.
+       Since the index is never more than half full, the expected number of compared names is constant.
+*/
+symbolTable findSymbol(symbolHashTable *table, const char *name);
+
+
+/*
+   Function: growSymbolTable
+   Description: Doubles the capacity of the symbol table's hash index.
+   Parameters:
+     - table: Pointer to the symbol table.
+   Returns:
+     - void
+   Notes:
+     - Allocates a new slots array and re-indexes all the symbols by traversing the list of symbols.
+*/
+void growSymbolTable(symbolHashTable *table);
+
+
+/*
+   Function: insertSymbol
+   Description: Appends an initialized symbol to the symbol table.
+   Parameters:
+     - table: Pointer to the symbol table.
+     - newEntry: Pointer to the symbol, its memory is owned by the caller (usually the arena of the file).
+   Returns:
+     - void
+   Notes:
+   - Appends the entry at the end of the list (using the 'tail' pointer), and indexes it by its name.
+   - Grows the hash index whenever it becomes half full.
+*/
+void insertSymbol(symbolHashTable *table, symbolTable newEntry);
+
+
 /*
    Function: addToSymbolTable
-   Description: Adds an entry to the symbol table (which represented by linked-list).
+   Description: Adds an entry to the symbol table.
    Parameters:
      - table: Pointer to the symbol table.
      - symbol: The symbol to add.
      - address: The address associated with the symbol.
      - type: The image type of the symbol (code, data, entry, external).
+     - memory: Pointer to the arena of the current file.
    Returns:
      - void
    Notes:
-   - Allocates memory for a new symbol table entry and initializes its values using 'setSymbolTableEntryValues' function.
-   - If the table is empty, the new entry becomes the first element in the list.
-   - If the table is not empty, traverses the existing list to find the last node and appends the new entry at the end.
-
+   - Allocates memory from the arena for a new symbol table entry and initializes its values using 'setSymbolTableEntryValues' function.
+   - The entry is appended by 'insertSymbol'.
 */
-void addToSymbolTable(symbolTable *table, char *symbol, long address, imageType type);
+void addToSymbolTable(symbolHashTable *table, char *symbol, long address, imageType type, arena *memory);
 
 
+/**************** Data Table Functions ****************/
+
 /*
-   Function: freeSymbolTable
-   Description: Releases the memory allocated for the symbol table.
+   Function: reserveDataBytes
+   Description: Makes sure the data image buffer has room for the given number of additional bytes.
    Parameters:
-     - head: head Pointer to the head of the symbol table.
+     - table: Pointer to the data image table.
+     - numOfBytes: The number of bytes that are about to be appended.
    Returns:
      - void
    Notes:
-     - Iterates through all elements of the symbol table (which are represented as nodes in a linked list),
-       and deallocates the memory associated with each of them.
- */
-void freeSymbolTable(symbolTable head);
+     - Doubles the capacity of the buffer until the bytes fit, so appending takes amortized constant time.
+*/
+void reserveDataBytes(dataImageTable *table, unsigned long numOfBytes);
 
 
+/*
+   Function: appendDataByte
+   Description: Appends a 1 byte variable ('.db' / '.asciz') to the data image.
+   Parameters:
+     - table: Pointer to the data image table.
+     - value: The value of the variable.
+   Returns:
+     - void
+*/
+void appendDataByte(dataImageTable *table, long value);
 
-/**************** Data Table Functions ****************/
 
 /*
-   Function: setDataEntryValues
-   Description: Sets the values of a new data image entry.
+   Function: appendDataHalfWord
+   Description: Appends a 2 bytes variable ('.dh') to the data image, in little-endian order.
    Parameters:
-     - type: The directive type for the data image entry (DH, DW, DB, ASCIZ, ENTRY, EXTERN, NONE).
-     - numOfVars: The number of variables associated with this data entry.
-     - DC: The address where the data is to be stored.
-     - dataArr: Pointer to the data array to be stored.
-     - sizeofVar: The size of each variable in bytes.
-     - newEntry: Pointer to the data image entry to be initialized.
+     - table: Pointer to the data image table.
+     - value: The value of the variable.
    Returns:
      - void
-   Notes:
-     - Assigns the directive type, variable size, number of variables, address, and data array
-       to the respective fields in the data entry structure.
-     - Calculates and assigns the total size of the data entry based on the size of a single variable
-       and the number of variables.
-     - Initializes the 'next' pointer of the data entry as NULL.
 */
-void setDataEntryValues(directiveType type, int numOfVars, long DC, void* dataArr, int sizeofVar, dataTable newEntry);
+void appendDataHalfWord(dataImageTable *table, long value);
 
 
 /*
-   Function: getSizeOfDataVariable
-   Description: Determines the size of a single data variable based on the directive type.
+   Function: appendDataWord
+   Description: Appends a 4 bytes variable ('.dw') to the data image, in little-endian order.
    Parameters:
-     - type: The directive type that determines the size of the variable.
+     - table: Pointer to the data image table.
+     - value: The value of the variable.
    Returns:
-     - The size of a single variable based on the directive type (1, 2, or 4 bytes).
-   Notes:
-     - Checks the directive type and assigns the size accordingly: '.db' or '.asciz' receives 1 byte variables,
-       '.dh' receives 2 bytes variables, and '.dw' receives 4 bytes variables.
-     - Returns the size of the variable based on the directive type provided.
+     - void
 */
-int getSizeOfDataVariable(directiveType type);
+void appendDataWord(dataImageTable *table, long value);
 
 
 /*
-   Function: addToDataImage
-   Description: Adds a new entry to the data image linked list.
+   Function: appendDataVariable
+   Description: Appends a single variable to the data image, according to the size defined by the directive type.
    Parameters:
-     - type: The directive type for the data image entry ('.db', '.dh', '.dw', '.asciz').
-     - numOfVariables: The number of variables to add.
-     - DC: Pointer to the Data Counter used for addressing.
-     - dataArray: Pointer to the array of data variables to be added.
-     - table: Pointer to the data table to which the entry will be added.
+     - table: Pointer to the data image table.
+     - type: The directive type of the variable ('.db', '.dh', '.dw', '.asciz').
+     - value: The value of the variable.
    Returns:
      - void
-   Notes:
-     - The function calculates the size of each variable based on the directive type.
-     - It allocates memory for the new data entry and sets its values using setDataEntryValues().
-     - Increases the Data Counter (DC) according to the size of the added data.
 */
-void addToDataImage(directiveType type, int numOfVariables, long* DC, void* dataArray, dataTable* table);
+void appendDataVariable(dataImageTable *table, directiveType type, long value);
 
 
 
@@ -128,111 +173,136 @@ void addToDataImage(directiveType type, int numOfVariables, long* DC, void* data
 
 /*
    Function: setCodeEntryValues
-   Description: Initializes a new code image entry with values from the instruction and content.
+   Description: Initializes a new code image entry with values from the scanned instruction line.
    Parameters:
-     - content: Instruction line content.
-     - index: Index of the content being processed.
-     - instructionToken: Structure containing instruction details.
+     - instructionIR: Pointer to the scanned instruction line (instruction details and operands).
      - IC: Current instruction counter value.
-     - newEntry: Pointer to codeTable entry to be initialized.
+     - newEntry: Pointer to the code image entry to be initialized.
      - lineNumber: Line number associated with the instruction.
    Returns:
      - void
    Notes:
      - Initializes the code entry's binary representation.
-     - Sets the line number, address, instruction type, and initializes next to NULL.
+     - Sets the line number, address and instruction type.
 */
-void setCodeEntryValues(const char* content, int index, instructionWord instructionToken, long IC, codeTable newEntry, long lineNumber);
+void setCodeEntryValues(const instructionLine *instructionIR, long IC, codeImageEntry *newEntry, long lineNumber);
 
 
 /*
    Function: addToCodeImage
-   Description: Adds a new code image entry to the linked list.
+   Description: Appends a new code image entry to the code image array.
    Parameters:
-     - content: Instruction line content.
-     - index: Index of the content being processed.
-     - instructionToken: Structure containing instruction details.
-     - table: Pointer to the head of the code image linked list.
+     - instructionIR: Pointer to the scanned instruction line (instruction details and operands).
+     - table: Pointer to the code image table.
      - IC: Pointer to the current instruction counter value.
      - lineNumber: Line number associated with the instruction.
    Returns:
      - void
    Notes:
      - Increments the instruction counter by 4 bytes.
-     - Appends the new entry to the end of the code image linked list.
+     - Doubles the capacity of the array when it is full, so appending takes amortized constant time.
 */
-void addToCodeImage(const char* content, int index, instructionWord instructionToken, codeTable* table, long* IC, long lineNumber);
+void addToCodeImage(const instructionLine *instructionIR, codeImageTable* table, long* IC, long lineNumber);
 
 
 /*
    Function: setCodeEntryBitfield
    Description: Sets the binary representation of an instruction line based on its type.
    Parameters:
-     - content: Instruction line content.
-     - index: Index of the content being processed.
-     - instructionToken: Structure containing instruction details.
-     - newEntry: Pointer to codeTable entry for the binary representation.
+     - instructionIR: Pointer to the scanned instruction line (instruction details and operands).
+     - newEntry: Pointer to the code image entry for the binary representation.
    Returns:
      - void
    Notes:
-     - Allocates memory for the binary representation of the code image entry.
      - Calls specific functions to set the bitfield based on the instruction type (R, I, or J).
 */
-void setCodeEntryBitfield(const char *content, int index, instructionWord instructionToken, codeTable newEntry);
+void setCodeEntryBitfield(const instructionLine *instructionIR, codeImageEntry *newEntry);
 
 
 /*
    Function: setRBitField
    Description: Sets the binary representation of a R-type instruction line.
    Parameters:
-     - content: Instruction line content.
-     - index: Pointer to the content index being processed.
-     - instructionToken: Pointer to instructionWord containing instruction details.
-     - newEntry: Pointer to codeTable entry for the binary representation.
+     - instructionIR: Pointer to the scanned instruction line (instruction details and operands).
+     - newEntry: Pointer to the code image entry for the binary representation.
    Returns:
      - void
    Notes:
-     - Assigns opcode, funct, rs, rt, and rd fields in newEntry from content and instructionToken.
+     - Assigns opcode, funct, rs, rt, and rd fields in newEntry from the instruction and its register operands.
      - Adjusts rt field if it's a copy instruction.
 */
-void setRBitField(const char *content, int *index, instructionWord *instructionToken, codeTable newEntry);
+void setRBitField(const instructionLine *instructionIR, codeImageEntry *newEntry);
 
 
 /*
    Function: setIBitField
    Description: Sets the binary representation of an 'I' type instruction line.
    Parameters:
-     - content: The content of the instruction line.
-     - index: Pointer to the index of the content being processed.
-     - instructionToken: Pointer to the instructionWord structure containing the instruction details.
-     - newEntry: Pointer to the codeTable entry to store the generated binary representation.
+     - instructionIR: Pointer to the scanned instruction line (instruction details and operands).
+     - newEntry: Pointer to the code image entry to store the generated binary representation.
    Returns:
      - void
    Notes:
-     - Assigns opcode from instructionToken to newEntry.
-     - Retrieves and assigns rs from content using the index.
-     - For conditional branches, skips to the next operand and assigns immed.
-     - Retrieves and assigns rt from content using the index.
+     - Assigns opcode, rs and rt from the instruction and its register operands.
+     - Assigns immed from the integer operand, the immed of a conditional branch is set by its fixup.
 */
-void setIBitField(const char *content, int *index, instructionWord *instructionToken, codeTable newEntry);
+void setIBitField(const instructionLine *instructionIR, codeImageEntry *newEntry);
 
 
 /*
    Function: setJBitField
    Description: Sets the binary representation of a J-type instruction line.
    Parameters:
-     - content: The content of the instruction line.
-     - index: Pointer to the index of the content being processed.
-     - instructionToken: Pointer to the instructionWord structure containing the instruction details.
-     - newEntry: Pointer to the codeTable entry to store the generated binary representation.
+     - instructionIR: Pointer to the scanned instruction line (instruction details and operands).
+     - newEntry: Pointer to the code image entry to store the generated binary representation.
    Returns:
      - void
    Notes:
-     - Assigns opcode from instructionToken to newEntry's opcode field.
-     - If it's a 'jump' instruction with a register operand, sets the reg field and retrieves the register's address.
+     - Assigns opcode from the instruction to newEntry's opcode field.
+     - If it's a 'jump' instruction with a register operand, sets the reg field and the register's number as address.
+     - The address of a label operand is set by its fixup.
 */
-void setJBitField(const char *content, int *index, instructionWord *instructionToken, codeTable newEntry);
+void setJBitField(const instructionLine *instructionIR, codeImageEntry *newEntry);
+
+
+
+/**************** Fixup Table Functions ****************/
 
+/*
+   Function: addToFixupTable
+   Description: Records an instruction whose label operand has to be resolved after the first pass.
+   Parameters:
+     - table: Pointer to the fixup table.
+     - codeIndex: The index of the instruction in the code image.
+     - type: The type of the instruction (I or J).
+     - symbol: The name of the label operand.
+     - lineNumber: Line number associated with the instruction.
+     - memory: Pointer to the arena of the current file.
+   Returns:
+     - void
+   Notes:
+     - Allocates memory from the arena for a copy of the label name.
+     - Doubles the capacity of the array when it is full, so appending takes amortized constant time.
+*/
+void addToFixupTable(fixupTable *table, unsigned long codeIndex, instructionType type, char *symbol, long lineNumber, arena *memory);
+
+
+/**************** Deferred Entries Functions ****************/
+
+/*
+   Function: addToDeferredEntries
+   Description: Records the operand of an '.entry' directive, to be marked as entry after the first pass.
+   Parameters:
+     - table: Pointer to the deferred entries table.
+     - name: The name of the label.
+     - lineNumber: Line number of the directive.
+     - memory: Pointer to the arena of the current file.
+   Returns:
+     - void
+   Notes:
+     - Allocates memory from the arena for a copy of the label name.
+*/
+void addToDeferredEntries(deferredEntryTable *table, char *name, long lineNumber, arena *memory);
 
 
 /******************** Attributes Table Functions ********************/
@@ -263,14 +333,17 @@ void setAttributeEntryValues(imageType type, long address, attributesTable newEn
      - type: The image type associated with the attribute entry.
      - address: The address value associated with the attribute entry.
      - table: Pointer to the head of the attributes linked list.
+     - tail: Pointer to the last entry of the attributes linked list (NULL when the list is empty).
+     - memory: Pointer to the arena of the current file.
    Returns:
      - void
    Notes:
-     - Allocates memory for a new attribute table entry and initializes its values.
+     - Allocates memory from the arena for a new attribute table entry and initializes its values.
      - Sets the name, image type, and address for the new attribute entry.
-     - Appends the new entry to the end of the attributes linked list.
+     - Appends the new entry to the end of the attributes linked list, through the tail, in constant time.
 */
-void addToAttributesTable(char *name, imageType type, long address, attributesTable *table);
+void addToAttributesTable(char *name, imageType type, long address, attributesTable *table, attributesTable *tail,
+        arena *memory);
 
 
 /*
@@ -278,30 +351,32 @@ void addToAttributesTable(char *name, imageType type, long address, attributesTa
    Description: Adds all the labels marked as 'entry' from the symbol table to the attributes table.
    Parameters:
      - attributesHead: Pointer to the head of the attributes linked list.
-     - symbolHead: Pointer to the head of the symbol table linked list.
+     - attributesTail: Pointer to the last entry of the attributes linked list.
+     - symbolTab: Pointer to the symbol table.
+     - memory: Pointer to the arena of the current file.
    Returns:
      - void
    Notes:
      - Iterates through the symbol table entries to identify those marked as 'entry'.
      - For each 'entry' symbol found, adds an attribute entry to the attributes table.
 */
-void addEntrySymbolsToTable(attributesTable *attributesHead, symbolTable symbolHead);
+void addEntrySymbolsToTable(attributesTable *attributesHead, attributesTable *attributesTail, symbolHashTable *symbolTab,
+        arena *memory);
 
 
 /*
-   Function: freeTables
-   Description: Releases memory allocated for data image, code image, and attributes table linked lists.
+   Function: freeAssemblyContext
+   Description: Releases all the memory owned by the assembly context of a file.
    Parameters:
-     - codeHead: Pointer to the head of the code image linked list.
-     - dataHead: Pointer to the head of the data image linked list.
-     - attributesHead: Pointer to the head of the attributes table linked list.
+     - context: Pointer to the assembly context.
    Returns:
      - void
    Notes:
-     - Iterates through each linked list and frees memory associated with each node.
-     - Releases memory for the code image, data image, and attributes table linked lists.
+     - Releases the source buffer and the growable arrays (hash index, code image, data image, fixups and deferred entries).
+     - The symbols, attributes and recorded label names are released at once, by releasing the arena.
+     - Leaves the context zero initialized, ready for the next file.
 */
-void freeTables(codeTable codeHead, dataTable dataHead, attributesTable attributesHead);
+void freeAssemblyContext(assemblyContext *context);
 
 
-#endif
\ No newline at end of file
+#endif
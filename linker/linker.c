@@ -0,0 +1,54 @@
+/*
+ * Description: Links the outputs of separately assembled files ('.ob', '.ent' and '.ext') into one object file.
+ *
+ * Build (from the repository root, every source file except the one holding the assembler's 'main'):
+ *     gcc -ansi -pedantic -Wall -O2 -o linker linker/linker.c $(ls src/[a-z]*.c | grep -v /assembler.c) -pthread
+ * Run:
+ *     ./linker [-o output.ob] module...
+ * Every module is named like the input file it was assembled from (e.g. 'x' or 'x.as' for 'x.ob', 'x.ent', 'x.ext').
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/linker.h"
+#include "../include/general.h"
+
+
+int main(int argc, char *argv[])
+{
+    int i, numOfModules = 0;
+    const char *outputName = defaultLinkedFileName;
+    char **moduleNames = (char **) callocWithCheck(argc * sizeof(char *));
+    linkerContext linker = {0};
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            outputName = argv[++i];
+        else if (argv[i][0] == '-')
+        {
+            fprintf(stderr, "Error: unknown option '%s'.\n", argv[i]);
+            free(moduleNames);
+            return 1;
+        }
+        else
+            moduleNames[numOfModules++] = argv[i];
+    }
+    if (numOfModules == 0)
+    {
+        fprintf(stderr, "Error: Missing modules.\n");
+        free(moduleNames);
+        return 1;
+    }
+
+    /* The linked image is written only if all the symbols were resolved */
+    linker.errors = stderr;
+    if (linkModules(&linker, moduleNames, numOfModules) == VALID)
+        writeLinkedImage(&linker, outputName);
+
+    i = (linker.errorCount == 0) ? 0 : 1;
+    freeLinkerContext(&linker);
+    free(moduleNames);
+    return i;
+}
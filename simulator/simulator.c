@@ -0,0 +1,60 @@
+/*
+ * Description: Runs an assembled program ('.ob' file) on the simulated machine.
+ *
+ * Build (from the repository root, every source file except the one holding the assembler's 'main'):
+ *     gcc -ansi -pedantic -Wall -O2 -o simulator simulator/simulator.c $(ls src/[a-z]*.c | grep -v /assembler.c) -pthread
+ * Run:
+ *     ./simulator [--max-steps N] [--registers] program.ob
+ * The program runs until 'stop'. The number of executed instructions is printed, and the registers with '--registers'.
+ * The exit status is 1 if the program faulted or ran more than N instructions.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/simulator.h"
+
+
+int main(int argc, char *argv[])
+{
+    int i, status;
+    const char *programName = NULL;
+    unsigned long maxSteps = 0;
+    bool showRegisters = FALSE;
+    simulator machine = {0};
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--max-steps") == 0 && i + 1 < argc)
+            maxSteps = strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--registers") == 0)
+            showRegisters = TRUE;
+        else if (argv[i][0] == '-' || programName != NULL)
+        {
+            fprintf(stderr, "Error: unknown option '%s'.\n", argv[i]);
+            return 1;
+        }
+        else
+            programName = argv[i];
+    }
+    if (programName == NULL)
+    {
+        fprintf(stderr, "Error: Missing object file.\n");
+        return 1;
+    }
+
+    if (loadObjectImage(&machine, programName, stderr) == INVALID)
+        return 1;
+    if (maxSteps != 0)
+        machine.maxSteps = maxSteps;
+
+    status = (runSimulator(&machine) == VALID) ? 0 : 1;
+    if (machine.fault != NULL)
+        fprintf(stderr, "Error: %s (address %04ld).\n", machine.fault, machine.pc);
+    printf("%lu instructions executed\n", machine.steps);
+    if (showRegisters)
+        printRegisters(&machine, stdout);
+
+    freeSimulator(&machine);
+    return status;
+}
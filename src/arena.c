@@ -0,0 +1,100 @@
+#include <string.h>
+#include <stdlib.h>
+#include "../include/arena.h"
+#include "../include/general.h"
+
+/* Rounds the given size up to a multiple of the arena alignment */
+#define alignedSize(size) (((size) + sizeof(arenaAlignment) - 1) / sizeof(arenaAlignment) * sizeof(arenaAlignment))
+
+
+void *arenaAlloc(arena *memory, unsigned long size)
+{
+    arenaBlock *newBlock;
+    unsigned long blockSize;
+    char *allocated;
+
+    size = alignedSize(size);
+
+    /* If the current block can't hold the requested size, a new block is allocated */
+    if(memory->blocks == NULL || memory->blocks->size - memory->blocks->used < size)
+    {
+        blockSize = (size > arenaBlockSize) ? size : arenaBlockSize;
+        newBlock = (arenaBlock *) callocWithCheck(alignedSize(sizeof(arenaBlock)) + blockSize);
+        newBlock->size = blockSize;
+        memory->blockCount++;
+
+        /* A block dedicated to a large allocation is kept behind the current block, so its free space isn't lost */
+        if(blockSize > arenaBlockSize && memory->blocks != NULL)
+        {
+            newBlock->next = memory->blocks->next;
+            memory->blocks->next = newBlock;
+        }
+        else
+        {
+            newBlock->next = memory->blocks;
+            memory->blocks = newBlock;
+        }
+    }
+    else
+        newBlock = memory->blocks;
+
+    /* The blocks are allocated zero initialized and never reused, so the handed out memory is already cleared */
+    allocated = (char *)newBlock + alignedSize(sizeof(arenaBlock)) + newBlock->used;
+    newBlock->used += size;
+    memory->allocations++;
+    memory->bytes += size;
+    return allocated;
+}
+
+
+char *arenaCopyString(arena *memory, const char *string)
+{
+    char *copy = (char *) arenaAlloc(memory, strlen(string) + 1);
+    strcpy(copy, string);
+    return copy;
+}
+
+
+void adoptArena(arena *memory, arena *other)
+{
+    arenaBlock *last;
+
+    /* The blocks of the other arena are kept behind the current block, so its free space isn't lost */
+    if(other->blocks != NULL)
+    {
+        for(last = other->blocks; last->next != NULL; last = last->next);
+        if(memory->blocks == NULL)
+            memory->blocks = other->blocks;
+        else
+        {
+            last->next = memory->blocks->next;
+            memory->blocks->next = other->blocks;
+        }
+    }
+    memory->allocations += other->allocations;
+    memory->blockCount += other->blockCount;
+    memory->bytes += other->bytes;
+    memset(other, 0, sizeof(arena));
+}
+
+
+void freeArena(arena *memory)
+{
+    arenaBlock *temp;
+
+    while(memory->blocks != NULL)
+    {
+        temp = memory->blocks->next;
+        free(memory->blocks);
+        memory->blocks = temp;
+    }
+    memory->allocations = memory->blockCount = memory->bytes = 0;
+}
+
+
+void printArenaStats(arena *memory, const char *fileName, FILE *fd)
+{
+    fprintf(fd, "Arena of file '%s': %lu allocations (%lu bytes) served by %lu blocks, %lu calls to malloc avoided.\n",
+            fileName, memory->allocations, memory->bytes, memory->blockCount,
+            memory->allocations > memory->blockCount ? memory->allocations - memory->blockCount : 0);
+}
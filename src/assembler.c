@@ -3,8 +3,7 @@
  * Description: Converts files written in imaginary assembly language into machine code files.
  */
 
-#include "../include/files.h"
-#include "../include/createOutputFiles.h"
+#include "../include/jobs.h"
 
 
 /*
@@ -13,7 +12,7 @@
    Processes each input file separately. For each valid file, produces relevant output files.
    If an input file is invalid, prints the encountered errors.
    Parameters:
-    - argc: Number of command line arguments.
+    - argc: Number of command line arguments (input files and options).
     - argv: Array of command line argument strings.
    Returns:
     - int: Returns 0 on completion.
@@ -28,30 +27,19 @@
         - Object File: Represents instructions and directives from the input file in hexadecimal format.
           Additional information is available in the 'createObjectFile' function within the 'createFiles.c' file.
     - If an input file is invalid, prints encountered errors (one per invalid line) without generating any output files.
+    - Options are described in 'parseOptions' (options.h), e.g. '--max-line-length N' or '-j N'.
+    - Each file is assembled in its own context, which is released at once after its output files are created.
+      When compiled with 'ARENA_STATS' defined, the allocation counters of each file's arena are printed.
+      With '-j N' the files are assembled concurrently, and the diagnostics are still printed by the order of the files.
+    - The names of the input files may also be read from list files ('@FILE', '--files-from FILE').
+    - With '--serve SOCKET' the assembler stays up and serves requests on a Unix-domain socket (see server.h),
+      the client ('client/client.c') runs command lines on it.
  */
 int assembler(int argc, char *argv[])
 {
-    int i;
-    long ICF, DCF;
-    codeTable codeImage = NULL;
-    dataTable dataImage = NULL;
-    attributesTable attributesTab = NULL;
-
-    if (argc < 2)
-    {
-        fprintf(stderr, "Error: Missing input files.\n");
-        return 0;
-    }
-
-    for (i = 1; i < argc; ++i)
-    {
-        if (fileIsValid(argv[i], &codeImage, &dataImage, &attributesTab, &ICF, &DCF))
-            createOutputFiles(argv[i], codeImage, dataImage, attributesTab, ICF, DCF);
-    }
-    return 0;
+    return runAssembler(argc, argv, FALSE);
 }
 
-
 int main(int argc, char *argv[])
 {
     return assembler(argc, argv);
@@ -1,47 +1,37 @@
-
 #include "../include/instructions.h"
 #include "../include/labels.h"
+#include "../include/tables.h"
 
 
-void completeLineBinaryEncoding(symbolTable label, codeTable table, instructionWord *instructionToken, newLine *line)
+symbolTable encodeFixup(newLine *line, fixupEntry *fixup, assemblyContext *context)
 {
 	long address;
-	codeTable currentEntry;
-
-	/* Finds from the code table the instruction line in which the binary coding should be completed  */
-	for(currentEntry = table; currentEntry->lineNumber != line->number; currentEntry = currentEntry->next){};
+	symbolTable label;
+	/* The instruction in which the binary coding should be completed */
+	codeImageEntry *currentEntry = &context->codeImage.entries[fixup->codeIndex];
 
-	/* If 'J' dataType instruction, Saves the instruction address, we'll need it later if the current label is extern */
-	if(currentEntry->type == J)
-		instructionToken->address = currentEntry->address;
+	/* Obtaining the label with which we'll update the binary encoding of the current line */
+	if(getLabelFromTable(line, fixup->symbol, &label, &context->symbolTab) == INVALID)
+		return NULL;
 
 	/* If the dataType to be set in the 'address' field is valid  */
-	if(getAddress(line, currentEntry->address, label, currentEntry->type, &address) == VALID)
+	if(getAddress(line, currentEntry->address, label, fixup->type, &address) == VALID)
 	{
-		if(currentEntry->type == J)
-			currentEntry -> data -> typeJ.address = address;
-		if(currentEntry->type == I)
-			currentEntry -> data -> typeI.immed = (int)address;
+		if(fixup->type == J)
+			currentEntry -> data.typeJ.address = address;
+		if(fixup->type == I)
+			currentEntry -> data.typeI.immed = (int)address;
 	}
+	return label;
 }
 
 
-void checkLineBinaryEncoding(newLine *line, symbolTable symTable, codeTable cTable, instructionWord *instructionToken, symbolTable *label)
+void resolveFixup(newLine *line, fixupEntry *fixup, assemblyContext *context)
 {
-    int contentIndex = 0;
-    char symbol[maxLabelLength];
-    unsigned int opcode;
+	symbolTable label = encodeFixup(line, fixup, context);
 
-    /* get the instruction that appears in the current line */
-    getInstruction(line->content, &contentIndex, instructionToken);
-    opcode = instructionToken->opcode;
-    /* If the current instruction is dataType 'I' or 'J' instructions with label operand */
-    if(instructionWithLabelOperand(line, contentIndex, opcode))
-    {
-        /* Finds and extracts the label name that appears in the current line */
-        extractLabelFromLine(symbol,line->content, contentIndex);
-        /* Obtaining the label with which we'll update the binary encoding of the current line */
-        if(getLabelFromTable(line, symbol, label, symTable) == VALID)
-            completeLineBinaryEncoding(*label, cTable, instructionToken, line);
-    }
-}
\ No newline at end of file
+	/* If the current label is external, adds the instruction address to the attributes table */
+	if(label != NULL && label->isExternal)
+		addToAttributesTable(label->name, external, context->codeImage.entries[fixup->codeIndex].address,
+		                     &context->attributesTab, &context->attributesTail, &context->memory);
+}
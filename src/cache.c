@@ -0,0 +1,326 @@
+/* For 'mkstemp', 'fdopen' and the directory functions */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <utime.h>
+#include <sys/stat.h>
+#include "../include/cache.h"
+#include "../include/files.h"
+#include "../include/createOutputFiles.h"
+#include "../include/general.h"
+#include "../include/statistics.h"
+
+
+void hashBytes(unsigned long lanes[2], const char *bytes, unsigned long size)
+{
+    unsigned long i, fnv = lanes[0], jenkins = lanes[1];
+
+    for (i = 0; i < size; i++)
+    {
+        fnv = ((fnv ^ (unsigned char)bytes[i]) * 16777619UL) & 0xFFFFFFFFUL;
+        jenkins = (jenkins + (unsigned char)bytes[i]) & 0xFFFFFFFFUL;
+        jenkins = (jenkins + (jenkins << 10)) & 0xFFFFFFFFUL;
+        jenkins ^= jenkins >> 6;
+    }
+    lanes[0] = fnv;
+    lanes[1] = jenkins;
+}
+
+
+void cacheKey(const sourceBuffer *source, const assemblerOptions *options, char *key)
+{
+    /* The offset basis of FNV-1a, and an arbitrary seed for the second lane */
+    unsigned long lanes[2] = {2166136261UL, 0x9E3779B9UL};
+    char optionsText[sizeof(assemblerVersion) + 32];
+
+    sprintf(optionsText, "%s %ld", assemblerVersion, options->maxLineLength);
+    hashBytes(lanes, optionsText, (unsigned long)strlen(optionsText) + 1);
+    hashBytes(lanes, source->content, source->size);
+
+    /* The final mix of the one-at-a-time hash */
+    lanes[1] = (lanes[1] + (lanes[1] << 3)) & 0xFFFFFFFFUL;
+    lanes[1] ^= lanes[1] >> 11;
+    lanes[1] = (lanes[1] + (lanes[1] << 15)) & 0xFFFFFFFFUL;
+    sprintf(key, "%08lx%08lx", lanes[0], lanes[1]);
+}
+
+
+char *cacheEntryPath(const char *directory, const char *name)
+{
+    char *path = callocWithCheck(strlen(directory) + strlen(name) + 2);
+
+    sprintf(path, "%s/%s", directory, name);
+    return path;
+}
+
+
+state openCacheDirectory(const assemblerOptions *options)
+{
+    struct stat directoryStatus;
+
+    if (mkdir(options->cacheDirectory, 0777) != 0 &&
+        (errno != EEXIST || stat(options->cacheDirectory, &directoryStatus) != 0 || !S_ISDIR(directoryStatus.st_mode)))
+    {
+        fprintf(stderr, "Error: failed to access cache directory '%s', files are assembled without the cache.\n",
+                options->cacheDirectory);
+        return INVALID;
+    }
+    return VALID;
+}
+
+
+state copyCachedOutput(FILE *entry, long size, const char *fileName, char *extension, FILE *errors)
+{
+    FILE *fileDescriptor;
+    char *outputFileName = getFileFullName(fileName, extension);
+    char *buffer = callocWithCheck(outputBufferSize);
+    unsigned long chunkSize;
+    state copyState = VALID;
+
+    if (openFile(&fileDescriptor, outputFileName, "w", errors) == VALID)
+    {
+        while (size > 0 && copyState == VALID)
+        {
+            chunkSize = (size < outputBufferSize) ? (unsigned long)size : outputBufferSize;
+            if (fread(buffer, 1, chunkSize, entry) != chunkSize)
+                copyState = INVALID;
+            fwrite(buffer, 1, chunkSize, fileDescriptor);
+            size -= (long)chunkSize;
+        }
+        fclose(fileDescriptor);
+    }
+    /* The output is skipped, the same as when it's assembled */
+    else if (fseek(entry, size, SEEK_CUR) != 0)
+        copyState = INVALID;
+
+    free(buffer);
+    free(outputFileName);
+    return copyState;
+}
+
+
+state restoreFromCache(const char *fileName, const char *key, assemblyContext *context)
+{
+    FILE *entry;
+    char version[16];
+    unsigned long sourceSize;
+    /* The sizes of the object, externals and entries outputs, -1 for an output the source doesn't have */
+    long objectSize, externSize, entrySize, dataStart;
+    /* The counts of the assembly the entry came from */
+    assemblyStatistics counts;
+    state entryState = INVALID;
+    char *path = cacheEntryPath(context->options->cacheDirectory, key);
+
+    entry = fopen(path, "rb");
+    if (entry != NULL)
+    {
+        /* The header must match the source, and the entry must hold all the outputs it declares */
+        if (fscanf(entry, "%15s %lu %ld %ld %ld %lu %lu %lu %lu %lu", version, &sourceSize, &objectSize, &externSize,
+                   &entrySize, &counts.symbols, &counts.codeWords, &counts.dataBytes, &counts.fixups,
+                   &counts.attributes) == 10 &&
+            getc(entry) == '\n' && strcmp(version, assemblerVersion) == 0 && sourceSize == context->source.size &&
+            (dataStart = ftell(entry)) >= 0 && fseek(entry, 0, SEEK_END) == 0 &&
+            ftell(entry) - dataStart == (objectSize > 0 ? objectSize : 0) + (externSize > 0 ? externSize : 0) +
+                                        (entrySize > 0 ? entrySize : 0) &&
+            fseek(entry, dataStart, SEEK_SET) == 0)
+        {
+            entryState = VALID;
+
+            /* The same outputs, in the same order, as 'createOutputFiles' */
+            if (externSize >= 0 && entrySize >= 0)
+            {
+                fseek(entry, objectSize > 0 ? objectSize : 0, SEEK_CUR);
+                if (copyCachedOutput(entry, externSize, fileName, ".ext", context->errors) == INVALID ||
+                    copyCachedOutput(entry, entrySize, fileName, ".ent", context->errors) == INVALID)
+                    entryState = INVALID;
+                fseek(entry, dataStart, SEEK_SET);
+            }
+            if (objectSize >= 0 && copyCachedOutput(entry, objectSize, fileName, ".ob", context->errors) == INVALID)
+                entryState = INVALID;
+        }
+        fclose(entry);
+
+        /* Marks the entry as the most recently used one */
+        if (entryState == VALID)
+        {
+            utime(path, NULL);
+            if (context->statistics != NULL)
+            {
+                context->statistics->symbols = counts.symbols;
+                context->statistics->codeWords = counts.codeWords;
+                context->statistics->dataBytes = counts.dataBytes;
+                context->statistics->fixups = counts.fixups;
+                context->statistics->attributes = counts.attributes;
+            }
+        }
+    }
+    free(path);
+    return entryState;
+}
+
+
+void storeInCache(const char *key, assemblyContext *context)
+{
+    FILE *entry;
+    int entryDescriptor;
+    char *objectImage = NULL, *externImage = NULL, *entryImage = NULL;
+    size_t objectSize = 0, externSize = 0, entrySize = 0;
+    FILE *stream;
+    char *temporaryName, *path = cacheEntryPath(context->options->cacheDirectory, key);
+    bool hasObject = (context->dataImage.size != 0 || context->codeImage.count != 0);
+    bool hasAttributes = (context->attributesTab != NULL);
+    assemblyStatistics counts;
+
+    countAssembly(context, &counts);
+
+    /* The outputs are formatted into memory, exactly as they're written to the output files */
+    if (hasObject)
+    {
+        stream = openMemoryStream(&objectImage, &objectSize);
+        writeObjectFile(stream, &context->codeImage, &context->dataImage, context->ICF, context->DCF);
+        fclose(stream);
+    }
+    if (hasAttributes)
+    {
+        stream = openMemoryStream(&externImage, &externSize);
+        exportToExtAndEntFiles(context->attributesTab, stream, NULL);
+        fclose(stream);
+        stream = openMemoryStream(&entryImage, &entrySize);
+        exportToExtAndEntFiles(context->attributesTab, NULL, stream);
+        fclose(stream);
+    }
+
+    temporaryName = callocWithCheck(strlen(path) + 8);
+    sprintf(temporaryName, "%s.XXXXXX", path);
+    entryDescriptor = mkstemp(temporaryName);
+    if (entryDescriptor >= 0)
+    {
+        entry = fdopen(entryDescriptor, "wb");
+        if (entry == NULL)
+        {
+            close(entryDescriptor);
+            remove(temporaryName);
+        }
+        else
+        {
+            fprintf(entry, "%s %lu %ld %ld %ld %lu %lu %lu %lu %lu\n", assemblerVersion, context->source.size,
+                    hasObject ? (long)objectSize : -1L, hasAttributes ? (long)externSize : -1L,
+                    hasAttributes ? (long)entrySize : -1L, counts.symbols, counts.codeWords, counts.dataBytes,
+                    counts.fixups, counts.attributes);
+            fwrite(objectImage, 1, objectSize, entry);
+            fwrite(externImage, 1, externSize, entry);
+            fwrite(entryImage, 1, entrySize, entry);
+
+            /* A partial entry is never published */
+            if (fclose(entry) != 0 || rename(temporaryName, path) != 0)
+                remove(temporaryName);
+        }
+    }
+    free(temporaryName);
+    free(objectImage);
+    free(externImage);
+    free(entryImage);
+    free(path);
+}
+
+
+void countCacheOutcome(cacheStatistics *statistics, cacheOutcome outcome)
+{
+    if (outcome == cacheHit)
+        statistics->hits++;
+    else if (outcome == cacheMiss)
+        statistics->misses++;
+}
+
+
+bool isCacheEntryName(const char *name)
+{
+    int i;
+
+    for (i = 0; i < cacheKeyLength; i++)
+    {
+        if (!((name[i] >= '0' && name[i] <= '9') || (name[i] >= 'a' && name[i] <= 'f')))
+            return FALSE;
+    }
+    return name[i] == '\0';
+}
+
+
+int compareCacheEntries(const void *first, const void *second)
+{
+    const cacheEntryInfo *firstEntry = (const cacheEntryInfo *) first, *secondEntry = (const cacheEntryInfo *) second;
+
+    if (firstEntry->lastUse != secondEntry->lastUse)
+        return (firstEntry->lastUse < secondEntry->lastUse) ? -1 : 1;
+    return strcmp(firstEntry->name, secondEntry->name);
+}
+
+
+void trimCache(const assemblerOptions *options, cacheStatistics *statistics)
+{
+    DIR *directory;
+    struct dirent *directoryEntry;
+    struct stat entryStatus;
+    cacheEntryInfo *entries = NULL;
+    unsigned long capacity = 0, count = 0, i;
+    unsigned long sizeLimit = (unsigned long)options->cacheSizeLimit * 1024UL * 1024UL;
+    char *path;
+
+    directory = opendir(options->cacheDirectory);
+    if (directory == NULL)
+        return;
+
+    /* Collects the entries of the cache, with their sizes and the time they were last used */
+    statistics->size = 0;
+    while ((directoryEntry = readdir(directory)) != NULL)
+    {
+        if (!isCacheEntryName(directoryEntry->d_name))
+            continue;
+        path = cacheEntryPath(options->cacheDirectory, directoryEntry->d_name);
+        if (stat(path, &entryStatus) == 0)
+        {
+            if (count == capacity)
+            {
+                capacity = (capacity == 0) ? 64 : capacity * 2;
+                entries = reallocWithCheck(entries, capacity * sizeof(cacheEntryInfo));
+            }
+            strcpy(entries[count].name, directoryEntry->d_name);
+            entries[count].lastUse = (long)entryStatus.st_mtime;
+            entries[count].size = (unsigned long)entryStatus.st_size;
+            statistics->size += entries[count++].size;
+        }
+        free(path);
+    }
+    closedir(directory);
+
+    /* Evicts the least recently used entries first */
+    if (statistics->size > sizeLimit)
+    {
+        qsort(entries, count, sizeof(cacheEntryInfo), compareCacheEntries);
+        for (i = 0; i < count && statistics->size > sizeLimit; i++)
+        {
+            path = cacheEntryPath(options->cacheDirectory, entries[i].name);
+            if (remove(path) == 0)
+            {
+                statistics->size -= entries[i].size;
+                statistics->evictions++;
+            }
+            free(path);
+        }
+        count -= (unsigned long)statistics->evictions;
+    }
+    statistics->entries = (long)count;
+    free(entries);
+}
+
+
+void printCacheStatistics(const cacheStatistics *statistics, FILE *fd)
+{
+    fprintf(fd, "Cache: %ld hits, %ld misses, %ld evictions, %ld entries (%lu bytes).\n", statistics->hits,
+            statistics->misses, statistics->evictions, statistics->entries, statistics->size);
+}
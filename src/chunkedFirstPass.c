@@ -0,0 +1,209 @@
+/* For 'open_memstream' and the POSIX threads */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/chunkedFirstPass.h"
+#include "../include/firstPass.h"
+#include "../include/tables.h"
+#include "../include/arena.h"
+#include "../include/general.h"
+
+
+void splitSource(const sourceBuffer *source, firstPassChunk *chunks, int numOfChunks)
+{
+    unsigned long start = 0, end;
+    long lineNumber = 1;
+    const char *lineEnd;
+    int i;
+
+    for(i = 0; i < numOfChunks; i++)
+    {
+        /* The chunk ends at the end of the line its share of the source ends in */
+        end = (i == numOfChunks - 1) ? source->size : source->size / numOfChunks * (i + 1);
+        if(end < start)
+            end = start;
+        else if(end > start && end < source->size)
+        {
+            lineEnd = memchr(source->content + end - 1, '\n', source->size - end + 1);
+            end = (unsigned long)(lineEnd - source->content) + 1;
+        }
+
+        chunks[i].context.source.content = source->content + start;
+        chunks[i].context.source.size = end - start;
+        chunks[i].firstLineNumber = lineNumber;
+        for(lineEnd = source->content + start; (lineEnd = memchr(lineEnd, '\n', source->content + end - lineEnd)) != NULL;
+            lineEnd++)
+            chunks[i].numOfLines++;
+        lineNumber += chunks[i].numOfLines;
+        start = end;
+    }
+}
+
+
+void *firstPassChunkWorker(void *chunk)
+{
+    firstPassChunk *current = (firstPassChunk *) chunk;
+    FILE *errors = openMemoryStream(&current->diagnostics, &current->diagnosticsSize);
+
+    current->context.errors = errors;
+    current->IC = ICInitialValue;
+    current->result = firstPassFrom(&current->line, current->firstLineNumber, &current->IC, &current->context);
+    current->context.errors = NULL;
+    fclose(errors);
+    return NULL;
+}
+
+
+bool mergeChunkSymbols(assemblyContext *context, firstPassChunk *chunks, int numOfChunks)
+{
+    symbolTable symbol, next, defined;
+    long codeBase = 0, dataBase = 0;
+    int i;
+
+    for(i = 0; i < numOfChunks; i++)
+    {
+        for(symbol = chunks[i].context.symbolTab.head; symbol != NULL; symbol = next)
+        {
+            next = symbol->next;
+            if((defined = findSymbol(&context->symbolTab, symbol->name)) != NULL)
+            {
+                /* A serial pass reports the later definition, only a repeated '.extern' is allowed */
+                if(defined->isExternal && symbol->isExternal)
+                    continue;
+                free(context->symbolTab.slots);
+                memset(&context->symbolTab, 0, sizeof(symbolHashTable));
+                return FALSE;
+            }
+
+            if(symbol->type == code)
+                symbol->value += codeBase;
+            else if(symbol->type == data)
+                symbol->value += dataBase;
+            insertSymbol(&context->symbolTab, symbol);
+        }
+        codeBase += chunks[i].IC - ICInitialValue;
+        dataBase += (long)chunks[i].context.dataImage.size;
+    }
+    return TRUE;
+}
+
+
+void mergeChunkTables(assemblyContext *context, firstPassChunk *chunks, int numOfChunks, long *IC)
+{
+    unsigned long codeCount = 0, dataSize = 0, fixupCount = 0, entryCount = 0, j;
+    assemblyContext *chunk;
+    int i;
+
+    for(i = 0; i < numOfChunks; i++)
+    {
+        codeCount += chunks[i].context.codeImage.count;
+        dataSize += chunks[i].context.dataImage.size;
+        fixupCount += chunks[i].context.fixups.count;
+        entryCount += chunks[i].context.entries.count;
+    }
+    /* The tables of the file are still empty, they're allocated once at their final sizes */
+    context->codeImage.entries = reallocWithCheck(context->codeImage.entries, (codeCount + 1) * sizeof(codeImageEntry));
+    context->codeImage.capacity = codeCount + 1;
+    reserveDataBytes(&context->dataImage, dataSize);
+    context->fixups.entries = reallocWithCheck(context->fixups.entries, (fixupCount + 1) * sizeof(fixupEntry));
+    context->fixups.capacity = fixupCount + 1;
+    context->entries.entries = reallocWithCheck(context->entries.entries, (entryCount + 1) * sizeof(deferredEntry));
+    context->entries.capacity = entryCount + 1;
+
+    for(i = 0; i < numOfChunks; i++)
+    {
+        chunk = &chunks[i].context;
+
+        /* The instructions and the fixups of the chunk move by the instructions of the chunks before it */
+        for(j = 0; j < chunk->codeImage.count; j++)
+        {
+            context->codeImage.entries[context->codeImage.count + j] = chunk->codeImage.entries[j];
+            context->codeImage.entries[context->codeImage.count + j].address += (int)(context->codeImage.count * 4);
+        }
+        for(j = 0; j < chunk->fixups.count; j++)
+        {
+            context->fixups.entries[context->fixups.count + j] = chunk->fixups.entries[j];
+            context->fixups.entries[context->fixups.count + j].codeIndex += context->codeImage.count;
+        }
+        context->codeImage.count += chunk->codeImage.count;
+        context->fixups.count += chunk->fixups.count;
+
+        if(chunk->dataImage.size != 0)
+            memcpy(context->dataImage.bytes + context->dataImage.size, chunk->dataImage.bytes, chunk->dataImage.size);
+        context->dataImage.size += chunk->dataImage.size;
+        if(chunk->entries.count != 0)
+            memcpy(context->entries.entries + context->entries.count, chunk->entries.entries,
+                   chunk->entries.count * sizeof(deferredEntry));
+        context->entries.count += chunk->entries.count;
+
+        /* The names of the labels, the fixups and the entries were allocated from the arena of the chunk */
+        adoptArena(&context->memory, &chunk->memory);
+        if(chunks[i].diagnosticsSize != 0)
+            fwrite(chunks[i].diagnostics, 1, chunks[i].diagnosticsSize, context->errors);
+        context->reportedLines += chunk->reportedLines;
+    }
+    *IC = ICInitialValue + (long)context->codeImage.count * 4;
+}
+
+
+void freeChunks(firstPassChunk *chunks, int numOfChunks)
+{
+    int i;
+
+    for(i = 0; i < numOfChunks; i++)
+    {
+        /* The source of the chunk is a view into the source of the file */
+        chunks[i].context.source.content = NULL;
+        freeAssemblyContext(&chunks[i].context);
+        free(chunks[i].diagnostics);
+    }
+    free(chunks);
+}
+
+
+state chunkedFirstPass(newLine *line, long *IC, assemblyContext *context)
+{
+    long numOfChunks = (long)(context->source.size / (unsigned long)context->options->firstPassChunkSize);
+    firstPassChunk *chunks;
+    state process = VALID;
+    int i;
+
+    if(numOfChunks > context->options->firstPassThreads)
+        numOfChunks = context->options->firstPassThreads;
+    if(numOfChunks < 2)
+        return firstPass(line, IC, context);
+
+    chunks = (firstPassChunk *) callocWithCheck(numOfChunks * sizeof(firstPassChunk));
+    splitSource(&context->source, chunks, (int)numOfChunks);
+    for(i = 0; i < numOfChunks; i++)
+    {
+        chunks[i].context.options = context->options;
+        chunks[i].line.sourceFileName = line->sourceFileName;
+        /* A chunk whose thread can't be created is parsed by the calling thread */
+        chunks[i].threadStarted = (pthread_create(&chunks[i].thread, NULL, firstPassChunkWorker, &chunks[i]) == 0);
+        if(!chunks[i].threadStarted)
+            firstPassChunkWorker(&chunks[i]);
+    }
+    for(i = 0; i < numOfChunks; i++)
+    {
+        if(chunks[i].threadStarted)
+            pthread_join(chunks[i].thread, NULL);
+        if(chunks[i].result == INVALID)
+            process = INVALID;
+    }
+
+    /* Labels that clash between chunks are reported by a serial pass, exactly as a serial run reports them */
+    if(!mergeChunkSymbols(context, chunks, (int)numOfChunks))
+    {
+        freeChunks(chunks, (int)numOfChunks);
+        return firstPass(line, IC, context);
+    }
+    mergeChunkTables(context, chunks, (int)numOfChunks, IC);
+    line->number = chunks[numOfChunks - 1].firstLineNumber + chunks[numOfChunks - 1].numOfLines;
+    line->content = NULL;
+
+    freeChunks(chunks, (int)numOfChunks);
+    return process;
+}
@@ -1,157 +1,134 @@
 
 /* For 'free' function */
 #include <stdlib.h>
+/* For 'memcpy' function */
+#include <string.h>
 /* For 'getFileFullName', 'openFile' functions and <stdio.h> functions */
 #include "../include/files.h"
-/* For 'freeTables' function */
-#include "../include/tables.h"
+#include "../include/outputWriter.h"
+#include "../include/general.h"
+/* For timing the output files ("--stats") */
+#include "../include/statistics.h"
 
 
-void exportDWByte(void* currentVariable, int printedVariableBytes, FILE* fileDescriptor)
+void exportDataImage(dataImageTable *dataImage, outputWriter *writer, long startingAddress)
 {
-    /* If we need to print the 0-7 bits of the variable */
-    if(printedVariableBytes == 0)
-        fprintf(fileDescriptor,"%02X ", ((*(int *)currentVariable)) & 0xFF);
-        /* If we need to print the 8-15 bits of the variable */
-    else if(printedVariableBytes == 1)
-        fprintf(fileDescriptor,"%02X ", ((*(int *)currentVariable) >> 8) & 0xFF);
-        /* If we need to print the 16-23 bits of the variable */
-    else if(printedVariableBytes == 2)
-        fprintf(fileDescriptor,"%02X ", ((*( int *)currentVariable) >> 16) & 0xFF);
-        /* If we need to print the 23-31 bits of the variable */
-    else if(printedVariableBytes == 3)
-        fprintf(fileDescriptor,"%02X ", ((*(int *)currentVariable) >> 24) & 0xFF);
-}
-
-
-void exportDHByte(void* currentVariable, int printedVariableBytes, FILE* fileDescriptor)
-{
-    /* If we need to print the 0-7 bits of the variable */
-    if(printedVariableBytes == 0)
-        fprintf(fileDescriptor,"%02X ", (*(short *)currentVariable) & 0xFF);
-
-    /* If we need to print the 8-15 bits of the variable */
-    if(printedVariableBytes == 1)
-        fprintf(fileDescriptor,"%02X ", ((*(short *)currentVariable) >> 8) & 0xFF);
-}
-
-
-void exportDataByteByType(dataTable currentEntry, int printedVariableBytes, int currentIndex, FILE *fileDescriptor)
-{
-    /* This is a pointer referencing the current variable within the data to be exported */
-    void *currentVariable;
-
-    /* The memory location pointed to by 'currentVariable' varies according to the type of directive. */
-    if(currentEntry->dataType == DB || currentEntry->dataType == ASCIZ)
-    {
-        currentVariable = &((char *)currentEntry->data)[currentIndex];
-        fprintf(fileDescriptor,"%02X ", (*(char *)currentVariable) & 0xFF);
-    }
-    else if(currentEntry->dataType == DH)
-    {
-        currentVariable = &((short *)currentEntry->data)[currentIndex];
-        exportDHByte(currentVariable, printedVariableBytes, fileDescriptor);
-    }
-    else if(currentEntry->dataType == DW)
-    {
-        currentVariable = &((int *)currentEntry->data)[currentIndex];
-        exportDWByte(currentVariable, printedVariableBytes, fileDescriptor);
-    }
-}
+    unsigned long currentByte;
 
+    /* First prints the starting address of the data image */
+    writeDecimal(writer, startingAddress, 4);
+    writeChar(writer, ' ');
 
-void exportDataVariable(dataTable currentEntry,long *currentAddress,int currentIndex,FILE *fileDescriptor, long *totalPrintedBytes)
-{
-    /* The number of bytes printed from the current variable */
-    int printedVariableBytes = 0;
-
-    while(printedVariableBytes < currentEntry->variableSize)
+    for(currentByte = 0; currentByte < dataImage->size; currentByte++)
     {
-        exportDataByteByType(currentEntry, printedVariableBytes, currentIndex, fileDescriptor);
-        printedVariableBytes++;
-        (*totalPrintedBytes)++;
+        writeHexByte(writer, dataImage->bytes[currentByte]);
+        writeChar(writer, ' ');
         /* Starts a new line every time 4 bytes are printed */
-        if((*totalPrintedBytes) % 4 == 0)
+        if((currentByte + 1) % 4 == 0)
         {
             /* Increases the new line address by 4 - As the number of bytes printed in the previous line */
-            (*currentAddress) += 4;
+            startingAddress += 4;
             /* Every new line, first, prints the new line address */
-            fprintf(fileDescriptor,"\n%04lu ", *currentAddress);
+            writeChar(writer, '\n');
+            writeDecimal(writer, startingAddress, 4);
+            writeChar(writer, ' ');
         }
     }
 }
 
 
-void exportDataEntry(dataTable currentEntry, long *currentAddress, long *totalPrintedBytes, FILE *fileDescriptor)
+void exportCodeEntries(const codeImageEntry *entries, unsigned long count, outputWriter *writer)
 {
-    int currentIndex;
+    /* w - binary representation of the current data from the code image */
+    unsigned int w;
+    const codeImageEntry *codeEntry, *lastEntry;
 
-    for(currentIndex = 0; currentIndex < currentEntry->numOfVariables; currentIndex++)
-        exportDataVariable(currentEntry, currentAddress, currentIndex, fileDescriptor, totalPrintedBytes);
-}
+    lastEntry = entries + count;
 
+    for(codeEntry = entries; codeEntry != lastEntry; codeEntry++)
+    {
+        /* The bit fields of all the instruction types start at the beginning of the union */
+        memcpy(&w, &codeEntry->data, sizeof(w));
 
-void exportDataImage(dataTable dataImage, FILE *fileDescriptor, long startingAddress)
-{
-    dataTable currentEntry;
-    long totalPrintedBytes = 0;
+        /* Print Format: 'address' '0-7 bits' '15-8 bits' '23-16 bits' '31-24 bits' */
+        writeDecimal(writer, codeEntry->address, 4);
+        writeChar(writer, ' ');
+        writeHexByte(writer, (unsigned char)(w & 0xFF));
+        writeChar(writer, ' ');
+        writeHexByte(writer, (unsigned char)(w >> 8 & 0xFF));
+        writeChar(writer, ' ');
+        writeHexByte(writer, (unsigned char)(w >> 16 & 0xFF));
+        writeChar(writer, ' ');
+        writeHexByte(writer, (unsigned char)(w >> 24 & 0xFF));
+        writeChar(writer, '\n');
+    }
+}
 
-    /* First prints the starting address of the data image */
-    fprintf(fileDescriptor,"%04lu ", startingAddress);
 
-    for(currentEntry = dataImage; currentEntry != NULL; currentEntry = currentEntry->next)
-        exportDataEntry(currentEntry, &startingAddress, &totalPrintedBytes, fileDescriptor);
+void exportCodeImage(codeImageTable *codeImage, outputWriter *writer)
+{
+    exportCodeEntries(codeImage->entries, codeImage->count, writer);
 }
 
 
-void exportCodeImage(codeTable codeImage, FILE *fd)
+void writeObjectFileWithPrefix(FILE *fileDescriptor, const char *codeText, unsigned long codeTextSize,
+                               unsigned long formattedEntries, codeImageTable *codeImage, dataImageTable *dataImage,
+                               long ICF, long DCF)
 {
-    /* w - binary representation of the current data from the code image */
-    unsigned int *w, b;
-    codeTable codeEntry;
-
-    /* hexadecimal representation for byte of 1's in binary */
-    b = 0xFF;
+    /* The object file is formatted into the buffer of the writer, it's large so it's kept out of the stack */
+    outputWriter *writer = (outputWriter *) callocWithCheck(sizeof(outputWriter));
+
+    /*
+      The first line indicates the sizes of the instruction and data images.
+      The data image, starting from address 100, is sized by subtracting 100 from its final address.
+    */
+    initOutputWriter(writer, fileDescriptor);
+    writeDecimal(writer, ICF - 100, 1);
+    writeChar(writer, ' ');
+    writeDecimal(writer, DCF, 1);
+    writeChar(writer, '\n');
+    /* The lines of the instructions that were already formatted are written as they are */
+    writeBlock(writer, codeText, codeTextSize);
+    exportCodeEntries(codeImage->entries + formattedEntries, codeImage->count - formattedEntries, writer);
+    exportDataImage(dataImage, writer, ICF);
+
+    flushOutputWriter(writer);
+    free(writer);
+}
 
-    for(codeEntry = codeImage; codeEntry != NULL; codeEntry = codeEntry->next)
-    {
-        /* In each type of instruction, a different bit field is filled */
-        if(codeEntry->type == R)
-            w = (unsigned int *)&codeEntry->data->typeR;
-        else if(codeEntry->type == I)
-            w = (unsigned int *)&codeEntry->data->typeI;
-        else if(codeEntry->type == J)
-            w = (unsigned int *)&codeEntry->data->typeJ;
 
-        /* Print Format: 'address' '0-7 bits' '15-8 bits' '23-16 bits' '31-24 bits' */
-        fprintf(fd,"%04d %02X %02X %02X %02X\n",codeEntry->address, (*w) & b, (*w)>>8 & b, (*w)>>16 & b, (*w)>>24 & b);
-    }
+void writeObjectFile(FILE *fileDescriptor, codeImageTable *codeImage, dataImageTable *dataImage, long ICF, long DCF)
+{
+    writeObjectFileWithPrefix(fileDescriptor, NULL, 0, 0, codeImage, dataImage, ICF, DCF);
 }
 
 
-void createObjectFile(char *fileName, codeTable codeImage, dataTable dataImage, long ICF, long DCF)
+void createObjectFileWithPrefix(const char *fileName, const char *codeText, unsigned long codeTextSize,
+                                unsigned long formattedEntries, codeImageTable *codeImage, dataImageTable *dataImage,
+                                long ICF, long DCF, FILE *errors)
 {
     FILE *fileDescriptor;
     char *objectFileName;
 
     objectFileName = getFileFullName(fileName, ".ob");
     /* If filed creation succeeded */
-    if(openFile(&fileDescriptor, objectFileName, "w") == VALID)
+    if(openFile(&fileDescriptor, objectFileName, "w", errors) == VALID)
     {
-        /*
-          The first line indicates the sizes of the instruction and data images.
-          The data image, starting from address 100, is sized by subtracting 100 from its final address.
-        */
-        fprintf(fileDescriptor, "%ld %ld\n", ICF - 100, DCF);
-        exportCodeImage(codeImage, fileDescriptor);
-        exportDataImage(dataImage, fileDescriptor, ICF);
-
+        writeObjectFileWithPrefix(fileDescriptor, codeText, codeTextSize, formattedEntries, codeImage, dataImage,
+                                  ICF, DCF);
         fclose(fileDescriptor);
     }
     free(objectFileName);
 }
 
 
+void createObjectFile(const char *fileName, codeImageTable *codeImage, dataImageTable *dataImage, long ICF, long DCF,
+                      FILE *errors)
+{
+    createObjectFileWithPrefix(fileName, NULL, 0, 0, codeImage, dataImage, ICF, DCF, errors);
+}
+
+
 void exportToExtAndEntFiles(attributesTable attributesTab, FILE *externFileDescriptor, FILE  *entryFileDescriptor)
 {
     attributesTable currentEntry;
@@ -159,15 +136,15 @@ void exportToExtAndEntFiles(attributesTable attributesTab, FILE *externFileDescr
     /* Exports the current entry to the required file according to the type of the entry - external/entry */
     for(currentEntry = attributesTab; currentEntry != NULL; currentEntry = currentEntry->next)
     {
-        if(currentEntry->type == external)
+        if(currentEntry->type == external && externFileDescriptor != NULL)
             fprintf(externFileDescriptor, "%s %04ld\n", currentEntry->name, currentEntry->address);
-        else if(currentEntry->type == entry)
+        else if(currentEntry->type == entry && entryFileDescriptor != NULL)
             fprintf(entryFileDescriptor, "%s %04ld\n", currentEntry->name, currentEntry->address);
     }
 }
 
 
-void createExtAndEntFiles(char *fileName, attributesTable attributesTab)
+void createExtAndEntFiles(const char *fileName, attributesTable attributesTab, FILE *errors)
 {
     FILE *externFileDescriptor, *entryFileDescriptor;
     char *externFileName, *entryFileName;
@@ -176,31 +153,45 @@ void createExtAndEntFiles(char *fileName, attributesTable attributesTab)
     /* Obtains the names of the files to be created and creates them */
     externFileName = getFileFullName(fileName, ".ext");
     entryFileName = getFileFullName(fileName, ".ent");
-    externOpen = openFile(&externFileDescriptor, externFileName, "w");
-    entryOpen = openFile(&entryFileDescriptor, entryFileName, "w");
+    externOpen = openFile(&externFileDescriptor, externFileName, "w", errors);
+    entryOpen = openFile(&entryFileDescriptor, entryFileName, "w", errors);
 
     if(externOpen == VALID && entryOpen == VALID) /* If succeeded to create both files */
-    {
         exportToExtAndEntFiles(attributesTab, externFileDescriptor, entryFileDescriptor);
+    if(externOpen == VALID)
         fclose(externFileDescriptor);
+    if(entryOpen == VALID)
         fclose(entryFileDescriptor);
-    }
     free(externFileName);
     free(entryFileName);
 }
 
 
-void createOutputFiles(char *fileName, codeTable codeImage, dataTable dataImage, attributesTable attributesTab,
-                       long ICF, long DCF)
+void createOutputFilesWithPrefix(const char *fileName, assemblyContext *context, const char *codeText,
+                                 unsigned long codeTextSize, unsigned long formattedEntries)
 {
+    double start;
+
     /* If there is data to insert into 'ext'/'ent' files */
-    if(attributesTab != NULL)
-        createExtAndEntFiles(fileName, attributesTab);
+    if(context->attributesTab != NULL)
+    {
+        start = phaseStart(context);
+        createExtAndEntFiles(fileName, context->attributesTab, context->errors);
+        phaseEnd(context, attributesFilesPhase, start);
+    }
 
     /* If there is data to insert into 'ob' file */
-    if(dataImage != NULL || codeImage != NULL)
-        createObjectFile(fileName, codeImage, dataImage, ICF, DCF);
+    if(context->dataImage.size != 0 || context->codeImage.count != 0)
+    {
+        start = phaseStart(context);
+        createObjectFileWithPrefix(fileName, codeText, codeTextSize, formattedEntries, &context->codeImage,
+                                   &context->dataImage, context->ICF, context->DCF, context->errors);
+        phaseEnd(context, objectFilePhase, start);
+    }
+}
 
-    /* Frees the data that was used to create the output files */
-    freeTables(codeImage, dataImage, attributesTab);
-}
\ No newline at end of file
+
+void createOutputFiles(const char *fileName, assemblyContext *context)
+{
+    createOutputFilesWithPrefix(fileName, context, NULL, 0, 0);
+}
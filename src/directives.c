@@ -8,15 +8,19 @@
 #include "../include/labels.h"
 #include "../include/tables.h"
 #include "../include/lineHandling.h"
+#include "../include/reservedWords.h"
 
 
 void scanDirectiveName(const char *lineContent, char *directiveName, int *contentIndex)
 {
     int nameIndex = 0;
 
-    /* Scans the directive name */
-    while(!isWhiteSpace(lineContent[*contentIndex]))
-        directiveName[nameIndex++] = lineContent[(*contentIndex)++];
+    /* Scans the directive name, a name longer than the buffer is cut - it can't match any directive anyway */
+    for(; !isWhiteSpace(lineContent[*contentIndex]); (*contentIndex)++)
+    {
+        if(nameIndex < maxDirectiveName - 1)
+            directiveName[nameIndex++] = lineContent[*contentIndex];
+    }
 
     directiveName[nameIndex] = '\0'; /* End of string */
 }
@@ -63,22 +67,14 @@ directiveWord *getReservedDirectives(int *numberOfDirectives)
 state searchDirective(newLine *line, directiveWord  *directiveToken)
 {
     /* numberOfDirectives = The total number of the reserved directives */
-    int i, numberOfDirectives;
-    directiveWord *directive;
-
-    directive = getReservedDirectives(&numberOfDirectives);
+    int numberOfDirectives;
+    directiveWord *directive = getReservedDirectives(&numberOfDirectives);
+    const reservedWord *word = findReservedWord(directiveToken->name);
 
-    /* Searches for a match between the current word and one of the directives name */
-    for(i = 0; i < numberOfDirectives; i++)
-    {
-        /* if a match is found saves the matched directive dataType and stops */
-        if(strcmp(directiveToken->name, directive[i].name) == 0)
-        {
-            directiveToken->type = directive[i].type;
-            break;
-        }
-    }
-    if(i == numberOfDirectives) /* If no match was found */
+    /* If a match is found saves the matched directive dataType */
+    if(word != NULL && word->type == reservedDirective)
+        directiveToken->type = directive[word->index].type;
+    else
         line-> error = addError("unrecognized directive word");
 
     return currentState(line);
@@ -93,27 +89,11 @@ bool isDataStorageDirective(directiveType type)
 }
 
 
-void enterVariableByType(directiveType type, void *dataArray, int *arrayIndex, char *numString)
-{
-    int numValue;
-    numValue = atoi(numString);
-
-    if(type == DB)
-        ((char *)dataArray)[*arrayIndex] = (char)numValue;  /* '.db' directive contain 1 byte variables */
-    else if(type == DH)
-        ((short *)dataArray)[*arrayIndex] = (short)numValue;  /* '.dh' directive contain 2 bytes variables */
-    else if(type == DW)
-        ((int *)dataArray)[*arrayIndex] = numValue;  /* '.dw' directive contain 4 bytes variables */
-
-	(*arrayIndex)++;
-}
-
-
-void scanDVariableToArray(const char *content, int index, directiveType type, void *dataArray)
+void scanDVariablesToImage(const char *content, int index, directiveType type, dataImageTable *dataImage)
 {
-    int i = 0, arrayIndex = 0;
-    /* Max length of any valid number from input */
-    char numString[max4BytesIntLength];
+    int i = 0;
+    /* Max length of any valid number from input, including the sign and the end of string */
+    char numString[max4BytesIntLength + 2];
 
     /* Scans all the numbers to the end of the line  */
 	while(content[index] != '\n')
@@ -123,53 +103,49 @@ void scanDVariableToArray(const char *content, int index, directiveType type, vo
 
 		/* Scans the number encountered */
 		while(!isWhiteSpace(content[index]) && content[index] != ',')
-			numString[i++] = (char)(content[index++] + '\0');
+			numString[i++] = content[index++];
 
         /* End of string */
 		numString[i] = '\0';
 
-		/* If a number has been found */
+		/* If a number has been found, appends it to the data image according to the directive type */
 		if(i != 0)
-			enterVariableByType(type, dataArray, &arrayIndex, numString);
+			appendDataVariable(dataImage, type, atol(numString));
 		i = 0;
 	}
 }
 
 
-void scanAscizVariableToArray(const char *content, int index, char *dataArray)
+void scanAscizVariableToImage(const char *content, int index, dataImageTable *dataImage)
 {
-    int arrayIndex = 0;
-
     /* Progress until encounter the beginning of the string */
     for(; content[index] != '"';index++);
     index++;
     /* Progress until encounter the end of the string */
     while(content[index] != '"')
-        dataArray[arrayIndex++] = content[index++];
+        appendDataByte(dataImage, content[index++]);
 
     /* End of string */
-    dataArray[arrayIndex] = '\0';
+    appendDataByte(dataImage, '\0');
 }
 
 
-void createDataArray(directiveType type, void **dataArray, int numOfVariables, const char *content, int index)
+void addToDataImage(directiveType type, int numOfVariables, const char *content, int index, dataImageTable *dataImage)
 {
-    /* '.db'/'.asciz' directives contain 1 byte variables */
+    /* Makes room for all the variables of the line at once */
     if(type == DB || type == ASCIZ)
-        *dataArray = callocWithCheck(sizeof(char) * numOfVariables);
-    /* '.dh' directive contain 2 bytes variables */
+        reserveDataBytes(dataImage, numOfVariables);
     else if(type == DH)
-        *dataArray = callocWithCheck(sizeof(short) * numOfVariables);
-    /* '.dw' directive contain 4 bytes variables */
+        reserveDataBytes(dataImage, numOfVariables * 2);
     else if(type == DW)
-        *dataArray = callocWithCheck(sizeof(int) * numOfVariables);
+        reserveDataBytes(dataImage, numOfVariables * 4);
 
     if(type == DH || type == DB || type == DW)
-        scanDVariableToArray(content, index, type, *dataArray);
+        scanDVariablesToImage(content, index, type, dataImage);
 
      /* The scan for ".asciz" directive different from the other directive types scan */
     else if(type == ASCIZ)
-        scanAscizVariableToArray(content, index, *dataArray);
+        scanAscizVariableToImage(content, index, dataImage);
 }
 
 
@@ -242,7 +218,7 @@ void checkDirectiveByType(newLine *line, directiveType type, int index, int *num
 }
 
 
-state dataStorageDirective(newLine *line, directiveType type, int index, int *numOfVariables, void **dataArray)
+state dataStorageDirective(newLine *line, directiveType type, int index, int *numOfVariables)
 {
     /* If no operands appear after the directive word. */
     if(emptyLine(line->content, index))
@@ -255,49 +231,49 @@ state dataStorageDirective(newLine *line, directiveType type, int index, int *nu
     else
         checkDirectiveByType(line, type, index, numOfVariables);
 
-	/* If directive line is valid, Produces an array that contains the variables that appears in the line */
-    if(currentState(line) == VALID)
-        createDataArray(type, dataArray, *numOfVariables, line->content, index);
-
     return currentState(line);
 }
 
 /* Process an input line that represent data storage directive */
-void processDataStorageDirective(char *label, newLine *line, directiveType type, bool labelSet, int index, symbolTable *symTable, dataTable *dataImage, long *DC)
+void processDataStorageDirective(char *label, newLine *line, directiveType type, bool labelSet, int index, assemblyContext *context)
 {
     int numOfDataVariables = 0; /* The number of variables the current directive accepts  */
-    void *dataArray = NULL;
 
     /* Checks if the line syntax and operands are valid according to the directive dataType */
-    if(dataStorageDirective(line, type, index, &numOfDataVariables, &dataArray) == VALID)
+    if(dataStorageDirective(line, type, index, &numOfDataVariables) == VALID)
     {
         /* If there is a label in the start of the line that isn't defined, add it to the symbol table */
         if(labelSet == TRUE)
         {
-            if(labelIsDefined(label, line, *symTable, data) == FALSE)
-                addToSymbolTable(symTable, label, *DC, data);
+            if(labelIsDefined(label, line, &context->symbolTab, data) == FALSE)
+                addToSymbolTable(&context->symbolTab, label, (long)context->dataImage.size, data, &context->memory);
         }
-        /* Adds the received data to the data image linked list and continues to the next line.*/
-		addToDataImage(type, numOfDataVariables, DC, dataArray, dataImage);
+        /* Appends the variables that appear in the line to the data image and continues to the next line.*/
+		addToDataImage(type, numOfDataVariables, line->content, index, &context->dataImage);
     }
 }
 
 
-void processDirective(directiveWord *directToken, bool labelSet, newLine *line, int *index, long *DC, symbolTable *symTab, dataTable *dImage, char *label)
+void processDirective(directiveWord *directToken, bool labelSet, newLine *line, int *index, assemblyContext *context, char *label)
 {
     if(searchDirective(line, directToken) == VALID)
     {
         /* Checks if the directive word is '.dh'/ '.dw'/ '.db'/ '.asciz' */
         if(isDataStorageDirective(directToken->type))
-            processDataStorageDirective(label, line, directToken->type, labelSet, *index, symTab, dImage, DC);
+            processDataStorageDirective(label, line, directToken->type, labelSet, *index, context);
 
-        /* If the directive is '.entry' skip it (this directive will be handled in the second pass)  */
+        /* The label of an '.entry' directive may be defined later in the file, it's marked as entry after the first pass */
+        if(directToken->type == ENTRY)
+        {
+            getLabelName(line->content, index, label);
+            addToDeferredEntries(&context->entries, label, line->number, &context->memory);
+        }
         if(directToken->type == EXTERN)
         {
             getLabelName(line->content, index, label);
             /*If the label isn't defined yet, add it to the symbol table as 'extern' */
-            if(labelIsValid(line,label) && !labelIsDefined(label, line, *symTab, external))
-                addToSymbolTable(symTab, label, 0, external);
+            if(labelIsValid(line,label) && !labelIsDefined(label, line, &context->symbolTab, external))
+                addToSymbolTable(&context->symbolTab, label, 0, external, &context->memory);
         }
     }
-}
\ No newline at end of file
+}
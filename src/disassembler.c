@@ -0,0 +1,573 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "../include/disassembler.h"
+#include "../include/instructions.h"
+#include "../include/linker.h"
+#include "../include/lineHandling.h"
+#include "../include/outputWriter.h"
+#include "../include/files.h"
+#include "../include/general.h"
+
+
+/* The value of every hexadecimal digit, -1 for any other character */
+static const signed char hexValues[256] = {
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, -1, -1, -1, -1, -1, -1,
+        -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+};
+
+
+void initDisassembler(disassembler *dis)
+{
+    int i, numOfInstructions;
+    const instructionWord *instruction = getReservedInstructions(&numOfInstructions);
+
+    /* The 'R' instructions share their opcode, they're told apart by their funct */
+    for(i = 0; i < numOfInstructions; i++)
+    {
+        if(instruction[i].opcode <= 1)
+            dis->functs[instruction[i].opcode][instruction[i].funct] = &instruction[i];
+        else
+            dis->opcodes[instruction[i].opcode] = &instruction[i];
+    }
+    dis->labelPrefixLength = 1;
+    dis->external.address = -1;
+}
+
+
+const instructionWord *decodeInstructionWord(const disassembler *dis, const codeType *data)
+{
+    if(data->typeR.opcode <= 1)
+        return (data->typeR.funct <= maxFunct) ? dis->functs[data->typeR.opcode][data->typeR.funct] : NULL;
+    return dis->opcodes[data->typeJ.opcode];
+}
+
+
+state parseObjectWordLine(newLine *line, long *address, unsigned char *bytes, int *numOfBytes)
+{
+    const unsigned char *content = (const unsigned char *)line->content;
+    unsigned long i = 0;
+    int high, low;
+
+    /* "address XX XX XX XX", as written by 'createObjectFile' */
+    *numOfBytes = 0;
+    if(!scanDecimal(line, &i, address))
+        line->error = addError("Invalid object file line, it must start with an address");
+
+    while(currentState(line) == VALID && i < line->length)
+    {
+        /* The lines of the data image end with a space */
+        if(content[i] == ' ' && i + 1 == line->length)
+            break;
+        high = (i + 1 < line->length) ? hexValues[content[i + 1]] : -1;
+        low = (i + 2 < line->length) ? hexValues[content[i + 2]] : -1;
+        if(content[i] != ' ' || high < 0 || low < 0 || (i + 3 < line->length && content[i + 3] != ' '))
+            line->error = addError("Invalid object file line, bytes must be 2 hexadecimal digits");
+        else if(*numOfBytes == 4)
+            line->error = addError("Invalid object file line, it holds more than 4 bytes");
+        else
+        {
+            bytes[(*numOfBytes)++] = (unsigned char)(high * 16 + low);
+            i += 3;
+        }
+    }
+    return currentState(line);
+}
+
+
+void noteLabelName(disassembler *dis, const char *name)
+{
+    int repeats = 0, i;
+
+    while(name[repeats] == syntheticLabelCharacter)
+        repeats++;
+    for(i = repeats; name[i] != '\0' && isdigit((unsigned char)name[i]); i++)
+        ;
+    if(repeats != 0 && i != repeats && name[i] == '\0' && repeats >= dis->labelPrefixLength)
+        dis->labelPrefixLength = repeats + 1;
+}
+
+
+int compareSymbolAddresses(const void *first, const void *second)
+{
+    const disassemblySymbol *firstSymbol = (const disassemblySymbol *)first;
+    const disassemblySymbol *secondSymbol = (const disassemblySymbol *)second;
+
+    if(firstSymbol->address != secondSymbol->address)
+        return (firstSymbol->address < secondSymbol->address) ? -1 : 1;
+    return strcmp(firstSymbol->name, secondSymbol->name);
+}
+
+
+int compareAddresses(const void *first, const void *second)
+{
+    long firstAddress = *(const long *)first, secondAddress = *(const long *)second;
+
+    return (firstAddress < secondAddress) ? -1 : (firstAddress > secondAddress);
+}
+
+
+state loadEntryLabels(disassembler *dis, const char *fileName)
+{
+    FILE *fileDescriptor = fopen(fileName, "r");
+    lineStream stream = {0};
+    newLine line = {0};
+    disassemblySymbol symbol;
+    unsigned long capacity = 0, i;
+
+    /* A program without '.entry' directives has no '.ent' file */
+    if(fileDescriptor == NULL)
+        return VALID;
+
+    openLineStream(&stream, fileDescriptor);
+    line.sourceFileName = fileName;
+    while(currentState(&line) == VALID && nextStreamLine(&stream, &line))
+    {
+        line.number++;
+        if(parseSymbolLine(&line, symbol.name, &symbol.address) == INVALID)
+            break;
+        if(dis->numOfEntries == capacity)
+        {
+            capacity = (capacity == 0) ? deferredEntriesInitialCapacity : capacity * 2;
+            dis->entries = reallocWithCheck(dis->entries, capacity * sizeof(disassemblySymbol));
+        }
+        dis->entries[dis->numOfEntries++] = symbol;
+        noteLabelName(dis, symbol.name);
+        writeString(dis->writer, "\t.entry ");
+        writeString(dis->writer, symbol.name);
+        writeChar(dis->writer, '\n');
+    }
+    closeLineStream(&stream);
+    if(currentState(&line) == INVALID)
+    {
+        printLineError(&line, dis->errors);
+        dis->errorCount++;
+        return INVALID;
+    }
+
+    qsort(dis->entries, dis->numOfEntries, sizeof(disassemblySymbol), compareSymbolAddresses);
+    /* A line holds one label at most, so two labels at one address can't be written as source */
+    for(i = 1; i < dis->numOfEntries; i++)
+    {
+        if(dis->entries[i].address == dis->entries[i - 1].address)
+        {
+            fprintf(dis->errors, "Error! file '%s': the labels '%s' and '%s' share the address %04ld.\n", fileName,
+                    dis->entries[i - 1].name, dis->entries[i].name, dis->entries[i].address);
+            dis->errorCount++;
+        }
+    }
+    return (dis->errorCount == 0) ? VALID : INVALID;
+}
+
+
+state writeExternDirectives(disassembler *dis, const char *fileName)
+{
+    FILE *fileDescriptor = fopen(fileName, "r");
+    newLine line = {0};
+    char previousName[maxLabelLength + 1] = "";
+    disassemblySymbol symbol;
+    long previousAddress = -1;
+
+    /* A program without external references has no '.ext' file */
+    dis->external.address = -1;
+    if(fileDescriptor == NULL)
+        return VALID;
+
+    openLineStream(&dis->externals, fileDescriptor);
+    line.sourceFileName = fileName;
+    while(currentState(&line) == VALID && nextStreamLine(&dis->externals, &line))
+    {
+        line.number++;
+        if(parseSymbolLine(&line, symbol.name, &symbol.address) == INVALID)
+            break;
+        /* The references are matched with the code as both are read, so they must follow the order of the code */
+        if(symbol.address <= previousAddress)
+            line.error = addError("The external references must be sorted by address, like the assembler writes them");
+        else if(strcmp(symbol.name, previousName) != 0)
+        {
+            noteLabelName(dis, symbol.name);
+            writeString(dis->writer, "\t.extern ");
+            writeString(dis->writer, symbol.name);
+            writeChar(dis->writer, '\n');
+            strcpy(previousName, symbol.name);
+        }
+        previousAddress = symbol.address;
+    }
+    if(currentState(&line) == INVALID)
+    {
+        printLineError(&line, dis->errors);
+        dis->errorCount++;
+        return INVALID;
+    }
+
+    /* The file is read again, along with the code */
+    fseek(fileDescriptor, 0, SEEK_SET);
+    openLineStream(&dis->externals, fileDescriptor);
+    return nextExternalReference(dis);
+}
+
+
+state nextExternalReference(disassembler *dis)
+{
+    newLine line = {0};
+
+    dis->external.address = -1;
+    if(dis->externals.fd == NULL || !nextStreamLine(&dis->externals, &line))
+        return VALID;
+    /* The lines were checked once the directives were written */
+    return parseSymbolLine(&line, dis->external.name, &dis->external.address);
+}
+
+
+state collectTargets(disassembler *dis, lineStream *stream)
+{
+    newLine line = {0};
+    long address, expectedAddress = ICInitialValue, target;
+    unsigned long capacity = 0, i, unique;
+    unsigned char bytes[4];
+    int numOfBytes;
+    unsigned int word;
+    codeType data;
+    const instructionWord *instruction;
+
+    line.sourceFileName = dis->fileName;
+    line.number = 1;
+    while(currentState(&line) == VALID && nextStreamLine(stream, &line))
+    {
+        line.number++;
+        if(parseObjectWordLine(&line, &address, bytes, &numOfBytes) == INVALID)
+            break;
+        /* The object file of a program without data ends with the address of the data and no bytes */
+        if(address != expectedAddress || (numOfBytes == 0 && address != ICInitialValue + dis->codeSize + dis->dataSize))
+            line.error = addError("Invalid object file line, the addresses must follow each other");
+        else if(address < ICInitialValue + dis->codeSize && numOfBytes != 4)
+            line.error = addError("Invalid object file line, the code image is made of whole 4 bytes words");
+        expectedAddress += numOfBytes;
+        if(currentState(&line) == INVALID || address >= ICInitialValue + dis->codeSize)
+            continue;
+
+        /* The targets of the branches are relative, the targets of 'jmp'/'la'/'call' are absolute */
+        word = (unsigned int)bytes[0] | (unsigned int)bytes[1] << 8 | (unsigned int)bytes[2] << 16 |
+               (unsigned int)bytes[3] << 24;
+        memcpy(&data, &word, sizeof(word));
+        instruction = decodeInstructionWord(dis, &data);
+        target = -1;
+        if(instruction != NULL && instruction->opcode >= 15 && instruction->opcode <= 18)
+            target = address + data.typeI.immed;
+        else if(instruction != NULL && instruction->type == J && data.typeJ.reg == 0 && data.typeJ.address != 0)
+            target = (long)data.typeJ.address;
+        if(target == -1)
+            continue;
+
+        if(dis->numOfTargets == capacity)
+        {
+            capacity = (capacity == 0) ? fixupTableInitialCapacity : capacity * 2;
+            dis->targets = reallocWithCheck(dis->targets, capacity * sizeof(long));
+        }
+        dis->targets[dis->numOfTargets++] = target;
+    }
+
+    if(currentState(&line) == VALID && expectedAddress != ICInitialValue + dis->codeSize + dis->dataSize)
+        line.error = addError("The object file doesn't hold the number of bytes its header declares");
+    if(currentState(&line) == INVALID)
+    {
+        printLineError(&line, dis->errors);
+        dis->errorCount++;
+        return INVALID;
+    }
+
+    if(dis->numOfTargets != 0)
+    {
+        qsort(dis->targets, dis->numOfTargets, sizeof(long), compareAddresses);
+        for(i = 1, unique = 1; i < dis->numOfTargets; i++)
+            if(dis->targets[i] != dis->targets[unique - 1])
+                dis->targets[unique++] = dis->targets[i];
+        dis->numOfTargets = unique;
+    }
+    return VALID;
+}
+
+
+const char *findEntryLabel(const disassembler *dis, long address)
+{
+    unsigned long low = 0, high = dis->numOfEntries, middle;
+
+    /* The first label whose address isn't lower than the given one */
+    while(low < high)
+    {
+        middle = low + (high - low) / 2;
+        if(dis->entries[middle].address < address)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return (low < dis->numOfEntries && dis->entries[low].address == address) ? dis->entries[low].name : NULL;
+}
+
+
+bool isTarget(const disassembler *dis, long address)
+{
+    return (dis->numOfTargets != 0 &&
+            bsearch(&address, dis->targets, dis->numOfTargets, sizeof(long), compareAddresses) != NULL) ? TRUE : FALSE;
+}
+
+
+void writeLabel(disassembler *dis, long address)
+{
+    const char *name = findEntryLabel(dis, address);
+    int i;
+
+    if(name != NULL)
+        writeString(dis->writer, name);
+    else
+    {
+        for(i = 0; i < dis->labelPrefixLength; i++)
+            writeChar(dis->writer, syntheticLabelCharacter);
+        writeDecimal(dis->writer, address, 4);
+    }
+}
+
+
+void writeLabelDefinition(disassembler *dis, long address)
+{
+    if(findEntryLabel(dis, address) != NULL || isTarget(dis, address))
+    {
+        writeLabel(dis, address);
+        writeChar(dis->writer, ':');
+    }
+    writeChar(dis->writer, '\t');
+}
+
+
+state labelAddressState(const disassembler *dis, long address)
+{
+    /* The instructions start every 4 bytes, the data can be labeled at any byte */
+    if(address >= ICInitialValue && address < ICInitialValue + dis->codeSize)
+        return ((address - ICInitialValue) % 4 == 0) ? VALID : INVALID;
+    return (address >= ICInitialValue + dis->codeSize && address < ICInitialValue + dis->codeSize + dis->dataSize) ?
+           VALID : INVALID;
+}
+
+
+state disassembleInstruction(disassembler *dis, newLine *line, long address, unsigned int word)
+{
+    outputWriter *writer = dis->writer;
+    codeType data;
+    const instructionWord *instruction;
+    bool external;
+    long target = -1;
+
+    memcpy(&data, &word, sizeof(word));
+    instruction = decodeInstructionWord(dis, &data);
+
+    /* The references of the '.ext' file are matched with the instructions in the order of the code */
+    while(dis->external.address != -1 && dis->external.address < address)
+    {
+        fprintf(dis->errors, "Error! file '%s': the external reference of '%s' at %04ld isn't an instruction.\n",
+                dis->fileName, dis->external.name, dis->external.address);
+        dis->errorCount++;
+        nextExternalReference(dis);
+    }
+    external = (dis->external.address == address) ? TRUE : FALSE;
+
+    /* Only a word the assembler could have encoded is written as source, so the source yields the same word */
+    if(instruction == NULL)
+        line->error = addError("Illegal instruction, its opcode/funct isn't defined");
+    else if(instruction->type == R && (data.typeR.unused != 0 || (instruction->opcode == 1 && data.typeR.rt != 0)))
+        line->error = addError("The instruction has bits set that the assembler doesn't encode");
+    else if(instruction->type == J && (instruction->opcode == 63 ? word != (unsigned int)63 << 26 :
+            (data.typeJ.reg == 1 && (instruction->opcode != 30 || data.typeJ.address > maxRegister))))
+        line->error = addError("The instruction has bits set that the assembler doesn't encode");
+    else if(external && (instruction->type != J || instruction->opcode == 63 || data.typeJ.reg != 0 ||
+            data.typeJ.address != 0))
+        line->error = addError("The external reference doesn't refer to the address of a 'jmp'/'la'/'call'");
+    else if(!external && instruction->opcode >= 15 && instruction->opcode <= 18)
+        target = address + data.typeI.immed;
+    else if(!external && instruction->type == J && instruction->opcode != 63 && data.typeJ.reg == 0)
+        target = (long)data.typeJ.address;
+    if(currentState(line) == VALID && target != -1 && labelAddressState(dis, target) == INVALID)
+        line->error = addError("The target of the instruction isn't an address a label can be defined at");
+    if(currentState(line) == INVALID)
+    {
+        if(external)
+            nextExternalReference(dis);
+        /* The line of the object file is kept as a comment, it may be longer than the buffer */
+        writeString(writer, "; ");
+        writeBlock(writer, line->content, line->length);
+        writeChar(writer, '\n');
+        printLineError(line, dis->errors);
+        dis->errorCount++;
+        return INVALID;
+    }
+
+    writeLabelDefinition(dis, address);
+    writeString(writer, instruction->name);
+    if(instruction->opcode != 63)
+        writeChar(writer, ' ');
+    if(instruction->type == R)
+    {
+        writeChar(writer, '$');
+        writeDecimal(writer, data.typeR.rs, 1);
+        if(instruction->opcode == 0)
+        {
+            writeString(writer, ", $");
+            writeDecimal(writer, data.typeR.rt, 1);
+        }
+        writeString(writer, ", $");
+        writeDecimal(writer, data.typeR.rd, 1);
+    }
+    else if(instruction->type == I)
+    {
+        writeChar(writer, '$');
+        writeDecimal(writer, data.typeI.rs, 1);
+        writeString(writer, ", ");
+        if(target != -1)
+        {
+            writeChar(writer, '$');
+            writeDecimal(writer, data.typeI.rt, 1);
+            writeString(writer, ", ");
+            writeLabel(dis, target);
+        }
+        else
+        {
+            writeDecimal(writer, data.typeI.immed, 1);
+            writeString(writer, ", $");
+            writeDecimal(writer, data.typeI.rt, 1);
+        }
+    }
+    else if(external)
+    {
+        writeString(writer, dis->external.name);
+        nextExternalReference(dis);
+    }
+    else if(target != -1)
+        writeLabel(dis, target);
+    else if(data.typeJ.reg == 1)
+    {
+        writeChar(writer, '$');
+        writeDecimal(writer, (long)data.typeJ.address, 1);
+    }
+    writeChar(writer, '\n');
+    return VALID;
+}
+
+
+void disassembleData(disassembler *dis, long address, const unsigned char *bytes, int numOfBytes)
+{
+    outputWriter *writer = dis->writer;
+    int i;
+
+    for(i = 0; i < numOfBytes; i++)
+    {
+        if(i == 0 || findEntryLabel(dis, address + i) != NULL || isTarget(dis, address + i))
+        {
+            if(i != 0)
+                writeChar(writer, '\n');
+            writeLabelDefinition(dis, address + i);
+            writeString(writer, ".db ");
+        }
+        else
+            writeString(writer, ", ");
+        writeDecimal(writer, (long)bytes[i] - ((bytes[i] & 0x80) << 1), 1);
+    }
+    writeChar(writer, '\n');
+}
+
+
+state disassembleObjectFile(disassembler *dis, const char *baseName, FILE *out)
+{
+    char *objectName = callocWithCheck(strlen(baseName) + 4), *entryName = callocWithCheck(strlen(baseName) + 5);
+    char *externName = callocWithCheck(strlen(baseName) + 5);
+    FILE *fileDescriptor;
+    lineStream stream = {0};
+    newLine line = {0};
+    unsigned char bytes[4];
+    int numOfBytes;
+    long address;
+
+    sprintf(objectName, "%s.ob", baseName);
+    sprintf(entryName, "%s.ent", baseName);
+    sprintf(externName, "%s.ext", baseName);
+    dis->fileName = objectName;
+    dis->writer = callocWithCheck(sizeof(outputWriter));
+    initOutputWriter(dis->writer, out);
+
+    if(openFile(&fileDescriptor, objectName, "r", dis->errors) == INVALID)
+        dis->errorCount++;
+    else
+    {
+        /* The first line holds the sizes of the code image and the data image */
+        openLineStream(&stream, fileDescriptor);
+        line.sourceFileName = objectName;
+        line.number = 1;
+        if(!nextStreamLine(&stream, &line))
+            line.error = addError("Invalid object file header, it must hold the sizes of the code and the data images");
+        else
+            parseObjectHeader(&line, &dis->codeSize, &dis->dataSize);
+
+        if(currentState(&line) == INVALID)
+        {
+            printLineError(&line, dis->errors);
+            dis->errorCount++;
+        }
+        /* The first reading collects the addresses the instructions refer to, the second one writes the source */
+        else if(collectTargets(dis, &stream) == VALID && loadEntryLabels(dis, entryName) == VALID &&
+                writeExternDirectives(dis, externName) == VALID)
+        {
+            fseek(fileDescriptor, 0, SEEK_SET);
+            openLineStream(&stream, fileDescriptor);
+            nextStreamLine(&stream, &line);
+            line.number = 1;
+            while(nextStreamLine(&stream, &line))
+            {
+                line.number++;
+                line.error = NULL;
+                parseObjectWordLine(&line, &address, bytes, &numOfBytes);
+                if(address < ICInitialValue + dis->codeSize)
+                    disassembleInstruction(dis, &line, address, (unsigned int)bytes[0] | (unsigned int)bytes[1] << 8 |
+                            (unsigned int)bytes[2] << 16 | (unsigned int)bytes[3] << 24);
+                else if(numOfBytes != 0)
+                    disassembleData(dis, address, bytes, numOfBytes);
+            }
+            /* References after the code don't refer to an instruction */
+            for(; dis->external.address != -1; nextExternalReference(dis))
+            {
+                fprintf(dis->errors, "Error! file '%s': the external reference of '%s' at %04ld isn't an instruction.\n",
+                        dis->fileName, dis->external.name, dis->external.address);
+                dis->errorCount++;
+            }
+        }
+        closeLineStream(&stream);
+    }
+
+    flushOutputWriter(dis->writer);
+    free(objectName);
+    free(entryName);
+    free(externName);
+    return (dis->errorCount == 0) ? VALID : INVALID;
+}
+
+
+void freeDisassembler(disassembler *dis)
+{
+    free(dis->entries);
+    free(dis->targets);
+    free(dis->writer);
+    closeLineStream(&dis->externals);
+    memset(dis, 0, sizeof(disassembler));
+}
@@ -1,12 +1,16 @@
 #include <string.h>
 #include <stdlib.h>
 #include "../include/firstPass.h"
+#include "../include/chunkedFirstPass.h"
+#include "../include/lineHandling.h"
 #include "../include/secondPass.h"
 #include "../include/tables.h"
+#include "../include/relaxation.h"
 #include "../include/general.h"
+#include "../include/statistics.h"
 
 
-state openFile(FILE** fileDescriptor, const char* fileName, char* mode)
+state openFile(FILE** fileDescriptor, const char* fileName, char* mode, FILE* errors)
 {
 	state fileOpening = VALID;
 
@@ -19,9 +23,9 @@ state openFile(FILE** fileDescriptor, const char* fileName, char* mode)
 	if (*fileDescriptor == NULL)
 	{
 		if (strcmp("r", mode) == 0)
-			fprintf(stderr, "Error: failed to access file '%s' for reading.\n", fileName);
+			fprintf(errors, "Error: failed to access file '%s' for reading.\n", fileName);
 		else if (strcmp("w", mode) == 0)
-			fprintf(stderr, "Error: failed to access file '%s' for writing.\n", fileName);
+			fprintf(errors, "Error: failed to access file '%s' for writing.\n", fileName);
 
 		fileOpening = INVALID;
 	}
@@ -29,78 +33,122 @@ state openFile(FILE** fileDescriptor, const char* fileName, char* mode)
 }
 
 
-void updateValues(long* ICF, long* DCF, long IC, long DC, symbolTable symTab, dataTable dataTab)
+void updateValues(long* ICF, long* DCF, long IC, long DC, symbolHashTable *symTab)
 {
-	dataTable dataEntry;
 	symbolTable symbolEntry;
 
 	/* Preserves the final values of IC and DC */
 	*ICF = IC;
 	*DCF = DC;
 
-	/* Updates the addresses of all data entries in the data image table by incrementing each address with ICF value. */
-	for (symbolEntry = symTab; symbolEntry != NULL; symbolEntry = symbolEntry->next)
+	/* Updates the addresses of all data symbols by incrementing each address with ICF value. */
+	for (symbolEntry = symTab->head; symbolEntry != NULL; symbolEntry = symbolEntry->next)
 	{
 		if (symbolEntry->type == data)
 			symbolEntry->value += (*ICF);
 	}
 
-	/* Updates in the data Image the addresses of all the data by adding the ICF dataType to each dataType */
-	for (dataEntry = dataTab; dataEntry != NULL; dataEntry = dataEntry->next)
-		dataEntry->address += (*ICF);
-
 }
 
 
-state processFile(codeTable* codeImage, dataTable* dataImage, attributesTable* attrTab, long* ICF, long* DCF, FILE* fd,
-		newLine* line)
+state completeSource(assemblyContext* context, newLine* line, state firstPassState, long instructionCounter)
 {
 	state fileState = INVALID;
-	symbolTable symbolTab = NULL; /* represents the symbol table */
-	long instructionCounter = ICInitialValue, dataCounter = 0;
+	double start;
+
+	if (context->statistics != NULL)
+		context->statistics->lines = line->number - 1;
 
 	/* If the first pass succeeded, updates the required values and proceed to the second pass */
-	if (firstPass(line, &instructionCounter, &dataCounter, &symbolTab, codeImage, dataImage, fd) == VALID)
+	if (firstPassState == VALID)
 	{
-		updateValues(ICF, DCF, instructionCounter, dataCounter, symbolTab, *dataImage);
-		rewind(fd);  /* Starts from beginning of file again */
-		if (secondPass(line, symbolTab, *codeImage, attrTab, fd) == VALID)
+		/* Conditional branches whose labels are out of their range are replaced before the addresses are final */
+		start = phaseStart(context);
+		relaxBranches(context, &instructionCounter);
+		phaseEnd(context, relaxationPhase, start);
+
+		start = phaseStart(context);
+		updateValues(&context->ICF, &context->DCF, instructionCounter, (long)context->dataImage.size, &context->symbolTab);
+		phaseEnd(context, updateValuesPhase, start);
+
+		start = phaseStart(context);
+		if (secondPass(line, context) == VALID)
 			fileState = VALID;
+		phaseEnd(context, secondPassPhase, start);
 	}
 
+	/* The tables are kept in the context until the output files are created, and are released along with it.
+	   Returns whether the two-passes succeeded or not */
+	return fileState;
+}
 
 
-	freeSymbolTable(symbolTab);
-	fclose(fd);
-	/* Returns whether the two-passes succeeded or not */
-	return fileState;
+state processSource(assemblyContext* context, newLine* line)
+{
+	state firstPassState;
+	long instructionCounter = ICInitialValue;
+	double start = phaseStart(context);
+
+	/* A large source may be split between several threads, with the same tables and diagnostics */
+	if (context->options->firstPassThreads > 1)
+		firstPassState = chunkedFirstPass(line, &instructionCounter, context);
+	else
+		firstPassState = firstPass(line, &instructionCounter, context);
+	phaseEnd(context, firstPassPhase, start);
+
+	return completeSource(context, line, firstPassState, instructionCounter);
 }
 
 
-char* getFileFullName(char* fileName, char* fileExtension)
+char* getFileFullName(const char* fileName, char* fileExtension)
 {
-	char *fullName, *temp;
-	fullName = callocWithCheck(strlen(fileName) + strlen(fileExtension) + 1);
-	temp = strtok(fileName, "."); /* Copy the filename without the extension */
-	strcpy(fullName, temp);
+	char *fullName;
+	const char *extension = strrchr(fileName, '.'), *directory = strrchr(fileName, '/');
+	unsigned long nameLength = strlen(fileName);
+
+	/* Copy the filename without the extension, a '.' inside a directory name isn't an extension */
+	if (extension != NULL && (directory == NULL || extension > directory))
+		nameLength = (unsigned long)(extension - fileName);
+	fullName = callocWithCheck(nameLength + strlen(fileExtension) + 1);
+	memcpy(fullName, fileName, nameLength);
 	strcat(fullName, fileExtension);
 	return fullName;
 }
 
 
-state fileIsValid(const char* fileName, codeTable* codeImage, dataTable* dataImage, attributesTable* attrTab, long* ICF,
-		long* DCF)
+state readInputFile(const char* fileName, assemblyContext* context)
 {
-	state fileState = INVALID;
 	FILE* fileDescriptor;
+	double start = phaseStart(context);
+
+	if (openFile(&fileDescriptor, fileName, "r", context->errors) == INVALID)
+		return INVALID;
+
+	/* The whole file is read once, the passes work on views of its lines */
+	readSourceFile(fileDescriptor, &context->source);
+	fclose(fileDescriptor);
+	phaseEnd(context, readPhase, start);
+	return VALID;
+}
+
+
+state sourceIsValid(const char* fileName, assemblyContext* context)
+{
+	state sourceState;
 	newLine* line = (newLine*)callocWithCheck(sizeof(newLine));
 
 	line->sourceFileName = fileName;
-
-	/* If the file opening succeeded, continue with the file's processing */
-	if (openFile(&fileDescriptor, line->sourceFileName, "r") == VALID)
-		fileState = processFile(codeImage, dataImage, attrTab, ICF, DCF, fileDescriptor, line);
+	sourceState = processSource(context, line);
 
 	free(line);
-	return fileState;
-}
\ No newline at end of file
+	return sourceState;
+}
+
+
+state fileIsValid(const char* fileName, assemblyContext* context)
+{
+	/* If the file opening succeeded, continue with the file's processing */
+	if (readInputFile(fileName, context) == VALID)
+		return sourceIsValid(fileName, context);
+	return INVALID;
+}
@@ -6,10 +6,10 @@
 #include "../include/directives.h"
 
 
-state lineFirstPass(newLine* line, long* IC, long* DC, symbolTable* symTab, codeTable* cImage, dataTable* dImage)
+state lineFirstPass(newLine* line, long* IC, assemblyContext* context)
 {
 	int contentIndex = 0;
-	char symbol[maxLineLength];
+	char symbol[labelBufferLength];
 	bool labelSetting = FALSE;
 	directiveWord directiveToken;
 
@@ -20,35 +20,42 @@ state lineFirstPass(newLine* line, long* IC, long* DC, symbolTable* symTab, code
 	checkForLabelSetting(line, symbol, &contentIndex, &labelSetting);
 	/* If no error was found and the current word is a directive word, saves the word. */
 	if (currentState(line) == VALID && isDirective(line->content, &directiveToken, &contentIndex))
-		processDirective(&directiveToken, labelSetting, line, &contentIndex, DC, symTab, dImage, symbol);
+		processDirective(&directiveToken, labelSetting, line, &contentIndex, context, symbol);
 	/* If it's not a directive then it's  an instruction. Checks if the line represents is a valid instruction */
 	else
-		processInstruction(line, &contentIndex, labelSetting, symbol, symTab, cImage, IC);
+		processInstruction(line, &contentIndex, labelSetting, symbol, context, IC);
 
 	return currentState(line);
 }
 
 
-state firstPass(newLine* line, long* IC, long* DC, symbolTable* symTab, codeTable* cImage, dataTable* dImage, FILE* fd)
+state firstPassFrom(newLine* line, long firstLineNumber, long* IC, assemblyContext* context)
 {
-    char tempLine[maxLineLength + 2];  /* Temporary string for storing single line from an input file */
     state process = VALID;
 
-    /* Check validation of each line from the input file, until reach end of file. */
-    for (line->number = 1; fgets(tempLine, maxLineLength + 2, fd) != NULL; line->number++)
+    /* Check validation of each line from the source buffer, until reach end of file. */
+    for (line->number = firstLineNumber; nextSourceLine(&context->source, line); line->number++)
     {
-        line->content = tempLine;
         line->error = NULL;
 
-        if (lineLength(line->content, line, fd) == INVALID)
-            printLineError(line);
+        if (lineLength(line, context->options->maxLineLength) == INVALID)
+        {
+            printLineError(line, context->errors);
+            context->reportedLines++;
+        }
 
-        else if (lineFirstPass(line, IC, DC, symTab, cImage, dImage) == INVALID)
+        else if (lineFirstPass(line, IC, context) == INVALID)
         {
-            printLineError(line);
+            printLineError(line, context->errors);
+            context->reportedLines++;
             process = INVALID;
         }
     }
     line->content = NULL;
     return process;
-}
\ No newline at end of file
+}
+
+state firstPass(newLine* line, long* IC, assemblyContext* context)
+{
+    return firstPassFrom(line, 1, IC, context);
+}
@@ -0,0 +1,100 @@
+/* For the POSIX threads */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <string.h>
+#include "../include/fixupResolution.h"
+#include "../include/binary.h"
+#include "../include/tables.h"
+#include "../include/general.h"
+
+
+void *fixupResolverWorker(void *resolver)
+{
+    fixupResolver *range = (fixupResolver *) resolver;
+    fixupTable *fixups = &range->context->fixups;
+    newLine line = {0};
+    symbolTable label;
+    unsigned long i;
+
+    for(i = range->first; i < range->last; i++)
+    {
+        line.error = NULL;
+        label = encodeFixup(&line, &fixups->entries[i], range->context);
+
+        if(line.error != NULL)
+        {
+            if(range->numOfErrors == range->errorsCapacity)
+            {
+                range->errorsCapacity = (range->errorsCapacity == 0) ? 16 : range->errorsCapacity * 2;
+                range->errors = reallocWithCheck(range->errors, range->errorsCapacity * sizeof(fixupError));
+            }
+            range->errors[range->numOfErrors].fixupIndex = i;
+            range->errors[range->numOfErrors++].error = line.error;
+        }
+        if(label != NULL && label->isExternal)
+        {
+            if(range->numOfExternals == range->externalsCapacity)
+            {
+                range->externalsCapacity = (range->externalsCapacity == 0) ? 64 : range->externalsCapacity * 2;
+                range->externals = reallocWithCheck(range->externals,
+                                                    range->externalsCapacity * sizeof(externalReference));
+            }
+            range->externals[range->numOfExternals].name = label->name;
+            range->externals[range->numOfExternals++].address =
+                    range->context->codeImage.entries[fixups->entries[i].codeIndex].address;
+        }
+    }
+    return NULL;
+}
+
+
+bool resolveFixupsInParallel(assemblyContext *context, resolvedFixups *resolved)
+{
+    long numOfThreads = (long)(context->fixups.count / (unsigned long)context->options->fixupChunkSize);
+    fixupResolver *ranges;
+    unsigned long j;
+    int i;
+
+    if(numOfThreads > context->options->fixupThreads)
+        numOfThreads = context->options->fixupThreads;
+    if(numOfThreads < 2)
+        return FALSE;
+
+    ranges = (fixupResolver *) callocWithCheck(numOfThreads * sizeof(fixupResolver));
+    for(i = 0; i < numOfThreads; i++)
+    {
+        ranges[i].context = context;
+        ranges[i].first = context->fixups.count / numOfThreads * i;
+        ranges[i].last = (i == numOfThreads - 1) ? context->fixups.count : context->fixups.count / numOfThreads * (i + 1);
+        /* A range whose thread can't be created is resolved by the calling thread */
+        ranges[i].threadStarted = (pthread_create(&ranges[i].thread, NULL, fixupResolverWorker, &ranges[i]) == 0);
+        if(!ranges[i].threadStarted)
+            fixupResolverWorker(&ranges[i]);
+    }
+
+    for(i = 0; i < numOfThreads; i++)
+    {
+        if(ranges[i].threadStarted)
+            pthread_join(ranges[i].thread, NULL);
+        resolved->count += ranges[i].numOfErrors;
+    }
+
+    /* The ranges are concatenated by their order, so both lists keep the order of the fixups */
+    resolved->errors = (fixupError *) callocWithCheck((resolved->count + 1) * sizeof(fixupError));
+    resolved->count = resolved->next = 0;
+    for(i = 0; i < numOfThreads; i++)
+    {
+        if(ranges[i].numOfErrors != 0)
+            memcpy(resolved->errors + resolved->count, ranges[i].errors, ranges[i].numOfErrors * sizeof(fixupError));
+        resolved->count += ranges[i].numOfErrors;
+
+        for(j = 0; j < ranges[i].numOfExternals; j++)
+            addToAttributesTable(ranges[i].externals[j].name, external, ranges[i].externals[j].address,
+                                 &context->attributesTab, &context->attributesTail, &context->memory);
+        free(ranges[i].errors);
+        free(ranges[i].externals);
+    }
+    free(ranges);
+    return TRUE;
+}
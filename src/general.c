@@ -1,4 +1,7 @@
 
+/* For 'open_memstream' */
+#define _POSIX_C_SOURCE 200809L
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -18,20 +21,42 @@ void *callocWithCheck(unsigned long size)
 }
 
 
+void *reallocWithCheck(void *block, unsigned long size)
+{
+    void *temp = realloc(block, size);
+
+    if (temp == NULL)
+    {
+        fprintf(stderr,"Error: Memory allocation failed.");
+        exit(1);
+    }
+    return temp;
+}
+
+
+FILE *openMemoryStream(char **buffer, size_t *size)
+{
+    FILE *stream = open_memstream(buffer, size);
+
+    if (stream == NULL)
+    {
+        fprintf(stderr,"Error: Memory allocation failed.");
+        exit(1);
+    }
+    return stream;
+}
+
+
 char *addError(char *error)
 {
-    char *currentError;
-    currentError = callocWithCheck(strlen(error) + 1);
-    strcpy(currentError, error);
-    return currentError;
+    /* The error messages are string literals, so they're referenced instead of being copied */
+    return error;
 }
 
 
-void printLineError(newLine *line)
+void printLineError(newLine *line, FILE *errors)
 {
-    fprintf(stderr,"Error! file '%s' line %ld: %s.\n", line-> sourceFileName, line-> number, line-> error);
-    /* After printing an error,releases the memory allocated for the error */
-    free(line->error);
+    fprintf(errors,"Error! file '%s' line %ld: %s.\n", line-> sourceFileName, line-> number, line-> error);
 }
 
 
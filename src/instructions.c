@@ -5,6 +5,7 @@
 #include "../include/general.h"
 #include "../include/tables.h"
 #include "../include/lineHandling.h"
+#include "../include/reservedWords.h"
 
 
 instructionWord *getReservedInstructions(int *numberOfInstructions)
@@ -35,26 +36,21 @@ instructionWord *getReservedInstructions(int *numberOfInstructions)
 state searchInstruction(instructionWord *instructionToken)
 {
     /* numberOfInstructions = The total number of the available instructions */
-    int i,numberOfInstructions;
+    int numberOfInstructions;
     instructionWord *instruction = getReservedInstructions(&numberOfInstructions);
+    const reservedWord *word = findReservedWord(instructionToken->name);
 
-    /* Searches for a match between the current word and one of the instructions name */
-    for(i = 0; i < numberOfInstructions; i++)
-    {
-        /* if a match is found saves the matched instruction values and stops */
-        if(strcmp(instructionToken->name, instruction[i].name) == 0)
-        {
-            instructionToken->type = instruction[i].type;
-            instructionToken->opcode = instruction[i].opcode;
-
-            if(instructionToken->type == R)
-                instructionToken->funct = instruction[i].funct;
-            break;
-        }
-    }
-    /* If no match is found after iterating all the instructions  */
-    if(i == numberOfInstructions)
+    /* If the current word isn't one of the instructions name */
+    if(word == NULL || word->type != reservedInstruction)
         return INVALID;
+
+    /* Saves the matched instruction values */
+    instruction += word->index;
+    instructionToken->type = instruction->type;
+    instructionToken->opcode = instruction->opcode;
+
+    if(instructionToken->type == R)
+        instructionToken->funct = instruction->funct;
     return VALID;
 }
 
@@ -82,31 +78,40 @@ state instructionWordState(newLine *line, instructionWord *instructionToken, int
 }
 
 
-void checkJOperandsSyntax(newLine *line, unsigned int opcode, char *symbol, int *index, int *numOfScannedOperands)
+void checkJOperandsSyntax(newLine *line, instructionLine *instructionIR, instructionOperand *operand, int *index,
+        int *numOfScannedOperands)
 {
     /* If 'jump' instructions with register operand */
-    if(opcode == 30  && line->content[*index] == '$')
-        checkRegister(line, index, numOfScannedOperands);
+    if(instructionIR->word.opcode == 30  && line->content[*index] == '$')
+        operand->value = checkRegister(line, index, numOfScannedOperands);
     else
     {
-        getLabelName(line->content, index, symbol);
-        labelIsValid(line, symbol);
+        operand->kind = labelOperand;
+        getLabelName(line->content, index, instructionIR->symbol);
+        labelIsValid(line, instructionIR->symbol);
         (*numOfScannedOperands)++;
     }
 }
 
 
-void checkIOperandsSyntax(newLine *line, unsigned int opcode, char *symbol, int *index, int *numOfScannedOperands)
+void checkIOperandsSyntax(newLine *line, instructionLine *instructionIR, instructionOperand *operand, int *index,
+        int *numOfScannedOperands)
 {
+    unsigned int opcode = instructionIR->word.opcode;
+
     /* dataType 'I' copy instructions or dataType 'I'  loading and saving memory instructions */
     if((opcode >= 10 && opcode <= 14) || (opcode >= 19 && opcode <= 24))
     {
         /* THE second operand in line must be an integer */
         if((*numOfScannedOperands) == 1)
-			checkInteger(line, index, numOfScannedOperands, max2BytesIntLength, max2BytesIntVal, min2BytesIntVal);
+        {
+            operand->kind = immediateOperand;
+			operand->value = checkInteger(line, index, numOfScannedOperands, max2BytesIntLength, max2BytesIntVal,
+                    min2BytesIntVal);
+        }
         /* The first and third operands in line must be registers */
         else
-            checkRegister(line, index, numOfScannedOperands);
+            operand->value = checkRegister(line, index, numOfScannedOperands);
     }
     /* Type 'I' Conditional branching instructions */
     else if(opcode >= 15 && opcode <= 18)
@@ -114,37 +119,50 @@ void checkIOperandsSyntax(newLine *line, unsigned int opcode, char *symbol, int
         /* The third operand must be a label */
         if((*numOfScannedOperands) == 2)
         {
-            getLabelName(line->content, index, symbol);
-            labelIsValid(line, symbol);
+            operand->kind = labelOperand;
+            getLabelName(line->content, index, instructionIR->symbol);
+            labelIsValid(line, instructionIR->symbol);
             (*numOfScannedOperands)++;
         }
         /* The first and second operands in line must be registers */
         else
-            checkRegister(line, index, numOfScannedOperands);
+            operand->value = checkRegister(line, index, numOfScannedOperands);
     }
 }
 
 
-void checkOperandByType(newLine *line, unsigned int opcode, char *symbol, int *index, int *numOfScannedOperands)
+void checkOperandByType(newLine *line, instructionLine *instructionIR, int *index)
 {
+    unsigned int opcode = instructionIR->word.opcode;
+    int numOfScannedOperands = instructionIR->numOfOperands;
+    instructionOperand operand = {registerOperand, 0, 0, 0};
+
+    operand.start = *index;
+
     /* Type 'R' instructions */
     if(opcode == 0 || opcode == 1)
-        checkRegister(line, index, numOfScannedOperands);
+        operand.value = checkRegister(line, index, &numOfScannedOperands);
 
     /* Type 'I' instructions */
     else if((opcode >= 10 &&  opcode <= 24))
-        checkIOperandsSyntax(line, opcode, symbol, index, numOfScannedOperands);
+        checkIOperandsSyntax(line, instructionIR, &operand, index, &numOfScannedOperands);
 
     /* Type 'J' instructions - without 'stop' */
     else if(opcode == 30 || opcode == 31 || opcode == 32)
-        checkJOperandsSyntax(line, opcode, symbol, index, numOfScannedOperands);
+        checkJOperandsSyntax(line, instructionIR, &operand, index, &numOfScannedOperands);
+
+    operand.length = *index - operand.start;
+
+    /* Keeps the scanned operand, an excessive operand is reported later by 'checkOperandsAmount' */
+    if(numOfScannedOperands > instructionIR->numOfOperands && numOfScannedOperands <= maxInstructionOperands)
+        instructionIR->operands[numOfScannedOperands - 1] = operand;
+    instructionIR->numOfOperands = numOfScannedOperands;
 }
 
 
-void checkInstructionSyntax(newLine *line, unsigned int opcode, int contentIndex)
+void checkInstructionSyntax(newLine *line, instructionLine *instructionIR, int contentIndex)
 {
-    int numOfScannedOperands = 0;
-    char symbol[maxLabelLength + 1] = {0};
+    unsigned int opcode = instructionIR->word.opcode;
 
     /* 'stop' instruction validity check */
     if(opcode == 63 && !emptyLine(line->content, contentIndex))
@@ -152,55 +170,40 @@ void checkInstructionSyntax(newLine *line, unsigned int opcode, int contentIndex
 
     while(currentState(line) == VALID && line->content[contentIndex] != '\n')
     {
-        if(checkForComma(line,&contentIndex, numOfScannedOperands) == VALID)
-            checkOperandByType(line, opcode, symbol, &contentIndex, &numOfScannedOperands);
+        if(checkForComma(line,&contentIndex, instructionIR->numOfOperands) == VALID)
+            checkOperandByType(line, instructionIR, &contentIndex);
 
 		skipSpaces(line->content, &contentIndex);
 
 		if(currentState(line) == VALID)
 		{
 			if(line->content[contentIndex] != '\n')
-				checkOperandsAmount(line, opcode, numOfScannedOperands, FALSE);
+				checkOperandsAmount(line, opcode, instructionIR->numOfOperands, FALSE);
 			if(line->content[contentIndex] == '\n')
-				checkOperandsAmount(line, opcode, numOfScannedOperands, TRUE);
+				checkOperandsAmount(line, opcode, instructionIR->numOfOperands, TRUE);
 		}
     }
 }
 
 
-state instructionLineState(newLine *line, instructionWord instructionToken, int contentIndex)
+state instructionLineState(newLine *line, instructionLine *instructionIR, int contentIndex)
 {
     /* If there is no operands after the instruction , and it's not 'stop' instruction */
-    if(instructionToken.opcode != 63 && emptyLine(line->content, contentIndex))
+    if(instructionIR->word.opcode != 63 && emptyLine(line->content, contentIndex))
         line-> error = addError("Missing Operands");
 
     /* If there is no spacing between the instruction and the first operand, and it's not 'stop' instruction */
-    else if (instructionToken.opcode != 63 && line->content[contentIndex] != ' ' && line->content[contentIndex] != '\t')
+    else if (instructionIR->word.opcode != 63 && line->content[contentIndex] != ' ' && line->content[contentIndex] != '\t')
         line->error = addError("No spacing between the instruction word and the first operand");
 
     /* If no error was found, executing syntax and operands check for the instruction dataType */
     else
-        checkInstructionSyntax(line, instructionToken.opcode, contentIndex);
+        checkInstructionSyntax(line, instructionIR, contentIndex);
 
     return currentState(line);
 }
 
 
-void getInstruction(const char *content, int *contentIndex, instructionWord *instructionToken)
-{
-    int i = 0;
-
-    skipSpaces(content, contentIndex);
-
-    /* Copies the instruction */
-    while(!isWhiteSpace(content[*contentIndex]))
-        instructionToken->name[i++] = content[(*contentIndex)++];
-
-    /* Finds the current instruction and save its opcode and dataType in the instructionToken */
-    searchInstruction(instructionToken);
-}
-
-
 state addressState(newLine *line, symbolTable label, instructionType type, long address)
 {
     if(type == I)
@@ -239,27 +242,37 @@ state getAddress(newLine *line, long instructionAddress, symbolTable label, inst
 }
 
 
-void processInstruction(newLine *line, int *index, bool labelSet , char *label, symbolTable *symTab, codeTable *cImage, long *IC)
+bool instructionWithLabelOperand(const instructionLine *instructionIR)
 {
-    instructionWord instructionToken;
-    if(currentState(line) == VALID && instructionWordState(line, &instructionToken, index) == VALID)
-    {
-        if(labelSet && labelIsValid(line,label) && !labelIsDefined(label, line, *symTab, code))
-            addToSymbolTable(symTab, label, *IC, code);
+    int i;
 
-        if(currentState(line) == VALID && instructionLineState(line, instructionToken, *index) == VALID)
-			addToCodeImage(line->content, *index, instructionToken, cImage, IC, line->number);
+    for(i = 0; i < instructionIR->numOfOperands; i++)
+    {
+        if(instructionIR->operands[i].kind == labelOperand)
+            return TRUE;
     }
+    return FALSE;
 }
 
 
-bool instructionWithLabelOperand(newLine *line, int index, unsigned int opcode)
+void processInstruction(newLine *line, int *index, bool labelSet , char *label, assemblyContext *context, long *IC)
 {
-    if((opcode >= 15 && opcode <= 18) || (opcode >= 30 && opcode <= 32) && !(opcode == 30 && isRegister(line->content, index)))
-        return TRUE;
-    return FALSE;
-}
-
+    /* The line is scanned once into its intermediate form, which the encoding and the fixup are made of */
+    instructionLine instructionIR = {0};
 
+    if(currentState(line) == VALID && instructionWordState(line, &instructionIR.word, index) == VALID)
+    {
+        if(labelSet && labelIsValid(line,label) && !labelIsDefined(label, line, &context->symbolTab, code))
+            addToSymbolTable(&context->symbolTab, label, *IC, code, &context->memory);
 
+        if(currentState(line) == VALID && instructionLineState(line, &instructionIR, *index) == VALID)
+        {
+			addToCodeImage(&instructionIR, &context->codeImage, IC, line->number);
 
+            /* The label operand is resolved after the first pass, once the addresses of all the labels are known */
+            if(instructionWithLabelOperand(&instructionIR))
+                addToFixupTable(&context->fixups, context->codeImage.count - 1, instructionIR.word.type,
+                        instructionIR.symbol, line->number, &context->memory);
+        }
+    }
+}
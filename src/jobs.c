@@ -0,0 +1,430 @@
+/* For the POSIX threads */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "../include/jobs.h"
+#include "../include/files.h"
+#include "../include/createOutputFiles.h"
+#include "../include/tables.h"
+#include "../include/arena.h"
+#include "../include/general.h"
+#include "../include/cache.h"
+#include "../include/linker.h"
+#include "../include/statistics.h"
+#include "../include/pipeline.h"
+#include "../include/options.h"
+#include "../include/server.h"
+
+
+cacheOutcome assembleFile(const char *fileName, const assemblerOptions *options, FILE *errors, assemblyContext *context,
+        assemblyStatistics *statistics)
+{
+    cacheOutcome outcome = cacheUnused;
+    char key[cacheKeyLength + 1];
+    state fileState = INVALID;
+    double start = (statistics != NULL) ? secondsNow() : 0;
+
+    context->options = options;
+    context->errors = errors;
+    context->statistics = statistics;
+
+    if (options->linkedFileName != NULL)
+        fileState = fileIsValid(fileName, context);
+    else if (options->cacheDirectory == NULL)
+    {
+        if (options->pipelined)
+            fileState = assemblePipelined(fileName, context);
+        else if ((fileState = fileIsValid(fileName, context)) == VALID)
+            createOutputFiles(fileName, context);
+    }
+    else if (readInputFile(fileName, context) == VALID)
+    {
+        /* The outputs of an unchanged source are restored from the cache, without assembling it */
+        cacheKey(&context->source, options, key);
+        if (restoreFromCache(fileName, key, context) == VALID)
+        {
+            outcome = cacheHit;
+            fileState = VALID;
+        }
+        else
+        {
+            outcome = cacheMiss;
+            if (options->pipelined)
+                fileState = assembleSourcePipelined(fileName, context);
+            else if ((fileState = sourceIsValid(fileName, context)) == VALID)
+                createOutputFiles(fileName, context);
+            /* A source with reported lines isn't cached, its diagnostics must be printed again */
+            if (fileState == VALID && context->reportedLines == 0)
+                storeInCache(key, context);
+        }
+    }
+
+    if (statistics != NULL)
+    {
+        statistics->isValid = (fileState == VALID);
+        statistics->outcome = outcome;
+        collectStatistics(context, statistics);
+    }
+    /* In whole-program mode the context of a valid file is kept for the linker, and no output file is created */
+    context->statistics = NULL;
+    if (options->linkedFileName == NULL || fileState == INVALID)
+    {
+#ifdef ARENA_STATS
+        printArenaStats(&context->memory, fileName, errors);
+#endif
+        freeAssemblyContext(context);
+    }
+    if (statistics != NULL)
+        statistics->totalSeconds = secondsNow() - start;
+    return outcome;
+}
+
+
+unsigned long inputFileSize(const char *fileName)
+{
+    struct stat fileStatus;
+
+    if (stat(fileName, &fileStatus) != 0 || !S_ISREG(fileStatus.st_mode))
+        return 0;
+    return (unsigned long)fileStatus.st_size;
+}
+
+
+int compareJobSizes(const void *first, const void *second)
+{
+    const assemblyJob *firstJob = *(const assemblyJob *const *) first, *secondJob = *(const assemblyJob *const *) second;
+
+    if (firstJob->size != secondJob->size)
+        return (firstJob->size > secondJob->size) ? -1 : 1;
+    /* The jobs are in one array, by the order of the command line */
+    return (firstJob < secondJob) ? -1 : (firstJob > secondJob);
+}
+
+
+void scheduleJobs(workerPool *pool, int numOfQueues)
+{
+    assemblyJob **bySize = (assemblyJob **) callocWithCheck(pool->numOfJobs * sizeof(assemblyJob *));
+    int *owners = (int *) callocWithCheck(pool->numOfJobs * sizeof(int));
+    jobQueue *queues = pool->queues;
+    int i, j, owner, first = 0;
+
+    for (i = 0; i < pool->numOfJobs; ++i)
+        bySize[i] = &pool->jobs[i];
+    qsort(bySize, pool->numOfJobs, sizeof(assemblyJob *), compareJobSizes);
+
+    /* Every file goes to the queue with the least work so far, 'last' counts the files of each queue meanwhile */
+    for (i = 0; i < pool->numOfJobs; ++i)
+    {
+        for (owner = 0, j = 1; j < numOfQueues; ++j)
+            if (queues[j].remainingBytes < queues[owner].remainingBytes ||
+                (queues[j].remainingBytes == queues[owner].remainingBytes && queues[j].last < queues[owner].last))
+                owner = j;
+        owners[i] = owner;
+        queues[owner].remainingBytes += bySize[i]->size;
+        queues[owner].last++;
+    }
+
+    /* Each queue is a slice of the schedule, the files in it keep their order - from the largest one */
+    for (j = 0; j < numOfQueues; ++j)
+    {
+        queues[j].first = first;
+        first += queues[j].last;
+        queues[j].last = queues[j].first;
+    }
+    for (i = 0; i < pool->numOfJobs; ++i)
+        pool->schedule[queues[owners[i]].last++] = (int)(bySize[i] - pool->jobs);
+
+    free(owners);
+    free(bySize);
+}
+
+
+int takeFromQueue(workerPool *pool, jobQueue *queue)
+{
+    int jobIndex;
+
+    if (queue->first == queue->last)
+        return -1;
+    jobIndex = pool->schedule[queue->first++];
+    queue->remainingBytes -= pool->jobs[jobIndex].size;
+    return jobIndex;
+}
+
+
+int takeJob(workerPool *pool, int worker)
+{
+    jobQueue *victim;
+    unsigned long mostBytes = 0;
+    int jobIndex, i;
+
+    pthread_mutex_lock(&pool->queues[worker].lock);
+    jobIndex = takeFromQueue(pool, &pool->queues[worker]);
+    pthread_mutex_unlock(&pool->queues[worker].lock);
+
+    /* The queues are never refilled, so once they're all empty the worker is done */
+    while (jobIndex < 0)
+    {
+        victim = NULL;
+        for (i = 0; i < pool->numOfQueues; ++i)
+        {
+            if (i == worker)
+                continue;
+            pthread_mutex_lock(&pool->queues[i].lock);
+            if (pool->queues[i].first < pool->queues[i].last &&
+                (victim == NULL || pool->queues[i].remainingBytes > mostBytes))
+            {
+                victim = &pool->queues[i];
+                mostBytes = victim->remainingBytes;
+            }
+            pthread_mutex_unlock(&pool->queues[i].lock);
+        }
+        if (victim == NULL)
+            return -1;
+
+        /* The victim may have been emptied in the meantime, then the queues are searched again */
+        pthread_mutex_lock(&victim->lock);
+        jobIndex = takeFromQueue(pool, victim);
+        pthread_mutex_unlock(&victim->lock);
+    }
+    return jobIndex;
+}
+
+
+void *assemblyWorker(void *worker)
+{
+    poolWorker *self = (poolWorker *) worker;
+    workerPool *workers = self->pool;
+    assemblyContext workerContext = {0}, *context = &workerContext;
+    assemblyJob *job;
+    FILE *errors;
+    int jobIndex;
+    double start;
+
+    while ((jobIndex = takeJob(workers, self->index)) >= 0)
+    {
+        job = &workers->jobs[jobIndex];
+        if (workers->contexts != NULL)
+            context = &workers->contexts[jobIndex];
+        start = (workers->timings != NULL) ? secondsNow() : 0;
+        errors = openMemoryStream(&job->diagnostics, &job->diagnosticsSize);
+        job->outcome = assembleFile(job->fileName, workers->options, errors, context,
+                                    (workers->options->statistics != noStatistics) ? &job->statistics : NULL);
+        /* A kept context must not print to the memory stream, which is closed */
+        context->errors = NULL;
+        fclose(errors);
+        if (workers->timings != NULL)
+        {
+            workers->timings[jobIndex].seconds = secondsNow() - start;
+            workers->timings[jobIndex].worker = self->index;
+        }
+
+        /* Lets the printing thread know that the diagnostics of the file are ready */
+        pthread_mutex_lock(&workers->lock);
+        job->done = TRUE;
+        pthread_cond_broadcast(&workers->jobDone);
+        pthread_mutex_unlock(&workers->lock);
+    }
+    return NULL;
+}
+
+
+int runAssembler(int argc, char *argv[], bool isServed)
+{
+    assemblerOptions options;
+    inputFileList files = {0};
+
+    setDefaultOptions(&options);
+    if (parseOptions(argc, argv, &options, &files) == INVALID)
+    {
+        freeInputFileList(&files);
+        return 0;
+    }
+    if (options.serverSocket != NULL)
+    {
+        /* A server serves the requests of its clients, it doesn't assemble files of its own */
+        if (isServed)
+            fprintf(stderr, "Error: option '--serve' can't be run by the assembler server.\n");
+        else if (files.count != 0)
+            fprintf(stderr, "Error: option '--serve' doesn't take input files.\n");
+        else
+            serveRequests(options.serverSocket, &options);
+    }
+    else if (files.count == 0)
+        fprintf(stderr, "Error: Missing input files.\n");
+    else
+        assembleFiles(files.names, files.count, &options);
+
+    freeInputFileList(&files);
+    return 0;
+}
+
+
+void assembleFiles(char **files, int numOfFiles, const assemblerOptions *options)
+{
+    assemblerOptions runOptions = *options;
+    cacheStatistics statistics = {0};
+    assemblyContext *contexts = NULL;
+    fileTiming *timings = NULL;
+    int i, numOfWorkers = 1;
+    double start = secondsNow();
+
+    /* The cache holds output files, a linked program is made of the tables of its files */
+    if (runOptions.linkedFileName != NULL)
+    {
+        runOptions.cacheDirectory = NULL;
+        contexts = (assemblyContext *) callocWithCheck(numOfFiles * sizeof(assemblyContext));
+    }
+    /* If the cache directory can't be used, the files are still assembled */
+    else if (runOptions.cacheDirectory != NULL && openCacheDirectory(&runOptions) == INVALID)
+        runOptions.cacheDirectory = NULL;
+
+    if (runOptions.timingSummary)
+    {
+        timings = (fileTiming *) callocWithCheck(numOfFiles * sizeof(fileTiming));
+        for (i = 0; i < numOfFiles; ++i)
+            timings[i].fileName = files[i];
+    }
+
+    if (runOptions.jobs <= 1 || numOfFiles <= 1)
+        assembleSequentially(files, numOfFiles, &runOptions, contexts, &statistics, timings);
+    else
+        numOfWorkers = assembleInParallel(files, numOfFiles, &runOptions, contexts, &statistics, timings);
+
+    if (contexts != NULL)
+    {
+        linkProgram(files, numOfFiles, contexts, &runOptions);
+        for (i = 0; i < numOfFiles; ++i)
+            freeAssemblyContext(&contexts[i]);
+        free(contexts);
+    }
+
+    if (runOptions.cacheDirectory != NULL)
+        trimCache(&runOptions, &statistics);
+    if (runOptions.cacheStats)
+        printCacheStatistics(&statistics, stdout);
+    if (timings != NULL)
+    {
+        printTimingSummary(timings, numOfFiles, numOfWorkers, secondsNow() - start, stdout);
+        free(timings);
+    }
+}
+
+
+void assembleSequentially(char **files, int numOfFiles, const assemblerOptions *options, assemblyContext *contexts,
+        cacheStatistics *statistics, fileTiming *timings)
+{
+    int i;
+    assemblyContext context = {0};
+    assemblyStatistics fileStatistics;
+    double start = 0;
+
+    /* Without parallelism the diagnostics are printed directly, as the files are assembled */
+    for (i = 0; i < numOfFiles; ++i)
+    {
+        memset(&fileStatistics, 0, sizeof(fileStatistics));
+        if (timings != NULL)
+        {
+            timings[i].size = inputFileSize(files[i]);
+            start = secondsNow();
+        }
+        countCacheOutcome(statistics, assembleFile(files[i], options, stderr, (contexts != NULL) ? &contexts[i] : &context,
+                                                   (options->statistics != noStatistics) ? &fileStatistics : NULL));
+        if (timings != NULL)
+            timings[i].seconds = secondsNow() - start;
+        if (options->statistics != noStatistics)
+            printStatistics(files[i], &fileStatistics, options->statistics, stdout);
+    }
+}
+
+
+int assembleInParallel(char **files, int numOfFiles, const assemblerOptions *options, assemblyContext *contexts,
+        cacheStatistics *statistics, fileTiming *timings)
+{
+    int i, numOfWorkers = (options->jobs < numOfFiles) ? (int)options->jobs : numOfFiles, numOfThreads = 0;
+    workerPool pool;
+    poolWorker *workers;
+
+    pool.jobs = (assemblyJob *) callocWithCheck(numOfFiles * sizeof(assemblyJob));
+    pool.numOfJobs = numOfFiles;
+    pool.schedule = (int *) callocWithCheck(numOfFiles * sizeof(int));
+    /* There's no use in more workers than files */
+    pool.queues = (jobQueue *) callocWithCheck(numOfWorkers * sizeof(jobQueue));
+    pool.numOfQueues = numOfWorkers;
+    pool.options = options;
+    pool.contexts = contexts;
+    pool.timings = timings;
+    pthread_mutex_init(&pool.lock, NULL);
+    pthread_cond_init(&pool.jobDone, NULL);
+    for (i = 0; i < numOfFiles; ++i)
+    {
+        pool.jobs[i].fileName = files[i];
+        pool.jobs[i].size = inputFileSize(files[i]);
+        if (timings != NULL)
+            timings[i].size = pool.jobs[i].size;
+    }
+    for (i = 0; i < numOfWorkers; ++i)
+        pthread_mutex_init(&pool.queues[i].lock, NULL);
+    scheduleJobs(&pool, numOfWorkers);
+
+    /* The queues of the workers that couldn't be created are emptied by the others, by stealing */
+    workers = (poolWorker *) callocWithCheck(numOfWorkers * sizeof(poolWorker));
+    for (i = 0; i < numOfWorkers; ++i)
+    {
+        workers[i].pool = &pool;
+        workers[i].index = i;
+    }
+    while (numOfThreads < numOfWorkers &&
+           pthread_create(&workers[numOfThreads].thread, NULL, assemblyWorker, &workers[numOfThreads]) == 0)
+        numOfThreads++;
+
+    /* If no thread could be created, the files are assembled by this thread */
+    if (numOfThreads == 0)
+        assemblyWorker(&workers[0]);
+
+    /* Prints the diagnostics of each file by the order of the files, as soon as the file is done */
+    for (i = 0; i < numOfFiles; ++i)
+    {
+        pthread_mutex_lock(&pool.lock);
+        while (!pool.jobs[i].done)
+            pthread_cond_wait(&pool.jobDone, &pool.lock);
+        pthread_mutex_unlock(&pool.lock);
+
+        fwrite(pool.jobs[i].diagnostics, 1, pool.jobs[i].diagnosticsSize, stderr);
+        free(pool.jobs[i].diagnostics);
+        if (options->statistics != noStatistics)
+            printStatistics(pool.jobs[i].fileName, &pool.jobs[i].statistics, options->statistics, stdout);
+        countCacheOutcome(statistics, pool.jobs[i].outcome);
+    }
+
+    for (i = 0; i < numOfThreads; ++i)
+        pthread_join(workers[i].thread, NULL);
+    for (i = 0; i < numOfWorkers; ++i)
+        pthread_mutex_destroy(&pool.queues[i].lock);
+    pthread_cond_destroy(&pool.jobDone);
+    pthread_mutex_destroy(&pool.lock);
+    free(workers);
+    free(pool.queues);
+    free(pool.schedule);
+    free(pool.jobs);
+    return (numOfThreads == 0) ? 1 : numOfThreads;
+}
+
+
+void linkProgram(char **files, int numOfFiles, assemblyContext *contexts, const assemblerOptions *options)
+{
+    linkerContext linker = {0};
+    int i;
+
+    /* The context of an invalid file was released, the errors of the file were already printed */
+    for (i = 0; i < numOfFiles; ++i)
+        if (contexts[i].options == NULL)
+            return;
+
+    linker.errors = stderr;
+    if (linkAssembledFiles(&linker, contexts, files, numOfFiles) == VALID)
+        writeLinkedImage(&linker, options->linkedFileName);
+    freeLinkerContext(&linker);
+}
@@ -6,6 +6,8 @@
 #include "../include/directives.h"
 #include "../include/general.h"
 #include "../include/lineHandling.h"
+#include "../include/tables.h"
+#include "../include/reservedWords.h"
 
 
 void checkAttributeValidity(newLine *line, imageType type, symbolTable table)
@@ -25,19 +27,16 @@ void checkAttributeValidity(newLine *line, imageType type, symbolTable table)
 }
 
 
-bool labelIsDefined(char *label, newLine *line, symbolTable head, imageType type)
+bool labelIsDefined(char *label, newLine *line, symbolHashTable *table, imageType type)
 {
     bool isDefined = FALSE;
     symbolTable currentSymbol;
 
-    for (currentSymbol = head; currentSymbol != NULL ; currentSymbol = currentSymbol->next)
+    currentSymbol = findSymbol(table, label);
+    if(currentSymbol != NULL)
     {
-        if(strcmp(currentSymbol->name, label) == 0)
-        {
-            isDefined = TRUE;
-            checkAttributeValidity(line, type, currentSymbol);
-			break;
-        }
+        isDefined = TRUE;
+        checkAttributeValidity(line, type, currentSymbol);
     }
     /* An attempt of adding 'entry' attribute to a label that doesn't exist */
     if(type == entry && !isDefined)
@@ -49,28 +48,10 @@ bool labelIsDefined(char *label, newLine *line, symbolTable head, imageType type
 
 bool labelNameIsReservedWord(char *label)
 {
-    /* The total numbers of the reserved directives and instructions */
-    int i, j, numberOfInstructions, numberOfDirectives;
-    directiveWord *directive;
-    instructionWord *instruction;
-    bool isReserved = FALSE;
-
-    directive = getReservedDirectives(&numberOfDirectives);
-    instruction = getReservedInstructions(&numberOfInstructions);
-
-    /* Looking for a match between the label name and one of the instructions name */
-    for(i = 0; i < numberOfInstructions && isReserved == FALSE; i++)
-    {
-        if(strcmp(label, instruction[i].name) == 0)
-            isReserved = TRUE;
-    }
-    /* Looking for a match between the label name and one of the directives name */
-    for(j = 0; j < numberOfDirectives && isReserved == FALSE; j++)
-    {
-        if(strcmp(label, directive[j].name) == 0)
-            isReserved = TRUE;
-    }
-    return isReserved;
+    /* Looking for a match between the label name and one of the instructions/directives name */
+    if(findReservedWord(label) != NULL)
+        return TRUE;
+    return FALSE;
 }
 
 
@@ -101,9 +82,12 @@ bool symbolIsLabelDefinition(const char *lineContent, char *symbol, int *content
     int i = (*contentIndex);
     int symIndex = 0;
 
-    /* Scans the word until encounter end of label definition or end of line */
-    for(; lineContent[i] != ':' && lineContent[i] != '\n'; i++, symIndex++)
-        symbol[symIndex] = lineContent[i];
+    /* Scans the word until encounter end of label definition or end of line, keeping only what a label buffer can hold */
+    for(; lineContent[i] != ':' && lineContent[i] != '\n'; i++)
+    {
+        if(symIndex < labelBufferLength - 1)
+            symbol[symIndex++] = lineContent[i];
+    }
 
     /* If it's a label definition, update line content index to the end of the definition and saves symbol as string */
     if(lineContent[i] == ':')
@@ -123,52 +107,28 @@ void getLabelName(const char *content, int *index, char *label)
     int i = 0;
     skipSpaces(content, index);
 
-    /* Scans the label */
-    while(!isWhiteSpace(content[*index]) && content[*index] != ',')
-        label[i++] = content[(*index)++];
-
-    label[i] = '\0'; /* End of string */
-}
-
-
-void skipLabelDefinition(const char *content, int *index)
-{
-    int i;
-    /* Advance until encounter the end of a label definition or the end of the current word */
-    for(i = 0; content[i] != ':' && !isWhiteSpace(content[i]); i++);
-    /* If encounter a label setting, skip the label */
-    if(content[i] == ':')
+    /* Scans the label, a label longer than the buffer is cut - it's still reported as a too long label */
+    for(; !isWhiteSpace(content[*index]) && content[*index] != ','; (*index)++)
     {
-        i++;
-        (*index) = i;
+        if(i < labelBufferLength - 1)
+            label[i++] = content[*index];
     }
-}
-
-
-void extractLabelFromLine(char *symbol, const char *content, int index)
-{
-    /* Advance until encounter the beginning of a label */
-    for(; !isalpha(content[index]); index++);
 
-    getLabelName(content, &index, symbol);
+    label[i] = '\0'; /* End of string */
 }
 
 
-state getLabelFromTable(newLine *line, char *symbol, symbolTable *label, symbolTable table)
+state getLabelFromTable(newLine *line, char *symbol, symbolTable *label, symbolHashTable *table)
 {
-    symbolTable currentEntry;
+    (*label) = findSymbol(table, symbol);
 
-    for(currentEntry = table; currentEntry != NULL; currentEntry = currentEntry->next)
+    /* If failed to find the required label */
+    if((*label) == NULL)
     {
-        if(strcmp(symbol, currentEntry->name) == 0)
-        {
-            (*label) = currentEntry;
-            return VALID;
-        }
+        line->error = addError("The required label wasn't found");
+        return INVALID;
     }
-    /* If failed to find the required label */
-    line->error = addError("The required label wasn't found");
-    return INVALID;
+    return VALID;
 }
 
 
@@ -182,12 +142,3 @@ void checkForLabelSetting(newLine *line, char *symbol, int *contentIndex, bool *
     if(*labelSetting == TRUE && emptyLine(line->content, *contentIndex))
         line->error = addError("Missing instruction/directive after label definition");
 }
-
-
-void defineLabelAsEntry(newLine *line, symbolTable symbolTab, int *index, char *label)
-{
-    getLabelName(line->content, index, label);
-    labelIsDefined(label, line, symbolTab, entry);
-}
-
-
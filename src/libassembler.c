@@ -0,0 +1,62 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "../include/libassembler.h"
+#include "../include/files.h"
+#include "../include/lineHandling.h"
+#include "../include/createOutputFiles.h"
+#include "../include/general.h"
+
+
+state assembleSource(assemblyContext *context, const assemblerOptions *options, const char *sourceName,
+                     const char *source, unsigned long size)
+{
+    state sourceState;
+    assemblerOptions defaultOptions;
+    bool collectDiagnostics = (context->errors == NULL);
+
+    if (options == NULL)
+    {
+        setDefaultOptions(&defaultOptions);
+        options = &defaultOptions;
+    }
+    context->options = options;
+    if (collectDiagnostics)
+        context->errors = openMemoryStream(&context->diagnostics, &context->diagnosticsSize);
+
+    loadSourceBuffer(source, size, &context->source);
+    sourceState = sourceIsValid(sourceName, context);
+
+    /* The options and the stream may not outlive the call, only the results are kept in the context */
+    if (collectDiagnostics)
+    {
+        fclose(context->errors);
+        context->errors = NULL;
+    }
+    context->options = NULL;
+    return sourceState;
+}
+
+
+char *objectFileImage(assemblyContext *context, size_t *size)
+{
+    char *image = NULL;
+    FILE *stream = openMemoryStream(&image, size);
+
+    writeObjectFile(stream, &context->codeImage, &context->dataImage, context->ICF, context->DCF);
+    fclose(stream);
+    return image;
+}
+
+
+char *attributesFileImage(assemblyContext *context, imageType type, size_t *size)
+{
+    char *image = NULL;
+    FILE *stream = openMemoryStream(&image, size);
+
+    if (type == external)
+        exportToExtAndEntFiles(context->attributesTab, stream, NULL);
+    else if (type == entry)
+        exportToExtAndEntFiles(context->attributesTab, NULL, stream);
+    fclose(stream);
+    return image;
+}
@@ -1,28 +1,142 @@
 
 #include <string.h>
+#include <stdlib.h>
 #include <stdio.h>
 #include "../include/general.h"
+#include "../include/lineHandling.h"
 
 
-void skipToTheNextLine(FILE *fileDescriptor)
+void readSourceFile(FILE *fileDescriptor, sourceBuffer *source)
 {
-    int temp;
+    unsigned long capacity = 0, readBytes;
+
+    source->size = source->position = 0;
     do
     {
-        temp = fgetc(fileDescriptor);
+        /* Keeps room for a chunk, an appended '\n' and the terminating '\0' */
+        if(capacity < source->size + sourceReadChunkSize + 2)
+        {
+            capacity = (capacity == 0) ? sourceReadChunkSize + 2 : capacity * 2;
+            source->content = reallocWithCheck(source->content, capacity);
+        }
+        readBytes = fread(source->content + source->size, 1, sourceReadChunkSize, fileDescriptor);
+        source->size += readBytes;
+    }
+    while(readBytes == sourceReadChunkSize);
+
+    /* Every line, including the last one, ends with '\n' */
+    if(source->size != 0 && source->content[source->size - 1] != '\n')
+        source->content[source->size++] = '\n';
+    source->content[source->size] = '\0';
+}
+
+
+void loadSourceBuffer(const char *content, unsigned long size, sourceBuffer *source)
+{
+    /* Keeps room for an appended '\n' and the terminating '\0' */
+    source->content = reallocWithCheck(source->content, size + 2);
+    memcpy(source->content, content, size);
+    source->size = size;
+    source->position = 0;
+
+    /* Every line, including the last one, ends with '\n' */
+    if(source->size != 0 && source->content[source->size - 1] != '\n')
+        source->content[source->size++] = '\n';
+    source->content[source->size] = '\0';
+}
+
+
+long countSourceLines(const sourceBuffer *source)
+{
+    const char *lineEnd = source->content, *end = source->content + source->size;
+    long lines = 0;
+
+    /* Every line of the buffer ends with '\n' */
+    while(lineEnd < end && (lineEnd = memchr(lineEnd, '\n', end - lineEnd)) != NULL)
+    {
+        lines++;
+        lineEnd++;
+    }
+    return lines;
+}
+
+
+bool nextSourceLine(sourceBuffer *source, newLine *line)
+{
+    const char *lineEnd;
+
+    if(source->position == source->size)
+        return FALSE;
+
+    line->content = source->content + source->position;
+    lineEnd = memchr(line->content, '\n', source->size - source->position);
+    line->length = (unsigned long)(lineEnd - line->content);
+    /* Skips the line and its '\n' */
+    source->position += line->length + 1;
+    return TRUE;
+}
+
+
+void openLineStream(lineStream *stream, FILE *fileDescriptor)
+{
+    stream->fd = fileDescriptor;
+    stream->window.size = stream->window.position = 0;
+    stream->end = FALSE;
+    if(stream->capacity == 0)
+    {
+        stream->capacity = streamChunkSize + 1;
+        stream->window.content = reallocWithCheck(stream->window.content, stream->capacity);
     }
-    while(temp != '\n' && temp != EOF);
 }
 
 
-state lineLength(const char *inputLine, newLine *line, FILE *fd)
+bool nextStreamLine(lineStream *stream, newLine *line)
+{
+    sourceBuffer *window = &stream->window;
+    const char *lineEnd;
+    unsigned long rest;
+
+    while((lineEnd = memchr(window->content + window->position, '\n', window->size - window->position)) == NULL &&
+          !stream->end)
+    {
+        /* The beginning of the current line moves to the start of the window, and a chunk is read after it */
+        rest = window->size - window->position;
+        memmove(window->content, window->content + window->position, rest);
+        window->size = rest;
+        window->position = 0;
+        if(stream->capacity < rest + streamChunkSize + 1)
+        {
+            stream->capacity = rest + streamChunkSize + 1;
+            window->content = reallocWithCheck(window->content, stream->capacity);
+        }
+        window->size += fread(window->content + rest, 1, streamChunkSize, stream->fd);
+        stream->end = (window->size - rest < streamChunkSize) ? TRUE : FALSE;
+    }
+
+    if(window->position == window->size)
+        return FALSE;
+    line->content = window->content + window->position;
+    line->length = (lineEnd != NULL) ? (unsigned long)(lineEnd - line->content) : window->size - window->position;
+    /* Skips the line and its '\n' */
+    window->position += line->length + ((lineEnd != NULL) ? 1 : 0);
+    return TRUE;
+}
+
+
+void closeLineStream(lineStream *stream)
+{
+    if(stream->fd != NULL)
+        fclose(stream->fd);
+    free(stream->window.content);
+    memset(stream, 0, sizeof(lineStream));
+}
+
+
+state lineLength(newLine *line, long maxLength)
 {
-	/* If no '\n' character is found - not the entire line is scanned, meaning the line is longer than the max length */
-    if(strchr(inputLine,'\n') == NULL)
-	{
+	/* The limit is only checked, the line is processed from the source buffer whatever its length is */
+    if(maxLength > 0 && line->length > (unsigned long)maxLength)
 		line->error = addError("line is too long");
-		skipToTheNextLine(fd);
-	}
     return currentState(line);
 }
 
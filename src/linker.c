@@ -0,0 +1,535 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "../include/linker.h"
+#include "../include/files.h"
+#include "../include/lineHandling.h"
+#include "../include/createOutputFiles.h"
+#include "../include/tables.h"
+#include "../include/arena.h"
+#include "../include/general.h"
+
+
+instructionType instructionTypeOf(unsigned int opcode)
+{
+    if(opcode == 0 || opcode == 1)
+        return R;
+    if(opcode >= 10 && opcode <= 24)
+        return I;
+    return J;
+}
+
+
+void appendCodeWord(codeImageTable *table, unsigned int word, long address, long lineNumber)
+{
+    codeImageEntry *newEntry;
+
+    /* If the array is full, doubles its capacity */
+    if(table->count == table->capacity)
+    {
+        table->capacity = (table->capacity == 0) ? codeImageInitialCapacity : table->capacity * 2;
+        table->entries = reallocWithCheck(table->entries, table->capacity * sizeof(codeImageEntry));
+    }
+    newEntry = &table->entries[table->count++];
+    memset(newEntry, 0, sizeof(codeImageEntry));
+
+    /* The bit fields of all the instruction types start at the beginning of the union */
+    memcpy(&newEntry->data, &word, sizeof(word));
+    newEntry->type = instructionTypeOf(newEntry->data.typeJ.opcode);
+    newEntry->address = (int)address;
+    newEntry->lineNumber = lineNumber;
+}
+
+
+int hexDigitValue(char digit)
+{
+    if(digit >= '0' && digit <= '9')
+        return digit - '0';
+    if(digit >= 'A' && digit <= 'F')
+        return digit - 'A' + 10;
+    if(digit >= 'a' && digit <= 'f')
+        return digit - 'a' + 10;
+    return -1;
+}
+
+
+state parseObjectLine(newLine *line, dataImageTable *bytes)
+{
+    unsigned long i = 0;
+    int high, low;
+
+    /* Skips the address, the bytes are placed by their order in the file */
+    while(i < line->length && isdigit((unsigned char)line->content[i]))
+        i++;
+    if(i == 0)
+        line->error = addError("Invalid object file line, it must start with an address");
+
+    while(currentState(line) == VALID && i < line->length)
+    {
+        if(line->content[i] == ' ')
+        {
+            i++;
+            continue;
+        }
+        /* Every byte is exactly 2 hexadecimal digits, followed by a space or the end of the line */
+        high = hexDigitValue(line->content[i]);
+        low = (i + 1 < line->length) ? hexDigitValue(line->content[i + 1]) : -1;
+        if(high < 0 || low < 0 || (i + 2 < line->length && line->content[i + 2] != ' '))
+            line->error = addError("Invalid object file line, bytes must be 2 hexadecimal digits");
+        else
+        {
+            appendDataByte(bytes, high * 16 + low);
+            i += 2;
+        }
+    }
+    return currentState(line);
+}
+
+
+bool scanDecimal(const newLine *line, unsigned long *index, long *value)
+{
+    unsigned long start = *index;
+
+    for(*value = 0; *index < line->length && isdigit((unsigned char)line->content[*index]); (*index)++)
+        *value = *value * 10 + (line->content[*index] - '0');
+    return (*index != start) ? TRUE : FALSE;
+}
+
+
+state parseObjectHeader(newLine *line, long *codeSize, long *dataSize)
+{
+    unsigned long i = 0;
+
+    /* 'code size' 'data size', the code image is made of whole 4 bytes words */
+    if(!scanDecimal(line, &i, codeSize) || i == line->length || line->content[i++] != ' ' ||
+       !scanDecimal(line, &i, dataSize) || i != line->length || *codeSize % 4 != 0)
+        line->error = addError("Invalid object file header, it must hold the sizes of the code and the data images");
+    return currentState(line);
+}
+
+
+state parseSymbolLine(newLine *line, char *name, long *address)
+{
+    unsigned long i = 0, nameLength;
+
+    /* 'name address', as written by 'exportToExtAndEntFiles' */
+    while(i < line->length && line->content[i] != ' ')
+        i++;
+    nameLength = i;
+    if(nameLength == 0 || nameLength > maxLabelLength)
+        line->error = addError("Invalid symbol line, it must hold a label and an address");
+    else
+    {
+        memcpy(name, line->content, nameLength);
+        name[nameLength] = '\0';
+        i++;
+        if(!scanDecimal(line, &i, address) || i != line->length)
+            line->error = addError("Invalid symbol line, it must hold a label and an address");
+    }
+    return currentState(line);
+}
+
+
+state readModuleFile(linkerContext *linker, const char *moduleName, char *extension, sourceBuffer *content,
+        bool required)
+{
+    FILE *fileDescriptor;
+    char *fileName = getFileFullName(moduleName, extension);
+    state fileState = VALID;
+
+    if(required)
+        fileState = openFile(&fileDescriptor, fileName, "r", linker->errors);
+    else
+    {
+        /* A module without externals or entries has no '.ext' or '.ent' file */
+        fileDescriptor = fopen(fileName, "r");
+        if(fileDescriptor == NULL)
+            fileState = INVALID;
+    }
+    if(fileState == VALID)
+    {
+        readSourceFile(fileDescriptor, content);
+        fclose(fileDescriptor);
+    }
+    else if(required)
+        linker->errorCount++;
+    free(fileName);
+    return fileState;
+}
+
+
+void reportLinkerError(linkerContext *linker, newLine *line)
+{
+    printLineError(line, linker->errors);
+    linker->errorCount++;
+}
+
+
+char *moduleFileName(const linkerModule *module, char *extension)
+{
+    char *fileName;
+
+    /* The errors of a module assembled in memory refer to the lines of its source file */
+    if(module->assembled != NULL)
+    {
+        fileName = (char *) callocWithCheck(strlen(module->name) + 1);
+        strcpy(fileName, module->name);
+        return fileName;
+    }
+    return getFileFullName(module->name, extension);
+}
+
+
+state parseObjectFile(sourceBuffer *content, newLine *line, codeImageTable *codeImage, dataImageTable *dataImage,
+        long codeBase, long *codeSize, long *dataSize)
+{
+    dataImageTable bytes = {0};
+    unsigned long i;
+    unsigned int word;
+
+    /* The first line holds the sizes of the code image and the data image */
+    line->number = 1;
+    if(!nextSourceLine(content, line))
+        line->error = addError("Invalid object file header, it must hold the sizes of the code and the data images");
+    else
+        parseObjectHeader(line, codeSize, dataSize);
+
+    while(currentState(line) == VALID && nextSourceLine(content, line))
+    {
+        line->number++;
+        parseObjectLine(line, &bytes);
+    }
+
+    if(currentState(line) == VALID && (long)bytes.size != *codeSize + *dataSize)
+        line->error = addError("The object file doesn't hold the number of bytes its header declares");
+
+    if(currentState(line) == VALID)
+    {
+        /* The code image is made of 4 bytes words (the least significant byte first), followed by the data image */
+        for(i = 0; i < (unsigned long)*codeSize; i += 4)
+        {
+            word = (unsigned int)bytes.bytes[i] | (unsigned int)bytes.bytes[i + 1] << 8 |
+                   (unsigned int)bytes.bytes[i + 2] << 16 | (unsigned int)bytes.bytes[i + 3] << 24;
+            appendCodeWord(codeImage, word, codeBase + (long)i, (long)(i / 4) + 2);
+        }
+        if(*dataSize != 0)
+        {
+            reserveDataBytes(dataImage, (unsigned long)*dataSize);
+            memcpy(dataImage->bytes + dataImage->size, bytes.bytes + *codeSize, (unsigned long)*dataSize);
+            dataImage->size += (unsigned long)*dataSize;
+        }
+    }
+    free(bytes.bytes);
+    return currentState(line);
+}
+
+
+void loadObjectFile(linkerContext *linker, linkerModule *module)
+{
+    sourceBuffer content = {0};
+    newLine line = {0};
+    char *fileName = getFileFullName(module->name, ".ob");
+
+    module->codeBase = ICInitialValue + (long)linker->codeImage.count * 4;
+    module->firstCodeEntry = linker->codeImage.count;
+    line.sourceFileName = fileName;
+
+    /* The data is appended to the linked data image, its address is known once all the code is loaded */
+    if(readModuleFile(linker, module->name, ".ob", &content, TRUE) == VALID &&
+       parseObjectFile(&content, &line, &linker->codeImage, &linker->dataImage, module->codeBase,
+                       &module->codeSize, &module->dataSize) == INVALID)
+    {
+        reportLinkerError(linker, &line);
+        module->codeSize = module->dataSize = 0;
+    }
+    free(content.content);
+    free(fileName);
+}
+
+
+void loadAssembledModule(linkerContext *linker, linkerModule *module)
+{
+    assemblyContext *context = module->assembled;
+    unsigned long i;
+    unsigned int word;
+
+    module->codeBase = ICInitialValue + (long)linker->codeImage.count * 4;
+    module->firstCodeEntry = linker->codeImage.count;
+    module->codeSize = (long)context->codeImage.count * 4;
+    module->dataSize = (long)context->dataImage.size;
+
+    /* The instructions keep the line numbers of the source, for the errors of the relocation */
+    for(i = 0; i < context->codeImage.count; i++)
+    {
+        memcpy(&word, &context->codeImage.entries[i].data, sizeof(word));
+        appendCodeWord(&linker->codeImage, word, module->codeBase + (long)i * 4, context->codeImage.entries[i].lineNumber);
+    }
+    reserveDataBytes(&linker->dataImage, context->dataImage.size);
+    memcpy(linker->dataImage.bytes + linker->dataImage.size, context->dataImage.bytes, context->dataImage.size);
+    linker->dataImage.size += context->dataImage.size;
+}
+
+
+state relocateAddress(const linkerModule *module, long address, long *linkedAddress)
+{
+    /* Within the module the code starts at 100, and the data starts right after the code */
+    if(address >= ICInitialValue && address < ICInitialValue + module->codeSize)
+        *linkedAddress = module->codeBase + (address - ICInitialValue);
+    else if(address >= ICInitialValue + module->codeSize && address < ICInitialValue + module->codeSize + module->dataSize)
+        *linkedAddress = module->dataBase + (address - ICInitialValue - module->codeSize);
+    else
+        return INVALID;
+    return VALID;
+}
+
+
+void relocateModule(linkerContext *linker, linkerModule *module)
+{
+    codeImageEntry *codeEntry;
+    unsigned long i, numOfEntries = (unsigned long)module->codeSize / 4;
+    long address, target, linkedTarget;
+    unsigned int opcode;
+    newLine line = {0};
+    char *fileName = moduleFileName(module, ".ob");
+
+    line.sourceFileName = fileName;
+    for(i = 0; i < numOfEntries; i++)
+    {
+        codeEntry = &linker->codeImage.entries[module->firstCodeEntry + i];
+        opcode = codeEntry->data.typeJ.opcode;
+        address = ICInitialValue + (long)i * 4;
+        line.number = codeEntry->lineNumber;
+        line.error = NULL;
+
+        /* A label operand of 'jmp'/'la'/'call' holds the address of the label (0 for an external label, patched later) */
+        if(codeEntry->type == J && opcode != 63 && codeEntry->data.typeJ.reg == 0 && codeEntry->data.typeJ.address != 0)
+        {
+            if(relocateAddress(module, (long)codeEntry->data.typeJ.address, &linkedTarget) == INVALID)
+                line.error = addError("The address of the label operand isn't in the module");
+            else if(linkedTarget > max25bitsIntVal)
+                line.error = addError("The linked address of the label operand doesn't fit in 25 bits");
+            else
+                codeEntry->data.typeJ.address = (unsigned int)linkedTarget;
+        }
+        /* A conditional branch holds the distance to its label, which changes only if the label is in the data image */
+        else if(opcode >= 15 && opcode <= 18)
+        {
+            target = address + codeEntry->data.typeI.immed;
+            if(relocateAddress(module, target, &linkedTarget) == VALID)
+            {
+                linkedTarget -= module->codeBase + (long)i * 4;
+                if(linkedTarget < min2BytesIntVal || linkedTarget > max2BytesIntVal)
+                    line.error = addError("The linked distance to the branch label doesn't fit in 16 bits");
+                else
+                    codeEntry->data.typeI.immed = (int)linkedTarget;
+            }
+        }
+        if(currentState(&line) == INVALID)
+            reportLinkerError(linker, &line);
+    }
+    free(fileName);
+}
+
+
+void addGlobalEntry(linkerContext *linker, const linkerModule *module, newLine *line, char *name, long address)
+{
+    long linkedAddress;
+    symbolTable symbol;
+
+    if(relocateAddress(module, address, &linkedAddress) == INVALID)
+        line->error = addError("The address of the entry isn't in the module");
+    else if((symbol = findSymbol(&linker->globals, name)) == NULL)
+        addToSymbolTable(&linker->globals, name, linkedAddress,
+                         (linkedAddress < module->codeBase + module->codeSize) ? code : data, &linker->memory);
+    /* The modules don't overlap, so the same address means the module already entered the label */
+    else if(symbol->value != linkedAddress)
+        line->error = addError("The entry is already defined by another module");
+}
+
+
+void patchExternalReference(linkerContext *linker, const linkerModule *module, newLine *line, char *name,
+        long address)
+{
+    symbolTable symbol;
+    codeImageEntry *codeEntry;
+
+    /* Every reference site is a 'jmp'/'la'/'call' instruction of the module */
+    if(address < ICInitialValue || address >= ICInitialValue + module->codeSize || (address - ICInitialValue) % 4 != 0)
+        line->error = addError("The address of the reference isn't an instruction of the module");
+    else if((symbol = findSymbol(&linker->globals, name)) == NULL)
+        line->error = addError("The external label isn't an entry of any module");
+    else
+    {
+        codeEntry = &linker->codeImage.entries[module->firstCodeEntry + (unsigned long)(address - ICInitialValue) / 4];
+        if(codeEntry->type != J || codeEntry->data.typeJ.reg != 0)
+            line->error = addError("The reference isn't a 'J' instruction with a label operand");
+        else if(symbol->value > max25bitsIntVal)
+            line->error = addError("The linked address of the label doesn't fit in 25 bits");
+        else
+            codeEntry->data.typeJ.address = (unsigned int)symbol->value;
+    }
+}
+
+
+void loadEntries(linkerContext *linker, linkerModule *module)
+{
+    sourceBuffer content = {0};
+    newLine line = {0};
+    char name[labelBufferLength];
+    long address;
+    unsigned long i;
+    symbolTable symbol;
+    char *fileName = moduleFileName(module, ".ent");
+
+    line.sourceFileName = fileName;
+    /* A module assembled in memory has its '.entry' directives, with their lines, and the addresses in its symbol table */
+    if(module->assembled != NULL)
+    {
+        for(i = 0; i < module->assembled->entries.count; i++)
+        {
+            line.number = module->assembled->entries.entries[i].lineNumber;
+            line.error = NULL;
+            symbol = findSymbol(&module->assembled->symbolTab, module->assembled->entries.entries[i].name);
+            if(symbol != NULL)
+                addGlobalEntry(linker, module, &line, symbol->name, symbol->value);
+            if(currentState(&line) == INVALID)
+                reportLinkerError(linker, &line);
+        }
+    }
+    else if(readModuleFile(linker, module->name, ".ent", &content, FALSE) == VALID)
+    {
+        for(line.number = 1; nextSourceLine(&content, &line); line.number++)
+        {
+            line.error = NULL;
+            if(parseSymbolLine(&line, name, &address) == VALID)
+                addGlobalEntry(linker, module, &line, name, address);
+            if(currentState(&line) == INVALID)
+                reportLinkerError(linker, &line);
+        }
+    }
+    free(content.content);
+    free(fileName);
+}
+
+
+void patchExternals(linkerContext *linker, linkerModule *module)
+{
+    sourceBuffer content = {0};
+    newLine line = {0};
+    char name[labelBufferLength];
+    long address;
+    attributesTable attribute;
+    char *fileName = moduleFileName(module, ".ext");
+
+    line.sourceFileName = fileName;
+    /* A module assembled in memory has its references in its attributes table, they're reported by their source lines */
+    if(module->assembled != NULL)
+    {
+        for(attribute = module->assembled->attributesTab; attribute != NULL; attribute = attribute->next)
+        {
+            if(attribute->type != external)
+                continue;
+            line.number = module->assembled->codeImage.entries[(attribute->address - ICInitialValue) / 4].lineNumber;
+            line.error = NULL;
+            patchExternalReference(linker, module, &line, attribute->name, attribute->address);
+            if(currentState(&line) == INVALID)
+                reportLinkerError(linker, &line);
+        }
+    }
+    else if(readModuleFile(linker, module->name, ".ext", &content, FALSE) == VALID)
+    {
+        for(line.number = 1; nextSourceLine(&content, &line); line.number++)
+        {
+            line.error = NULL;
+            if(parseSymbolLine(&line, name, &address) == VALID)
+                patchExternalReference(linker, module, &line, name, address);
+            if(currentState(&line) == INVALID)
+                reportLinkerError(linker, &line);
+        }
+    }
+    free(content.content);
+    free(fileName);
+}
+
+
+state resolveModules(linkerContext *linker)
+{
+    int i;
+
+    /* The data images are loaded one after the other, after all the code */
+    for(i = 0; i < linker->numOfModules; i++)
+        linker->modules[i].dataBase = (i == 0) ? ICInitialValue + (long)linker->codeImage.count * 4 :
+                                      linker->modules[i - 1].dataBase + linker->modules[i - 1].dataSize;
+
+    /* The entries must all be known before any reference to them is patched */
+    for(i = 0; i < linker->numOfModules; i++)
+    {
+        relocateModule(linker, &linker->modules[i]);
+        loadEntries(linker, &linker->modules[i]);
+    }
+    for(i = 0; i < linker->numOfModules; i++)
+        patchExternals(linker, &linker->modules[i]);
+
+    return (linker->errorCount == 0) ? VALID : INVALID;
+}
+
+
+state linkModules(linkerContext *linker, char **moduleNames, int numOfModules)
+{
+    int i;
+
+    linker->modules = (linkerModule *) callocWithCheck(numOfModules * sizeof(linkerModule));
+    linker->numOfModules = numOfModules;
+
+    /* Loads the code images one after the other, the data images follow all the code */
+    for(i = 0; i < numOfModules; i++)
+    {
+        linker->modules[i].name = moduleNames[i];
+        loadObjectFile(linker, &linker->modules[i]);
+    }
+    return resolveModules(linker);
+}
+
+
+state linkAssembledFiles(linkerContext *linker, assemblyContext *contexts, char **fileNames, int numOfFiles)
+{
+    int i;
+
+    linker->modules = (linkerModule *) callocWithCheck(numOfFiles * sizeof(linkerModule));
+    linker->numOfModules = numOfFiles;
+
+    for(i = 0; i < numOfFiles; i++)
+    {
+        linker->modules[i].name = fileNames[i];
+        linker->modules[i].assembled = &contexts[i];
+        loadAssembledModule(linker, &linker->modules[i]);
+    }
+    return resolveModules(linker);
+}
+
+
+void writeLinkedImage(linkerContext *linker, const char *outputName)
+{
+    FILE *fileDescriptor;
+
+    if(openFile(&fileDescriptor, outputName, "w", linker->errors) == VALID)
+    {
+        writeObjectFile(fileDescriptor, &linker->codeImage, &linker->dataImage,
+                        ICInitialValue + (long)linker->codeImage.count * 4, (long)linker->dataImage.size);
+        fclose(fileDescriptor);
+    }
+    else
+        linker->errorCount++;
+}
+
+
+void freeLinkerContext(linkerContext *linker)
+{
+    free(linker->modules);
+    free(linker->globals.slots);
+    free(linker->codeImage.entries);
+    free(linker->dataImage.bytes);
+    freeArena(&linker->memory);
+    memset(linker, 0, sizeof(linkerContext));
+}
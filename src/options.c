@@ -0,0 +1,244 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "../include/options.h"
+#include "../include/files.h"
+#include "../include/lineHandling.h"
+#include "../include/general.h"
+
+
+void setDefaultOptions(assemblerOptions *options)
+{
+    options->maxLineLength = defaultMaxLineLength;
+    options->jobs = 1;
+    options->firstPassThreads = 1;
+    options->fixupThreads = 1;
+    options->firstPassChunkSize = firstPassChunkMinimumSize;
+    options->fixupChunkSize = fixupChunkMinimumSize;
+    options->pipelined = FALSE;
+    options->cacheDirectory = NULL;
+    options->cacheSizeLimit = defaultCacheSizeLimit;
+    options->cacheStats = FALSE;
+    options->linkedFileName = NULL;
+    options->statistics = noStatistics;
+    options->timingSummary = FALSE;
+    options->serverSocket = NULL;
+}
+
+
+state scanOptionValue(const char *optionName, const char *value, long *result)
+{
+    char *end;
+
+    if(value == NULL || !isdigit((unsigned char)value[0]))
+    {
+        fprintf(stderr, "Error: option '%s' requires a non-negative integer value.\n", optionName);
+        return INVALID;
+    }
+    *result = strtol(value, &end, 10);
+    if(*end != '\0')
+    {
+        fprintf(stderr, "Error: option '%s' requires a non-negative integer value.\n", optionName);
+        return INVALID;
+    }
+    return VALID;
+}
+
+
+void addInputFile(inputFileList *files, char *name)
+{
+    if(files->count == files->capacity)
+    {
+        files->capacity = (files->capacity == 0) ? 16 : files->capacity * 2;
+        files->names = reallocWithCheck(files->names, files->capacity * sizeof(char *));
+    }
+    files->names[files->count++] = name;
+}
+
+
+state readFileList(const char *listName, inputFileList *files)
+{
+    FILE *fileDescriptor = stdin;
+    sourceBuffer *list;
+    char *name, *end, *lineEnd;
+
+    if(strcmp(listName, "-") != 0 && openFile(&fileDescriptor, listName, "r", stderr) == INVALID)
+        return INVALID;
+
+    files->lists = reallocWithCheck(files->lists, (files->numOfLists + 1) * sizeof(sourceBuffer));
+    list = &files->lists[files->numOfLists++];
+    memset(list, 0, sizeof(sourceBuffer));
+    readSourceFile(fileDescriptor, list);
+    if(fileDescriptor != stdin)
+        fclose(fileDescriptor);
+
+    /* Every line of the list ends with '\n', the names are terminated in place */
+    for(name = list->content; *name != '\0'; name = lineEnd + 1)
+    {
+        lineEnd = strchr(name, '\n');
+        for(end = lineEnd; end > name && isspace((unsigned char)end[-1]); end--);
+        *end = '\0';
+        while(isspace((unsigned char)*name))
+            name++;
+        /* Empty lines and lines starting with '#' don't name a file */
+        if(*name != '\0' && *name != '#')
+            addInputFile(files, name);
+    }
+    return VALID;
+}
+
+
+void freeInputFileList(inputFileList *files)
+{
+    int i;
+
+    for(i = 0; i < files->numOfLists; i++)
+        free(files->lists[i].content);
+    free(files->lists);
+    free(files->names);
+    memset(files, 0, sizeof(inputFileList));
+}
+
+
+state parseOptions(int argc, char *argv[], assemblerOptions *options, inputFileList *files)
+{
+    int i;
+
+    for(i = 1; i < argc; i++)
+    {
+        if(strcmp(argv[i], "--max-line-length") == 0)
+        {
+            if(scanOptionValue(argv[i], (i + 1 < argc) ? argv[i + 1] : NULL, &options->maxLineLength) == INVALID)
+                return INVALID;
+            i++;
+        }
+        else if(strcmp(argv[i], "-j") == 0)
+        {
+            if(scanOptionValue(argv[i], (i + 1 < argc) ? argv[i + 1] : NULL, &options->jobs) == INVALID)
+                return INVALID;
+            if(options->jobs == 0)
+            {
+                fprintf(stderr, "Error: option '-j' requires at least one job.\n");
+                return INVALID;
+            }
+            i++;
+        }
+        else if(strcmp(argv[i], "--first-pass-threads") == 0)
+        {
+            if(scanOptionValue(argv[i], (i + 1 < argc) ? argv[i + 1] : NULL, &options->firstPassThreads) == INVALID)
+                return INVALID;
+            if(options->firstPassThreads == 0)
+            {
+                fprintf(stderr, "Error: option '--first-pass-threads' requires at least one thread.\n");
+                return INVALID;
+            }
+            i++;
+        }
+        else if(strcmp(argv[i], "--first-pass-chunk") == 0)
+        {
+            if(scanOptionValue(argv[i], (i + 1 < argc) ? argv[i + 1] : NULL, &options->firstPassChunkSize) == INVALID)
+                return INVALID;
+            if(options->firstPassChunkSize == 0)
+            {
+                fprintf(stderr, "Error: option '--first-pass-chunk' requires at least one byte.\n");
+                return INVALID;
+            }
+            i++;
+        }
+        else if(strcmp(argv[i], "--fixup-chunk") == 0)
+        {
+            if(scanOptionValue(argv[i], (i + 1 < argc) ? argv[i + 1] : NULL, &options->fixupChunkSize) == INVALID)
+                return INVALID;
+            if(options->fixupChunkSize == 0)
+            {
+                fprintf(stderr, "Error: option '--fixup-chunk' requires at least one fixup.\n");
+                return INVALID;
+            }
+            i++;
+        }
+        else if(strcmp(argv[i], "--fixup-threads") == 0)
+        {
+            if(scanOptionValue(argv[i], (i + 1 < argc) ? argv[i + 1] : NULL, &options->fixupThreads) == INVALID)
+                return INVALID;
+            if(options->fixupThreads == 0)
+            {
+                fprintf(stderr, "Error: option '--fixup-threads' requires at least one thread.\n");
+                return INVALID;
+            }
+            i++;
+        }
+        else if(strcmp(argv[i], "--cache-dir") == 0)
+        {
+            if(i + 1 == argc)
+            {
+                fprintf(stderr, "Error: option '%s' requires a directory.\n", argv[i]);
+                return INVALID;
+            }
+            options->cacheDirectory = argv[++i];
+        }
+        else if(strcmp(argv[i], "--cache-size") == 0)
+        {
+            if(scanOptionValue(argv[i], (i + 1 < argc) ? argv[i + 1] : NULL, &options->cacheSizeLimit) == INVALID)
+                return INVALID;
+            i++;
+        }
+        else if(strcmp(argv[i], "--pipeline") == 0)
+            options->pipelined = TRUE;
+        else if(strcmp(argv[i], "--cache-stats") == 0)
+            options->cacheStats = TRUE;
+        else if(strcmp(argv[i], "--stats") == 0)
+            options->statistics = textStatistics;
+        else if(strcmp(argv[i], "--stats-json") == 0)
+            options->statistics = jsonStatistics;
+        else if(strcmp(argv[i], "--timings") == 0)
+            options->timingSummary = TRUE;
+        else if(strcmp(argv[i], "--files-from") == 0)
+        {
+            if(i + 1 == argc)
+            {
+                fprintf(stderr, "Error: option '%s' requires a file name.\n", argv[i]);
+                return INVALID;
+            }
+            if(readFileList(argv[++i], files) == INVALID)
+                return INVALID;
+        }
+        else if(argv[i][0] == '@' && argv[i][1] != '\0')
+        {
+            if(readFileList(argv[i] + 1, files) == INVALID)
+                return INVALID;
+        }
+        else if(strcmp(argv[i], "--serve") == 0)
+        {
+            /* A server takes no input files, an argument that isn't an option names its socket */
+            if(i + 1 < argc && argv[i + 1][0] != '-')
+                options->serverSocket = argv[++i];
+            else
+                options->serverSocket = "";
+        }
+        else if(strcmp(argv[i], "--link") == 0)
+        {
+            if(i + 1 == argc)
+            {
+                fprintf(stderr, "Error: option '%s' requires a file name.\n", argv[i]);
+                return INVALID;
+            }
+            options->linkedFileName = argv[++i];
+        }
+        else if(argv[i][0] == '-' && argv[i][1] != '\0')
+        {
+            fprintf(stderr, "Error: unknown option '%s'.\n", argv[i]);
+            return INVALID;
+        }
+        /* Every other argument is the name of an input file */
+        else
+            addInputFile(files, argv[i]);
+    }
+    /* The linked files have no output files of their own for the pipeline to write */
+    if(options->pipelined && options->linkedFileName != NULL)
+    {
+        fprintf(stderr, "Error: option '--pipeline' can't be used with '--link'.\n");
+        return INVALID;
+    }
+    return VALID;
+}
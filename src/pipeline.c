@@ -0,0 +1,362 @@
+/* For 'sysconf' and the POSIX threads */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "../include/pipeline.h"
+#include "../include/firstPass.h"
+#include "../include/files.h"
+#include "../include/lineHandling.h"
+#include "../include/binary.h"
+#include "../include/tables.h"
+#include "../include/outputWriter.h"
+#include "../include/createOutputFiles.h"
+#include "../include/general.h"
+#include "../include/statistics.h"
+
+
+void initPipelineQueue(pipelineQueue *queue)
+{
+    queue->head = queue->tail = queue->waiters = 0;
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->changed, NULL);
+    queue->spinLimit = sysconf(_SC_NPROCESSORS_ONLN) > 1 ? pipelineSpinLimit : 0;
+}
+
+
+unsigned long loadQueueIndex(pipelineQueue *queue, unsigned long *index)
+{
+#ifdef __GNUC__
+    (void)queue;
+    return __atomic_load_n(index, __ATOMIC_SEQ_CST);
+#else
+    unsigned long value;
+
+    pthread_mutex_lock(&queue->lock);
+    value = *index;
+    pthread_mutex_unlock(&queue->lock);
+    return value;
+#endif
+}
+
+
+void storeQueueIndex(pipelineQueue *queue, unsigned long *index, unsigned long value)
+{
+#ifdef __GNUC__
+    __atomic_store_n(index, value, __ATOMIC_SEQ_CST);
+    /* The lock is only taken when the other stage sleeps, it can't miss the signal while it's going to sleep */
+    if(__atomic_load_n(&queue->waiters, __ATOMIC_SEQ_CST) != 0)
+    {
+        pthread_mutex_lock(&queue->lock);
+        pthread_cond_broadcast(&queue->changed);
+        pthread_mutex_unlock(&queue->lock);
+    }
+#else
+    pthread_mutex_lock(&queue->lock);
+    *index = value;
+    if(queue->waiters != 0)
+        pthread_cond_broadcast(&queue->changed);
+    pthread_mutex_unlock(&queue->lock);
+#endif
+}
+
+
+void waitForQueue(pipelineQueue *queue, unsigned long *index, unsigned long value, int *spins)
+{
+    /* A short wait is spun away, a longer one sleeps until the other stage moves */
+    if(++(*spins) <= queue->spinLimit)
+        return;
+
+    pthread_mutex_lock(&queue->lock);
+#ifdef __GNUC__
+    __atomic_add_fetch(&queue->waiters, 1, __ATOMIC_SEQ_CST);
+    while(__atomic_load_n(index, __ATOMIC_SEQ_CST) == value)
+        pthread_cond_wait(&queue->changed, &queue->lock);
+    __atomic_sub_fetch(&queue->waiters, 1, __ATOMIC_SEQ_CST);
+#else
+    queue->waiters++;
+    while(*index == value)
+        pthread_cond_wait(&queue->changed, &queue->lock);
+    queue->waiters--;
+#endif
+    pthread_mutex_unlock(&queue->lock);
+}
+
+
+void pushPipelineQueue(pipelineQueue *queue, void *item)
+{
+    /* Only the producer writes 'tail', so it reads it without synchronization */
+    unsigned long tail = queue->tail, head;
+    int spins = 0;
+
+    while(tail - (head = loadQueueIndex(queue, &queue->head)) == pipelineQueueSize)
+        waitForQueue(queue, &queue->head, head, &spins);
+    queue->items[tail & (pipelineQueueSize - 1)] = item;
+    /* The item is published along with the new tail */
+    storeQueueIndex(queue, &queue->tail, tail + 1);
+}
+
+
+void *popPipelineQueue(pipelineQueue *queue)
+{
+    /* Only the consumer writes 'head', so it reads it without synchronization */
+    unsigned long head = queue->head, tail;
+    int spins = 0;
+    void *item;
+
+    while((tail = loadQueueIndex(queue, &queue->tail)) == head)
+        waitForQueue(queue, &queue->tail, tail, &spins);
+    item = queue->items[head & (pipelineQueueSize - 1)];
+    storeQueueIndex(queue, &queue->head, head + 1);
+    return item;
+}
+
+
+void *readerStage(void *pipeline)
+{
+    assemblyPipeline *stages = (assemblyPipeline *) pipeline;
+    unsigned long carrySize = 0, readSize, readBytes, size, end;
+    char *carry = NULL, *content;
+    sourceBlock *block;
+    bool atEnd;
+
+    do
+    {
+        /* A line longer than a block is read in growing blocks, so it's copied a constant number of times */
+        readSize = (carrySize > pipelineBlockSize) ? carrySize : pipelineBlockSize;
+        content = reallocWithCheck(NULL, carrySize + readSize + 2);
+        if(carrySize != 0)
+            memcpy(content, carry, carrySize);
+        readBytes = fread(content + carrySize, 1, readSize, stages->input);
+        size = carrySize + readBytes;
+        atEnd = (readBytes < readSize) ? TRUE : FALSE;
+
+        /* The block ends with its last whole line, the rest of the line is carried to the next block */
+        if(atEnd)
+        {
+            if(size != 0 && content[size - 1] != '\n')
+                content[size++] = '\n';
+            end = size;
+        }
+        else
+            for(end = size; end > 0 && content[end - 1] != '\n'; end--);
+        carrySize = size - end;
+        carry = reallocWithCheck(carry, carrySize + 1);
+        memcpy(carry, content + end, carrySize);
+
+        if(end == 0)
+            free(content);
+        else
+        {
+            content[end] = '\0';
+            block = (sourceBlock *) callocWithCheck(sizeof(sourceBlock));
+            block->source.content = content;
+            block->source.size = end;
+            pushPipelineQueue(&stages->blocks, block);
+        }
+    }
+    while(!atEnd);
+
+    free(carry);
+    pushPipelineQueue(&stages->blocks, NULL);
+    return NULL;
+}
+
+
+void *writerStage(void *pipeline)
+{
+    assemblyPipeline *stages = (assemblyPipeline *) pipeline;
+    FILE *text = openMemoryStream(&stages->codeText, &stages->codeTextSize);
+    outputWriter *writer = (outputWriter *) callocWithCheck(sizeof(outputWriter));
+    codeBatch *batch;
+
+    initOutputWriter(writer, text);
+    while((batch = (codeBatch *) popPipelineQueue(&stages->batches)) != NULL)
+    {
+        exportCodeEntries(batch->entries, batch->count, writer);
+        free(batch->entries);
+        free(batch);
+    }
+    flushOutputWriter(writer);
+    fclose(text);
+    free(writer);
+    return NULL;
+}
+
+
+void handResolvedPrefix(assemblyPipeline *pipeline, assemblyContext *context)
+{
+    codeImageTable *image = &context->codeImage;
+    fixupTable *fixups = &context->fixups;
+    unsigned long first = pipeline->formatted;
+    newLine line = {0};
+    symbolTable label;
+    fixupEntry *fixup;
+    codeBatch *batch;
+    long distance;
+
+    while(!pipeline->prefixBlocked && pipeline->formatted < image->count)
+    {
+        if(pipeline->nextFixup < fixups->count && fixups->entries[pipeline->nextFixup].codeIndex == pipeline->formatted)
+        {
+            /* A data label gets its address only once the code image is complete */
+            fixup = &fixups->entries[pipeline->nextFixup];
+            label = findSymbol(&context->symbolTab, fixup->symbol);
+            if(label == NULL || (label->type != code && !(label->isExternal && fixup->type == J)))
+                break;
+            if(fixup->type == I)
+            {
+                distance = label->value - image->entries[pipeline->formatted].address;
+                /* The branch will be relaxed, which moves every instruction after it */
+                if(distance < min2BytesIntVal || distance > max2BytesIntVal)
+                {
+                    pipeline->prefixBlocked = TRUE;
+                    break;
+                }
+            }
+            if(encodeFixup(&line, fixup, context) == NULL || line.error != NULL)
+                break;
+            pipeline->nextFixup++;
+        }
+        pipeline->formatted++;
+    }
+
+    if(pipeline->formatted > first)
+    {
+        batch = (codeBatch *) callocWithCheck(sizeof(codeBatch));
+        batch->count = pipeline->formatted - first;
+        batch->entries = (codeImageEntry *) callocWithCheck(batch->count * sizeof(codeImageEntry));
+        memcpy(batch->entries, image->entries + first, batch->count * sizeof(codeImageEntry));
+        pushPipelineQueue(&pipeline->batches, batch);
+    }
+}
+
+
+state parserStage(assemblyPipeline *pipeline, newLine *line, long *IC, assemblyContext *context)
+{
+    state process = VALID;
+    long nextLineNumber = 1;
+    sourceBlock *block;
+
+    while((block = (sourceBlock *) popPipelineQueue(&pipeline->blocks)) != NULL)
+    {
+        context->source = block->source;
+        if(firstPassFrom(line, nextLineNumber, IC, context) == INVALID)
+            process = INVALID;
+        nextLineNumber = line->number;
+
+        /* The lines of the block were all parsed, the tables hold copies of everything they need */
+        free(block->source.content);
+        free(block);
+        memset(&context->source, 0, sizeof(sourceBuffer));
+
+        /* The outputs of an invalid file are never created, so there's nothing to format */
+        if(process == VALID)
+            handResolvedPrefix(pipeline, context);
+    }
+    pushPipelineQueue(&pipeline->batches, NULL);
+    line->number = nextLineNumber;
+    return process;
+}
+
+
+state assembleStreamPipelined(const char *fileName, FILE *input, assemblyContext *context)
+{
+    assemblyPipeline pipeline = {0};
+    newLine line = {0};
+    long instructionCounter = ICInitialValue;
+    unsigned long parsedWords;
+    state fileState;
+    double start;
+
+    pipeline.input = input;
+    initPipelineQueue(&pipeline.blocks);
+    initPipelineQueue(&pipeline.batches);
+    line.sourceFileName = fileName;
+
+    /* Without the threads of the stages the file is assembled like in the other modes */
+    if(pthread_create(&pipeline.writer, NULL, writerStage, &pipeline) != 0)
+        return assembleStreamSerially(fileName, input, context);
+    if(pthread_create(&pipeline.reader, NULL, readerStage, &pipeline) != 0)
+    {
+        pushPipelineQueue(&pipeline.batches, NULL);
+        pthread_join(pipeline.writer, NULL);
+        free(pipeline.codeText);
+        return assembleStreamSerially(fileName, input, context);
+    }
+
+    /* The reading of the file is timed as part of the first pass, they overlap */
+    start = phaseStart(context);
+    fileState = parserStage(&pipeline, &line, &instructionCounter, context);
+    pthread_join(pipeline.reader, NULL);
+    phaseEnd(context, firstPassPhase, start);
+
+    /* The second pass runs while the writer is still formatting the prefix */
+    parsedWords = context->codeImage.count;
+    fileState = completeSource(context, &line, fileState, instructionCounter);
+    pthread_join(pipeline.writer, NULL);
+
+    if(fileState == VALID)
+    {
+        /* The prefix was formatted with the addresses of the first pass, relaxed branches moved them */
+        if(context->codeImage.count != parsedWords)
+            pipeline.formatted = pipeline.codeTextSize = 0;
+        createOutputFilesWithPrefix(fileName, context, pipeline.codeText, pipeline.codeTextSize, pipeline.formatted);
+    }
+    free(pipeline.codeText);
+    pthread_mutex_destroy(&pipeline.blocks.lock);
+    pthread_mutex_destroy(&pipeline.batches.lock);
+    pthread_cond_destroy(&pipeline.blocks.changed);
+    pthread_cond_destroy(&pipeline.batches.changed);
+    return fileState;
+}
+
+
+state assembleStreamSerially(const char *fileName, FILE *input, assemblyContext *context)
+{
+    state fileState;
+
+    rewind(input);
+    readSourceFile(input, &context->source);
+    if((fileState = sourceIsValid(fileName, context)) == VALID)
+        createOutputFiles(fileName, context);
+    return fileState;
+}
+
+
+state assemblePipelined(const char *fileName, assemblyContext *context)
+{
+    FILE *input;
+    state fileState;
+
+    if(openFile(&input, fileName, "r", context->errors) == INVALID)
+        return INVALID;
+    fileState = assembleStreamPipelined(fileName, input, context);
+    fclose(input);
+    return fileState;
+}
+
+
+state assembleSourcePipelined(const char *fileName, assemblyContext *context)
+{
+    sourceBuffer source = context->source;
+    FILE *input;
+    state fileState;
+
+    /* The parser takes the source a block at a time, the whole source is read back from memory */
+    memset(&context->source, 0, sizeof(sourceBuffer));
+    if(source.size == 0 || (input = fmemopen(source.content, source.size, "r")) == NULL)
+    {
+        context->source = source;
+        if((fileState = sourceIsValid(fileName, context)) == VALID)
+            createOutputFiles(fileName, context);
+        return fileState;
+    }
+    fileState = assembleStreamPipelined(fileName, input, context);
+    fclose(input);
+    /* The source stays in the context, as in the serial modes (its size is stored in the cache entry) */
+    context->source = source;
+    return fileState;
+}
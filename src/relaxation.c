@@ -0,0 +1,215 @@
+#include <stdlib.h>
+#include <string.h>
+#include "../include/relaxation.h"
+#include "../include/tables.h"
+#include "../include/general.h"
+
+/* The opcodes of the conditional branches and of 'jmp' */
+#define bneOpcode 15
+#define beqOpcode 16
+#define bltOpcode 17
+#define bgtOpcode 18
+#define jmpOpcode 30
+
+
+void addGrowth(branchRelaxation *relaxation, unsigned long index, long bytes)
+{
+    unsigned long i;
+
+    /* The tree is 1-based, node i covers the (i & -i) instructions that end at instruction i - 1 */
+    for(i = index + 1; i <= relaxation->numOfWords; i += i & (~i + 1))
+        relaxation->growth[i] += bytes;
+    relaxation->totalGrowth += bytes;
+}
+
+
+long relaxedAddress(const branchRelaxation *relaxation, unsigned long index)
+{
+    long address = ICInitialValue + (long)index * 4;
+    unsigned long i;
+
+    /* The bytes added to the instructions before the given one */
+    for(i = index; i > 0; i -= i & (~i + 1))
+        address += relaxation->growth[i];
+    return address;
+}
+
+
+bool branchFits(const branchRelaxation *relaxation, const relaxedBranch *branch)
+{
+    long target, distance;
+
+    if(branch->targetIndex >= 0)
+        target = relaxedAddress(relaxation, (unsigned long)branch->targetIndex);
+    else
+        target = ICInitialValue + (long)relaxation->numOfWords * 4 + relaxation->totalGrowth + branch->dataOffset;
+    distance = target - relaxedAddress(relaxation, branch->codeIndex);
+    return (distance >= min2BytesIntVal && distance <= max2BytesIntVal) ? TRUE : FALSE;
+}
+
+
+void relaxBranch(branchRelaxation *relaxation, relaxedBranch *branch, const codeImageTable *image)
+{
+    /* 'bne'/'beq' are inverted by a single branch, 'blt'/'bgt' by two (the opposite comparison, and 'beq') */
+    unsigned char extraWords = (image->entries[branch->codeIndex].data.typeI.opcode <= beqOpcode) ? 1 : 2;
+
+    branch->isLong = TRUE;
+    relaxation->extraWords[branch->codeIndex] = extraWords;
+    addGrowth(relaxation, branch->codeIndex, (long)extraWords * 4);
+    relaxation->worklist[relaxation->pending++] = branch->codeIndex;
+}
+
+
+void checkBranchesAround(branchRelaxation *relaxation, unsigned long index, const codeImageTable *image)
+{
+    unsigned long low = 0, high = relaxation->count, middle, first = (index > relaxationWindow) ? index - relaxationWindow : 0;
+    relaxedBranch *branch;
+
+    /* The first branch that's within the window */
+    while(low < high)
+    {
+        middle = low + (high - low) / 2;
+        if(relaxation->branches[middle].codeIndex < first)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    for(branch = relaxation->branches + low; branch < relaxation->branches + relaxation->count &&
+        branch->codeIndex <= index + relaxationWindow; branch++)
+    {
+        if(!branch->isLong && !branchFits(relaxation, branch))
+            relaxBranch(relaxation, branch, image);
+    }
+}
+
+
+void collectBranches(branchRelaxation *relaxation, assemblyContext *context)
+{
+    fixupTable *fixups = &context->fixups;
+    relaxedBranch *branch;
+    symbolTable label;
+    unsigned long i;
+
+    relaxation->branches = callocWithCheck((fixups->count + 1) * sizeof(relaxedBranch));
+    /* The fixups are ordered by line, like the instructions, so the branches are ordered by their index */
+    for(i = 0; i < fixups->count; i++)
+    {
+        if(fixups->entries[i].type != I || (label = findSymbol(&context->symbolTab, fixups->entries[i].symbol)) == NULL ||
+           label->isExternal || (label->type != code && label->type != data))
+            continue;
+
+        branch = &relaxation->branches[relaxation->count++];
+        branch->fixupIndex = i;
+        branch->codeIndex = fixups->entries[i].codeIndex;
+        branch->targetIndex = (label->type == code) ? (label->value - ICInitialValue) / 4 : -1;
+        branch->dataOffset = (label->type == data) ? label->value : 0;
+    }
+}
+
+
+void expandCodeImage(branchRelaxation *relaxation, assemblyContext *context)
+{
+    codeImageTable *image = &context->codeImage;
+    unsigned long count = image->count + (unsigned long)relaxation->totalGrowth / 4, i, newIndex = 0, *newIndexOf;
+    codeImageEntry *entries = callocWithCheck(count * sizeof(codeImageEntry)), *branch;
+    unsigned int opcode;
+    symbolTable symbol;
+    relaxedBranch *relaxed;
+
+    newIndexOf = callocWithCheck((image->count + 1) * sizeof(unsigned long));
+    for(i = 0; i < image->count; i++)
+    {
+        newIndexOf[i] = newIndex;
+        entries[newIndex] = image->entries[i];
+        entries[newIndex].address = (int)(ICInitialValue + (long)newIndex * 4);
+        if(relaxation->extraWords[i] != 0)
+        {
+            /* The inverted branch skips the 'jmp' when the original condition doesn't hold */
+            branch = &entries[newIndex];
+            opcode = branch->data.typeI.opcode;
+            branch->data.typeI.opcode = (opcode == bneOpcode) ? beqOpcode : (opcode == beqOpcode) ? bneOpcode :
+                                        (opcode == bltOpcode) ? bgtOpcode : bltOpcode;
+            branch->data.typeI.immed = (relaxation->extraWords[i] + 1) * 4;
+            if(relaxation->extraWords[i] == 2)
+            {
+                entries[++newIndex] = *branch;
+                entries[newIndex].address += 4;
+                entries[newIndex].data.typeI.opcode = beqOpcode;
+                entries[newIndex].data.typeI.immed = 8;
+            }
+            newIndex++;
+            memset(&entries[newIndex], 0, sizeof(codeImageEntry));
+            entries[newIndex].lineNumber = image->entries[i].lineNumber;
+            entries[newIndex].address = (int)(ICInitialValue + (long)newIndex * 4);
+            entries[newIndex].type = J;
+            entries[newIndex].data.typeJ.opcode = jmpOpcode;
+        }
+        newIndex++;
+    }
+
+    /* The labels of the code move with their instructions, the data labels are moved by ICF as usual */
+    for(symbol = context->symbolTab.head; symbol != NULL; symbol = symbol->next)
+    {
+        if(symbol->type == code && !symbol->isExternal)
+            symbol->value = ICInitialValue + (long)newIndexOf[(symbol->value - ICInitialValue) / 4] * 4;
+    }
+    for(i = 0; i < context->fixups.count; i++)
+        context->fixups.entries[i].codeIndex = newIndexOf[context->fixups.entries[i].codeIndex];
+    /* The label of a relaxed branch is reached by its 'jmp' */
+    for(relaxed = relaxation->branches; relaxed < relaxation->branches + relaxation->count; relaxed++)
+    {
+        if(relaxed->isLong)
+        {
+            context->fixups.entries[relaxed->fixupIndex].type = J;
+            context->fixups.entries[relaxed->fixupIndex].codeIndex += relaxation->extraWords[relaxed->codeIndex];
+        }
+    }
+
+    free(image->entries);
+    image->entries = entries;
+    image->count = image->capacity = count;
+    free(newIndexOf);
+}
+
+
+void relaxBranches(assemblyContext *context, long *IC)
+{
+    branchRelaxation relaxation = {0};
+    const codeImageTable *image = &context->codeImage;
+    relaxedBranch *branch;
+
+    collectBranches(&relaxation, context);
+    relaxation.numOfWords = image->count;
+    relaxation.growth = callocWithCheck((image->count + 1) * sizeof(long));
+    relaxation.extraWords = callocWithCheck(image->count + 1);
+    relaxation.worklist = callocWithCheck((relaxation.count + 1) * sizeof(unsigned long));
+
+    /* The distances only grow as branches are relaxed, so a branch that doesn't fit now never will */
+    for(branch = relaxation.branches; branch < relaxation.branches + relaxation.count; branch++)
+    {
+        if(!branchFits(&relaxation, branch))
+            relaxBranch(&relaxation, branch, image);
+    }
+
+    if(relaxation.pending != 0)
+    {
+        /* Rechecks every branch once with the relaxed ones, then only the neighbourhoods of newly relaxed branches */
+        relaxation.pending = 0;
+        for(branch = relaxation.branches; branch < relaxation.branches + relaxation.count; branch++)
+        {
+            if(!branch->isLong && !branchFits(&relaxation, branch))
+                relaxBranch(&relaxation, branch, image);
+        }
+        while(relaxation.pending != 0)
+            checkBranchesAround(&relaxation, relaxation.worklist[--relaxation.pending], image);
+
+        expandCodeImage(&relaxation, context);
+        *IC = ICInitialValue + (long)context->codeImage.count * 4;
+    }
+
+    free(relaxation.branches);
+    free(relaxation.growth);
+    free(relaxation.extraWords);
+    free(relaxation.worklist);
+}
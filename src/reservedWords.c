@@ -0,0 +1,67 @@
+#include <string.h>
+#include "../include/reservedWords.h"
+
+
+/*
+   The perfect hash table of the reserved words, each word is placed in the slot computed by 'hashReservedWord'.
+   The indexes refer to the tables of 'getReservedInstructions' and 'getReservedDirectives',
+   adding a reserved word requires choosing new multipliers for the hash, so that no two words share a slot.
+*/
+static const reservedWord reservedWordsTable[reservedWordTableSize] = {
+        {"", reservedDirective, 6}, {"nor", reservedInstruction, 4},
+        {"lb", reservedInstruction, 17}, {"sh", reservedInstruction, 22},
+        {"asciz", reservedDirective, 3}, {NULL, reservedInstruction, 0},
+        {"lh", reservedInstruction, 21}, {NULL, reservedInstruction, 0},
+        {"sub", reservedInstruction, 1}, {"bgt", reservedInstruction, 16},
+        {NULL, reservedInstruction, 0}, {"subi", reservedInstruction, 9},
+        {NULL, reservedInstruction, 0}, {"sw", reservedInstruction, 20},
+        {NULL, reservedInstruction, 0}, {NULL, reservedInstruction, 0},
+        {"lw", reservedInstruction, 19}, {"extern", reservedDirective, 5},
+        {NULL, reservedInstruction, 0}, {NULL, reservedInstruction, 0},
+        {NULL, reservedInstruction, 0}, {"addi", reservedInstruction, 8},
+        {"ori", reservedInstruction, 11}, {"beq", reservedInstruction, 14},
+        {NULL, reservedInstruction, 0}, {"blt", reservedInstruction, 15},
+        {"entry", reservedDirective, 4}, {NULL, reservedInstruction, 0},
+        {NULL, reservedInstruction, 0}, {"mvlo", reservedInstruction, 7},
+        {"add", reservedInstruction, 0}, {"bne", reservedInstruction, 13},
+        {NULL, reservedInstruction, 0}, {NULL, reservedInstruction, 0},
+        {NULL, reservedInstruction, 0}, {NULL, reservedInstruction, 0},
+        {"nori", reservedInstruction, 12}, {"stop", reservedInstruction, 26},
+        {NULL, reservedInstruction, 0}, {NULL, reservedInstruction, 0},
+        {NULL, reservedInstruction, 0}, {"jmp", reservedInstruction, 23},
+        {"db", reservedDirective, 2}, {NULL, reservedInstruction, 0},
+        {"la", reservedInstruction, 24}, {"call", reservedInstruction, 25},
+        {"dh", reservedDirective, 0}, {NULL, reservedInstruction, 0},
+        {NULL, reservedInstruction, 0}, {"move", reservedInstruction, 5},
+        {NULL, reservedInstruction, 0}, {"or", reservedInstruction, 3},
+        {NULL, reservedInstruction, 0}, {"andi", reservedInstruction, 10},
+        {NULL, reservedInstruction, 0}, {NULL, reservedInstruction, 0},
+        {"dw", reservedDirective, 1}, {"mvhi", reservedInstruction, 6},
+        {NULL, reservedInstruction, 0}, {NULL, reservedInstruction, 0},
+        {NULL, reservedInstruction, 0}, {NULL, reservedInstruction, 0},
+        {"and", reservedInstruction, 2}, {"sb", reservedInstruction, 18}
+};
+
+
+unsigned int hashReservedWord(const char *word)
+{
+    unsigned long length = strlen(word);
+    unsigned int first, second, last;
+
+    first = (unsigned char)word[0];
+    second = (length > 1) ? (unsigned char)word[1] : 0;
+    last = (length > 0) ? (unsigned char)word[length - 1] : 0;
+
+    return (unsigned int)(length * 25 + first * 27 + second * 16 + last * 6) & (reservedWordTableSize - 1);
+}
+
+
+const reservedWord *findReservedWord(const char *word)
+{
+    const reservedWord *slot = &reservedWordsTable[hashReservedWord(word)];
+
+    /* A single compare decides whether the word is the one reserved in its slot */
+    if(slot->name != NULL && strcmp(slot->name, word) == 0)
+        return slot;
+    return NULL;
+}
@@ -1,58 +1,61 @@
-
-#include <string.h>
 #include <stdlib.h>
 #include "../include/labels.h"
 #include "../include/binary.h"
-#include "../include/directives.h"
 #include "../include/general.h"
-#include "../include/lineHandling.h"
 #include "../include/tables.h"
+#include "../include/fixupResolution.h"
 
-state lineSecondPass(newLine *line, symbolTable symbolTab, codeTable codeImage, attributesTable *attributesTab)
+state lineSecondPass(newLine *line, unsigned long *fixupIndex, unsigned long *entryIndex, resolvedFixups *resolved,
+        assemblyContext *context)
 {
-    int contentIndex = 0;
-    char symbol[maxLabelLength];
-    symbolTable label = NULL;
-    directiveWord *directiveToken = callocWithCheck(sizeof(directiveWord));
-    instructionWord *instructionToken = callocWithCheck(sizeof(instructionWord));
+    fixupTable *fixups = &context->fixups;
+    deferredEntryTable *entries = &context->entries;
+
+    line->error = NULL;
 
-    if(emptyLine(line->content, contentIndex) || commentLine(line->content, &contentIndex)) /* Skip comment/empty line*/
-        return VALID;
-    skipLabelDefinition(line->content, &contentIndex);
-    /* If it's an '.entry' directive line */
-    if(isDirective(line->content, directiveToken, &contentIndex) && strcmp(directiveToken->name, "entry") == 0)
-        defineLabelAsEntry(line, symbolTab, &contentIndex, symbol);
-    else  /* If it's not a directive line, then it's an instruction, proceeds to complete the binary encoding */
+    /* If the next recorded line is an '.entry' directive, adds the 'entry' attribute to its label */
+    if(*entryIndex < entries->count && (*fixupIndex == fixups->count ||
+       entries->entries[*entryIndex].lineNumber < fixups->entries[*fixupIndex].lineNumber))
+    {
+        line->number = entries->entries[*entryIndex].lineNumber;
+        labelIsDefined(entries->entries[(*entryIndex)++].name, line, &context->symbolTab, entry);
+    }
+    /* Otherwise, it's an instruction with a label operand, proceeds to complete the binary encoding */
+    else
     {
-        checkLineBinaryEncoding(line, symbolTab, codeImage, instructionToken, &label);
-        if(label && label->isExternal)   /* If the current label is external, adds it to the attributes table */
-            addToAttributesTable(label->name, external, instructionToken->address, attributesTab);
+        line->number = fixups->entries[*fixupIndex].lineNumber;
+        /* The fixups may already be resolved in parallel, only their errors are left to be reported */
+        if(resolved == NULL)
+            resolveFixup(line, &fixups->entries[*fixupIndex], context);
+        else if(resolved->next < resolved->count && resolved->errors[resolved->next].fixupIndex == *fixupIndex)
+            line->error = resolved->errors[resolved->next++].error;
+        (*fixupIndex)++;
     }
-    free(directiveToken);
-    free(instructionToken);
     return currentState(line);
 }
 
-state secondPass(newLine *line, symbolTable symbolTab, codeTable codeImage, attributesTable *attributesTab, FILE *fd)
+state secondPass(newLine *line, assemblyContext *context)
 {
     state process = VALID;
-    /* Temporary string for storing single line content from an input file */
-    char tempLine[maxLineLength + 2];
+    /* Indexes of the next fixup and the next '.entry' directive to be handled */
+    unsigned long fixupIndex = 0, entryIndex = 0;
+    resolvedFixups resolved = {0};
+    bool inParallel = (context->options->fixupThreads > 1) ? resolveFixupsInParallel(context, &resolved) : FALSE;
 
-    /* Check validation of each line from the input file until reach the end of the file */
-    for(line->number = 1; fgets(tempLine, maxLineLength + 2, fd) != NULL; line->number++)
+    /* The source lines aren't read again - only the lines recorded in the first pass are handled, by line order */
+    line->content = NULL;
+    while(fixupIndex < context->fixups.count || entryIndex < context->entries.count)
     {
-        line->content = tempLine;
-        line->error = NULL;
-
-        if(lineSecondPass(line, symbolTab, codeImage, attributesTab) == INVALID)
+        if(lineSecondPass(line, &fixupIndex, &entryIndex, inParallel ? &resolved : NULL, context) == INVALID)
         {
-            printLineError(line);
+            printLineError(line, context->errors);
+            context->reportedLines++;
             process = INVALID;
         }
     }
+    free(resolved.errors);
     if(process == VALID)
         /* Enter all 'entry' labels to the attributes table */
-        addEntrySymbolsToTable(attributesTab, symbolTab);
+        addEntrySymbolsToTable(&context->attributesTab, &context->attributesTail, &context->symbolTab, &context->memory);
     return process;
-}
\ No newline at end of file
+}
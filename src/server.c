@@ -0,0 +1,687 @@
+/* For the sockets, 'fork', 'fchdir' and the credentials of a peer ('SO_PEERCRED') */
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <signal.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "../include/server.h"
+#include "../include/jobs.h"
+#include "../include/files.h"
+#include "../include/libassembler.h"
+#include "../include/cache.h"
+#include "../include/general.h"
+
+/* Room for the ancillary data of the passed descriptors */
+#define descriptorsSpace CMSG_SPACE(numOfPassedDescriptors * sizeof(int))
+
+
+void initConnection(serverConnection *connection, int socket)
+{
+    connection->socket = socket;
+    connection->used = connection->position = 0;
+    connection->numOfPassed = 0;
+}
+
+
+void closeConnection(serverConnection *connection)
+{
+    int i;
+
+    for(i = 0; i < connection->numOfPassed; i++)
+        close(connection->passed[i]);
+    connection->numOfPassed = 0;
+    close(connection->socket);
+}
+
+
+state receiveIntoConnection(serverConnection *connection)
+{
+    union
+    {
+        struct cmsghdr header;
+        char space[descriptorsSpace];
+    } control;
+    struct msghdr message;
+    struct iovec vector;
+    struct cmsghdr *ancillary;
+    int *descriptors, numOfDescriptors, i;
+    long received;
+
+    /* The consumed bytes are dropped, the rest of the buffer is moved to its start */
+    memmove(connection->buffer, connection->buffer + connection->position, connection->used - connection->position);
+    connection->used -= connection->position;
+    connection->position = 0;
+    if(connection->used == serverLineLength)
+        return INVALID;
+
+    memset(&message, 0, sizeof(message));
+    vector.iov_base = connection->buffer + connection->used;
+    vector.iov_len = serverLineLength - connection->used;
+    message.msg_iov = &vector;
+    message.msg_iovlen = 1;
+    message.msg_control = control.space;
+    message.msg_controllen = sizeof(control.space);
+    do
+        received = (long) recvmsg(connection->socket, &message, 0);
+    while(received < 0 && errno == EINTR);
+
+    for(ancillary = CMSG_FIRSTHDR(&message); received >= 0 && ancillary != NULL;
+        ancillary = CMSG_NXTHDR(&message, ancillary))
+    {
+        if(ancillary->cmsg_level != SOL_SOCKET || ancillary->cmsg_type != SCM_RIGHTS)
+            continue;
+        descriptors = (int *) CMSG_DATA(ancillary);
+        numOfDescriptors = (int)((ancillary->cmsg_len - CMSG_LEN(0)) / sizeof(int));
+        for(i = 0; i < numOfDescriptors; i++)
+        {
+            if(connection->numOfPassed < numOfPassedDescriptors)
+                connection->passed[connection->numOfPassed++] = descriptors[i];
+            else
+                close(descriptors[i]);
+        }
+    }
+    if(received <= 0)
+        return INVALID;
+    connection->used += (unsigned long) received;
+    return VALID;
+}
+
+
+char *readConnectionLine(serverConnection *connection)
+{
+    char *line, *lineEnd;
+
+    while((lineEnd = memchr(connection->buffer + connection->position, '\n',
+                            connection->used - connection->position)) == NULL)
+        if(receiveIntoConnection(connection) == INVALID)
+            return NULL;
+
+    line = connection->buffer + connection->position;
+    *lineEnd = '\0';
+    connection->position = (unsigned long)(lineEnd - connection->buffer) + 1;
+    return line;
+}
+
+
+char *readConnectionSection(serverConnection *connection, unsigned long size)
+{
+    char *section;
+    unsigned long copied = 0, buffered;
+    long received;
+
+    if(size > maxRequestSection)
+        return NULL;
+    section = (char *) callocWithCheck(size + 2);
+
+    /* The start of the section may already be buffered, the rest is read directly into the section */
+    while(copied < size + 1)
+    {
+        buffered = connection->used - connection->position;
+        if(buffered == 0)
+        {
+            do
+                received = (long) read(connection->socket, section + copied, size + 1 - copied);
+            while(received < 0 && errno == EINTR);
+            if(received <= 0)
+            {
+                free(section);
+                return NULL;
+            }
+            copied += (unsigned long) received;
+            continue;
+        }
+        if(buffered > size + 1 - copied)
+            buffered = size + 1 - copied;
+        memcpy(section + copied, connection->buffer + connection->position, buffered);
+        connection->position += buffered;
+        copied += buffered;
+    }
+
+    /* The section ends with a '\n' that isn't part of it */
+    if(section[size] != '\n')
+    {
+        free(section);
+        return NULL;
+    }
+    section[size] = '\0';
+    return section;
+}
+
+
+state writeToSocket(int socket, const char *bytes, unsigned long size)
+{
+    long written;
+
+    while(size != 0)
+    {
+        written = (long) write(socket, bytes, size);
+        if(written < 0 && errno == EINTR)
+            continue;
+        if(written <= 0)
+            return INVALID;
+        bytes += written;
+        size -= (unsigned long) written;
+    }
+    return VALID;
+}
+
+
+void sendSection(int socket, const char *name, const char *bytes, unsigned long size)
+{
+    char header[64];
+
+    sprintf(header, "%s %lu\n", name, size);
+    if(writeToSocket(socket, header, strlen(header)) == VALID && writeToSocket(socket, bytes, size) == VALID)
+        writeToSocket(socket, "\n", 1);
+}
+
+
+void sendOutputLocation(int socket, const char *fileName, char *extension, bool written, bool restored)
+{
+    char *outputName = getFileFullName(fileName, extension);
+    struct stat outputStatus;
+
+    /* The cache restores the outputs the source has, the files that exist after restoring them */
+    if(restored)
+        written = (stat(outputName, &outputStatus) == 0) ? TRUE : FALSE;
+    if(written)
+    {
+        writeToSocket(socket, "output ", 7);
+        writeToSocket(socket, outputName, strlen(outputName));
+        writeToSocket(socket, "\n", 1);
+    }
+    free(outputName);
+}
+
+
+void serveAssembleRequest(serverConnection *connection, const char *fileName, const assemblerOptions *options)
+{
+    assemblyContext context = {0};
+    assemblyStatistics statistics = {0};
+    cacheStatistics cache = {0};
+    char *diagnostics = NULL;
+    size_t diagnosticsSize = 0;
+    FILE *errors = openMemoryStream(&diagnostics, &diagnosticsSize);
+    cacheOutcome outcome = assembleFile(fileName, options, errors, &context, &statistics);
+    bool restored = (outcome == cacheHit) ? TRUE : FALSE;
+
+    fclose(errors);
+    countCacheOutcome(&cache, outcome);
+    if(outcome == cacheMiss && options->cacheDirectory != NULL)
+        trimCache(options, &cache);
+
+    writeToSocket(connection->socket, statistics.isValid ? "status valid\n" : "status invalid\n",
+                  statistics.isValid ? 13 : 15);
+    sendSection(connection->socket, "diagnostics", diagnostics, diagnosticsSize);
+    /* The same outputs as 'createOutputFiles' writes */
+    if(statistics.isValid)
+    {
+        sendOutputLocation(connection->socket, fileName, ".ob", (statistics.codeWords != 0 || statistics.dataBytes != 0),
+                           restored);
+        sendOutputLocation(connection->socket, fileName, ".ent", (statistics.attributes != 0), restored);
+        sendOutputLocation(connection->socket, fileName, ".ext", (statistics.attributes != 0), restored);
+    }
+    writeToSocket(connection->socket, "end\n", 4);
+    free(diagnostics);
+}
+
+
+void serveSourceRequest(serverConnection *connection, const char *sourceName, unsigned long size,
+        const assemblerOptions *options)
+{
+    assemblyContext context = {0};
+    char *source = readConnectionSection(connection, size), *image;
+    size_t imageSize;
+    state sourceState;
+
+    if(source == NULL)
+        return;
+    sourceState = assembleSource(&context, options, sourceName, source, size);
+    free(source);
+
+    writeToSocket(connection->socket, (sourceState == VALID) ? "status valid\n" : "status invalid\n",
+                  (sourceState == VALID) ? 13 : 15);
+    sendSection(connection->socket, "diagnostics", context.diagnostics, context.diagnosticsSize);
+    if(sourceState == VALID)
+    {
+        /* The sections of the files the command line assembler writes for the source */
+        if(context.codeImage.count != 0 || context.dataImage.size != 0)
+        {
+            image = objectFileImage(&context, &imageSize);
+            sendSection(connection->socket, "object", image, imageSize);
+            free(image);
+        }
+        if(context.attributesTab != NULL)
+        {
+            image = attributesFileImage(&context, entry, &imageSize);
+            sendSection(connection->socket, "entries", image, imageSize);
+            free(image);
+            image = attributesFileImage(&context, external, &imageSize);
+            sendSection(connection->socket, "externals", image, imageSize);
+            free(image);
+        }
+    }
+    writeToSocket(connection->socket, "end\n", 4);
+    freeAssemblyContext(&context);
+}
+
+
+void serveRunRequest(serverConnection *connection, long argc)
+{
+    char **argv, *line, reply[32];
+    long i, numOfArguments = 0;
+    int status, stream;
+
+    if(connection->numOfPassed != numOfPassedDescriptors)
+    {
+        sprintf(reply, "error missing descriptors\n");
+        writeToSocket(connection->socket, reply, strlen(reply));
+        return;
+    }
+
+    argv = (char **) callocWithCheck((argc + 1) * sizeof(char *));
+    while(numOfArguments < argc && (line = readConnectionLine(connection)) != NULL && isdigit((unsigned char)line[0]) &&
+          (argv[numOfArguments] = readConnectionSection(connection, strtoul(line, NULL, 10))) != NULL)
+        numOfArguments++;
+
+    if(numOfArguments < argc)
+        writeToSocket(connection->socket, "error malformed arguments\n", 26);
+    else if(fchdir(connection->passed[numOfPassedDescriptors - 1]) != 0)
+        writeToSocket(connection->socket, "error no access to the directory\n", 33);
+    else
+    {
+        /* The process of the connection runs the command as the client would, it changes its streams freely */
+        signal(SIGPIPE, SIG_DFL);
+        fflush(stdout);
+        fflush(stderr);
+        for(stream = 0; stream < numOfPassedDescriptors - 1; stream++)
+            dup2(connection->passed[stream], stream);
+        /* The streams are buffered as the streams of the client would be */
+        setvbuf(stdout, NULL, isatty(STDOUT_FILENO) ? _IOLBF : _IOFBF, BUFSIZ);
+
+        status = runAssembler((int) argc, argv, TRUE);
+        fflush(stdout);
+        fflush(stderr);
+        sprintf(reply, "exit %d\n", status);
+        writeToSocket(connection->socket, reply, strlen(reply));
+    }
+
+    for(i = 0; i < numOfArguments; i++)
+        free(argv[i]);
+    free(argv);
+}
+
+
+bool serveConnection(serverConnection *connection, const assemblerOptions *options)
+{
+    char *request = readConnectionLine(connection), *name, *sizeEnd;
+    unsigned long size;
+
+    if(request == NULL)
+        return TRUE;
+
+    if(strncmp(request, "ASSEMBLE ", 9) == 0 && request[9] != '\0')
+        serveAssembleRequest(connection, request + 9, options);
+    else if(strncmp(request, "SOURCE ", 7) == 0 && isdigit((unsigned char)request[7]) &&
+            (size = strtoul(request + 7, &sizeEnd, 10)) <= maxRequestSection && *sizeEnd == ' ' && sizeEnd[1] != '\0')
+    {
+        /* The name is copied out of the buffer, which the source is read through */
+        name = (char *) callocWithCheck(strlen(sizeEnd + 1) + 1);
+        strcpy(name, sizeEnd + 1);
+        serveSourceRequest(connection, name, size, options);
+        free(name);
+    }
+    else if(strncmp(request, "RUN ", 4) == 0 && isdigit((unsigned char)request[4]) && atol(request + 4) > 0 &&
+            atol(request + 4) <= maxRequestArguments)
+        serveRunRequest(connection, atol(request + 4));
+    else if(strcmp(request, "SHUTDOWN") == 0)
+    {
+        writeToSocket(connection->socket, "end\n", 4);
+        return FALSE;
+    }
+    else
+        writeToSocket(connection->socket, "error unknown request\n", 22);
+    return TRUE;
+}
+
+
+void serveForkedConnection(int client, const assemblerOptions *options, int stopSignal)
+{
+    serverConnection *connection = (serverConnection *) callocWithCheck(sizeof(serverConnection));
+    struct timeval timeout;
+
+    signal(SIGCHLD, SIG_DFL);
+    /* A client that stalls doesn't keep the process of its connection forever */
+    timeout.tv_sec = serverReceiveTimeout;
+    timeout.tv_usec = 0;
+    setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    initConnection(connection, client);
+    if(serveConnection(connection, options) == FALSE && write(stopSignal, "", 1) != 1)
+        fprintf(stderr, "Error: failed to stop the assembler server.\n");
+    closeConnection(connection);
+    free(connection);
+}
+
+
+char *defaultServerSocketPath(void)
+{
+    const char *runtimeDirectory = getenv("XDG_RUNTIME_DIR");
+    char *socketPath;
+
+    if(runtimeDirectory != NULL && runtimeDirectory[0] == '/')
+    {
+        socketPath = (char *) callocWithCheck(strlen(runtimeDirectory) + strlen(defaultServerSocketName) + 2);
+        sprintf(socketPath, "%s/%s", runtimeDirectory, defaultServerSocketName);
+    }
+    else
+    {
+        /* Room for the id of the user, in decimal */
+        socketPath = (char *) callocWithCheck(strlen(fallbackSocketDirectory) + 3 * sizeof(unsigned long) +
+                                              strlen(defaultServerSocketName) + 2);
+        sprintf(socketPath, "%s%lu/%s", fallbackSocketDirectory, (unsigned long) geteuid(), defaultServerSocketName);
+    }
+    return socketPath;
+}
+
+
+state checkSocketDirectory(const char *socketPath, bool create)
+{
+    char *directory = (char *) callocWithCheck(strlen(socketPath) + 1), *slash;
+    struct stat directoryStatus;
+    state directoryState = VALID;
+
+    strcpy(directory, socketPath);
+    if((slash = strrchr(directory, '/')) != NULL && slash != directory)
+        *slash = '\0';
+    else
+        strcpy(directory, (slash != NULL) ? "/" : ".");
+
+    if(create && mkdir(directory, S_IRWXU) != 0 && errno != EEXIST)
+    {
+        fprintf(stderr, "Error: failed to create the directory '%s' of the socket.\n", directory);
+        directoryState = INVALID;
+    }
+    /* A link, or a directory another user made or can reach, might hand the socket to another user */
+    else if(lstat(directory, &directoryStatus) != 0)
+        directoryState = INVALID;
+    else if(!S_ISDIR(directoryStatus.st_mode) || directoryStatus.st_uid != geteuid() ||
+            (directoryStatus.st_mode & (S_IRWXG | S_IRWXO)) != 0)
+    {
+        fprintf(stderr, "Error: the directory '%s' of the socket isn't private to the user.\n", directory);
+        directoryState = INVALID;
+    }
+    free(directory);
+    return directoryState;
+}
+
+
+state checkPeerUser(int socket)
+{
+#ifdef SO_PEERCRED
+    struct ucred credentials;
+    socklen_t size = sizeof(credentials);
+
+    if(getsockopt(socket, SOL_SOCKET, SO_PEERCRED, &credentials, &size) != 0)
+        return INVALID;
+    return (credentials.uid == geteuid()) ? VALID : INVALID;
+#else
+    uid_t user;
+    gid_t group;
+
+    if(getpeereid(socket, &user, &group) != 0)
+        return INVALID;
+    return (user == geteuid()) ? VALID : INVALID;
+#endif
+}
+
+
+state connectToServer(const char *socketPath, int *server)
+{
+    struct sockaddr_un address;
+
+    if(strlen(socketPath) >= sizeof(address.sun_path) || (*server = socket(AF_UNIX, SOCK_STREAM, 0)) < 0)
+        return INVALID;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, socketPath);
+    if(connect(*server, (struct sockaddr *) &address, sizeof(address)) != 0)
+    {
+        close(*server);
+        return INVALID;
+    }
+    return VALID;
+}
+
+
+state openServerSocket(const char *socketPath, int *listener)
+{
+    struct sockaddr_un address;
+    struct stat socketStatus;
+    mode_t previousMask;
+    int server;
+
+    if(strlen(socketPath) >= sizeof(address.sun_path))
+    {
+        fprintf(stderr, "Error: the socket name '%s' is too long.\n", socketPath);
+        return INVALID;
+    }
+    if(connectToServer(socketPath, &server) == VALID)
+    {
+        close(server);
+        fprintf(stderr, "Error: another server already serves socket '%s'.\n", socketPath);
+        return INVALID;
+    }
+    /* A socket nobody serves was left behind by a server that stopped, any other file is kept */
+    if(stat(socketPath, &socketStatus) == 0 && S_ISSOCK(socketStatus.st_mode))
+        remove(socketPath);
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, socketPath);
+    /* Only the user can connect to the socket */
+    previousMask = umask(S_IRWXG | S_IRWXO);
+    if((*listener = socket(AF_UNIX, SOCK_STREAM, 0)) < 0 ||
+       bind(*listener, (struct sockaddr *) &address, sizeof(address)) != 0 || listen(*listener, serverBacklog) != 0)
+    {
+        umask(previousMask);
+        fprintf(stderr, "Error: failed to listen on socket '%s'.\n", socketPath);
+        if(*listener >= 0)
+            close(*listener);
+        return INVALID;
+    }
+    umask(previousMask);
+    return VALID;
+}
+
+
+state serveRequests(const char *socketPath, const assemblerOptions *options)
+{
+    assemblerOptions serverOptions = *options;
+    struct pollfd waiting[2];
+    char *defaultPath = NULL;
+    int listener, client, stopPipe[2];
+    pid_t child;
+
+    if(socketPath[0] == '\0')
+    {
+        socketPath = defaultPath = defaultServerSocketPath();
+        if(checkSocketDirectory(socketPath, TRUE) == INVALID)
+        {
+            free(defaultPath);
+            return INVALID;
+        }
+    }
+    /* A client that leaves doesn't stop the server, and the processes of the connections are never waited for */
+    signal(SIGPIPE, SIG_IGN);
+    signal(SIGCHLD, SIG_IGN);
+    if(openServerSocket(socketPath, &listener) == INVALID)
+    {
+        free(defaultPath);
+        return INVALID;
+    }
+    if(pipe(stopPipe) != 0)
+    {
+        fprintf(stderr, "Error: failed to serve socket '%s'.\n", socketPath);
+        close(listener);
+        remove(socketPath);
+        free(defaultPath);
+        return INVALID;
+    }
+
+    /* Every request is assembled into output files of its own, and the cache directory is opened once */
+    serverOptions.linkedFileName = NULL;
+    serverOptions.serverSocket = NULL;
+    if(serverOptions.cacheDirectory != NULL && openCacheDirectory(&serverOptions) == INVALID)
+        serverOptions.cacheDirectory = NULL;
+
+    waiting[0].fd = listener;
+    waiting[1].fd = stopPipe[0];
+    waiting[0].events = waiting[1].events = POLLIN;
+    /* The server only accepts connections, a 'SHUTDOWN' served by the process of a connection stops it */
+    while(TRUE)
+    {
+        if(poll(waiting, 2, -1) < 0)
+        {
+            if(errno == EINTR)
+                continue;
+            fprintf(stderr, "Error: failed to wait for connections on socket '%s'.\n", socketPath);
+            break;
+        }
+        if(waiting[1].revents != 0)
+            break;
+        if((client = accept(listener, NULL, NULL)) < 0)
+        {
+            if(errno == EINTR || errno == ECONNABORTED || errno == EAGAIN)
+                continue;
+            fprintf(stderr, "Error: failed to accept a connection on socket '%s'.\n", socketPath);
+            break;
+        }
+        if(checkPeerUser(client) == INVALID)
+        {
+            fprintf(stderr, "Error: refused a connection of another user on socket '%s'.\n", socketPath);
+            close(client);
+            continue;
+        }
+
+        /* Every connection is served by a process of its own, so a slow request never holds up the others */
+        fflush(stdout);
+        fflush(stderr);
+        if((child = fork()) < 0)
+            writeToSocket(client, "error no process for the request\n", 33);
+        else if(child == 0)
+        {
+            close(listener);
+            close(stopPipe[0]);
+            serveForkedConnection(client, &serverOptions, stopPipe[1]);
+            fflush(stdout);
+            fflush(stderr);
+            _exit(0);
+        }
+        close(client);
+    }
+
+    close(listener);
+    close(stopPipe[0]);
+    close(stopPipe[1]);
+    remove(socketPath);
+    free(defaultPath);
+    return VALID;
+}
+
+
+state sendWithDescriptors(int socket, const char *bytes, unsigned long size, const int *descriptors,
+        int numOfDescriptors)
+{
+    union
+    {
+        struct cmsghdr header;
+        char space[descriptorsSpace];
+    } control;
+    struct msghdr message;
+    struct iovec vector;
+    struct cmsghdr *ancillary;
+    long sent;
+
+    memset(&message, 0, sizeof(message));
+    memset(&control, 0, sizeof(control));
+    vector.iov_base = (void *) bytes;
+    vector.iov_len = size;
+    message.msg_iov = &vector;
+    message.msg_iovlen = 1;
+    message.msg_control = control.space;
+    message.msg_controllen = CMSG_SPACE(numOfDescriptors * sizeof(int));
+    ancillary = CMSG_FIRSTHDR(&message);
+    ancillary->cmsg_level = SOL_SOCKET;
+    ancillary->cmsg_type = SCM_RIGHTS;
+    ancillary->cmsg_len = CMSG_LEN(numOfDescriptors * sizeof(int));
+    memcpy(CMSG_DATA(ancillary), descriptors, numOfDescriptors * sizeof(int));
+
+    do
+        sent = (long) sendmsg(socket, &message, 0);
+    while(sent < 0 && errno == EINTR);
+    return (sent == (long) size) ? VALID : INVALID;
+}
+
+
+int runOnServer(const char *socketPath, int argc, char *argv[])
+{
+    int passed[numOfPassedDescriptors] = {STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO, -1}, server, status = 1, i;
+    serverConnection *connection;
+    char line[32], *reply;
+    state sent;
+
+    if(connectToServer(socketPath, &server) == INVALID)
+        return -1;
+    /* The streams and the directory of this process are only passed to a server of the same user */
+    if(checkPeerUser(server) == INVALID)
+    {
+        fprintf(stderr, "Error: the server on socket '%s' runs as another user, it isn't used.\n", socketPath);
+        close(server);
+        return -1;
+    }
+    if((passed[numOfPassedDescriptors - 1] = open(".", O_RDONLY)) < 0)
+    {
+        close(server);
+        return -1;
+    }
+    sprintf(line, "RUN %d\n", argc);
+    sent = sendWithDescriptors(server, line, strlen(line), passed, numOfPassedDescriptors);
+    close(passed[numOfPassedDescriptors - 1]);
+    if(sent == INVALID)
+    {
+        close(server);
+        return -1;
+    }
+
+    for(i = 0; i < argc; i++)
+    {
+        sprintf(line, "%lu\n", (unsigned long) strlen(argv[i]));
+        writeToSocket(server, line, strlen(line));
+        writeToSocket(server, argv[i], strlen(argv[i]));
+        writeToSocket(server, "\n", 1);
+    }
+
+    /* The command writes to the streams of this process, only its exit status is replied */
+    connection = (serverConnection *) callocWithCheck(sizeof(serverConnection));
+    initConnection(connection, server);
+    if((reply = readConnectionLine(connection)) != NULL && strncmp(reply, "exit ", 5) == 0)
+        status = atoi(reply + 5);
+    else if(reply != NULL && strncmp(reply, "error ", 6) == 0)
+        fprintf(stderr, "Error: the assembler server failed the request (%s).\n", reply + 6);
+    else
+        fprintf(stderr, "Error: the assembler server closed the connection.\n");
+    closeConnection(connection);
+    free(connection);
+    return status;
+}
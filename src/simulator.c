@@ -0,0 +1,354 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "../include/simulator.h"
+#include "../include/linker.h"
+#include "../include/files.h"
+#include "../include/lineHandling.h"
+#include "../include/general.h"
+
+/*
+   The dispatch of 'runSimulator'. With GCC (and compilers compatible with it) every predecoded instruction holds
+   the address of the code executing it, and every handler jumps straight to the handler of the next instruction
+   (threaded code, 'goto *'). Otherwise the handlers are the cases of a switch in a loop.
+   '__extension__' keeps the GNU extensions accepted by '-pedantic'. Defining 'SIMULATOR_SWITCH' forces the switch.
+*/
+#if defined(__GNUC__) && !defined(SIMULATOR_SWITCH)
+#define simulatorThreaded
+#define handlerOf(kind) __extension__ &&kind##Handler
+#define simulatorCase(kind) kind##Handler:
+#define dispatch() __extension__ ({ goto *op->handler; })
+#define beginDispatch() dispatch();
+#define endDispatch()
+#else
+#define simulatorCase(kind) case kind:
+#define dispatch() continue
+#define beginDispatch() for(;;) switch(op->kind) {
+#define endDispatch() }
+#endif
+
+/* Counts the executed instruction and moves on to the next one */
+#define nextOp() op++; steps++; dispatch()
+
+/* Counts the executed instruction and jumps to the target instruction, the limit of steps is checked on jumps only */
+#define jumpTo(target) op = ops + (target); if(++steps >= maxSteps) goto stepLimit; dispatch()
+
+/* Stops the run at the current instruction with the given fault */
+#define faultAt(message) machine->fault = message; goto stopRun
+
+
+simulatorOpKind decodeOpKind(const codeType *data)
+{
+    static const simulatorOpKind arithmetic[] = {opIllegal, opAdd, opSub, opAnd, opOr, opNor};
+    static const simulatorOpKind copy[] = {opIllegal, opMove, opMvhi, opMvlo};
+    static const simulatorOpKind immediate[] = {
+            opAddi, opSubi, opAndi, opOri, opNori, opBne, opBeq, opBlt, opBgt, opLb, opSb, opLw, opSw, opLh, opSh
+    };
+
+    switch(data->typeJ.opcode)
+    {
+        case 0: return (data->typeR.funct <= 5) ? arithmetic[data->typeR.funct] : opIllegal;
+        case 1: return (data->typeR.funct <= 3) ? copy[data->typeR.funct] : opIllegal;
+        case 30: return data->typeJ.reg ? opJmpRegister : opJmp;
+        case 31: return opLa;
+        case 32: return opCall;
+        case 63: return opStop;
+        default:
+            if(data->typeI.opcode >= 10 && data->typeI.opcode <= 24)
+                return immediate[data->typeI.opcode - 10];
+            return opIllegal;
+    }
+}
+
+
+long instructionIndex(const simulator *machine, long address)
+{
+    if(address < ICInitialValue || address >= machine->codeEnd || (address - ICInitialValue) % 4 != 0)
+        return -1;
+    return (address - ICInitialValue) / 4;
+}
+
+
+void predecodeInstruction(simulator *machine, unsigned long index)
+{
+    simulatorOp *op = &machine->ops[index];
+    const unsigned char *bytes = machine->memory + ICInitialValue + index * 4;
+    unsigned int word = (unsigned int)bytes[0] | (unsigned int)bytes[1] << 8 |
+                        (unsigned int)bytes[2] << 16 | (unsigned int)bytes[3] << 24;
+    codeType data;
+    long address = ICInitialValue + (long)index * 4, target;
+
+    /* The bit fields of all the instruction types start at the beginning of the union */
+    memcpy(&data, &word, sizeof(word));
+    op->kind = (unsigned char)decodeOpKind(&data);
+    op->rs = (unsigned char)data.typeR.rs;
+    op->rt = (unsigned char)data.typeR.rt;
+    op->rd = (unsigned char)data.typeR.rd;
+    op->operand = 0;
+
+    if(op->kind >= opAddi && op->kind <= opSh)
+        op->operand = data.typeI.immed;
+    /* The targets of the jumps are found once, the distance of a branch is relative to the branch */
+    if(op->kind >= opBne && op->kind <= opBgt)
+        target = address + data.typeI.immed;
+    else if(op->kind == opJmp || op->kind == opCall)
+        target = (long)data.typeJ.address;
+    else
+        target = -1;
+    if(target != -1 && (op->operand = (int)instructionIndex(machine, target)) < 0)
+        op->kind = opBadTarget; /* A jump that would leave the code image is reported once it's reached */
+
+    if(op->kind == opLa)
+        op->operand = (int)data.typeJ.address;
+    else if(op->kind == opJmpRegister)
+        op->rs = (unsigned char)(data.typeJ.address & maxRegister);
+}
+
+
+state loadSimulator(simulator *machine, const codeImageTable *codeImage, const dataImageTable *dataImage)
+{
+    unsigned long i;
+    unsigned int word;
+    unsigned char *bytes;
+
+    machine->numOfOps = codeImage->count;
+    machine->codeEnd = ICInitialValue + (long)codeImage->count * 4;
+    machine->memorySize = simulatorMemorySize;
+    if((unsigned long)machine->codeEnd + dataImage->size > machine->memorySize)
+        return INVALID;
+
+    machine->memory = (unsigned char *) callocWithCheck(machine->memorySize);
+    machine->ops = (simulatorOp *) callocWithCheck((codeImage->count + 1) * sizeof(simulatorOp));
+    machine->maxSteps = ULONG_MAX;
+
+    /* The code is stored in memory like the object file holds it (the least significant byte first), then the data */
+    for(i = 0; i < codeImage->count; i++)
+    {
+        memcpy(&word, &codeImage->entries[i].data, sizeof(word));
+        bytes = machine->memory + ICInitialValue + i * 4;
+        bytes[0] = (unsigned char)(word & 0xFF);
+        bytes[1] = (unsigned char)(word >> 8 & 0xFF);
+        bytes[2] = (unsigned char)(word >> 16 & 0xFF);
+        bytes[3] = (unsigned char)(word >> 24 & 0xFF);
+    }
+    if(dataImage->size != 0)
+        memcpy(machine->memory + machine->codeEnd, dataImage->bytes, dataImage->size);
+
+    for(i = 0; i < codeImage->count; i++)
+        predecodeInstruction(machine, i);
+    machine->ops[codeImage->count].kind = opRanPastEnd;
+    return VALID;
+}
+
+
+state loadObjectImage(simulator *machine, const char *fileName, FILE *errors)
+{
+    FILE *fileDescriptor;
+    sourceBuffer content = {0};
+    newLine line = {0};
+    codeImageTable codeImage = {0};
+    dataImageTable dataImage = {0};
+    long codeSize, dataSize;
+    state loadState = INVALID;
+
+    if(openFile(&fileDescriptor, fileName, "r", errors) == INVALID)
+        return INVALID;
+    readSourceFile(fileDescriptor, &content);
+    fclose(fileDescriptor);
+
+    line.sourceFileName = fileName;
+    if(parseObjectFile(&content, &line, &codeImage, &dataImage, ICInitialValue, &codeSize, &dataSize) == INVALID)
+        printLineError(&line, errors);
+    else if((loadState = loadSimulator(machine, &codeImage, &dataImage)) == INVALID)
+        fprintf(errors, "Error: the program in '%s' doesn't fit in the memory of the machine.\n", fileName);
+
+    free(content.content);
+    free(codeImage.entries);
+    free(dataImage.bytes);
+    return loadState;
+}
+
+
+state runSimulator(simulator *machine)
+{
+    simulatorOp *ops = machine->ops, *op = machine->ops;
+    unsigned int *reg = machine->registers;
+    unsigned char *memory = machine->memory;
+    unsigned long steps = machine->steps, maxSteps = machine->maxSteps, address, last = machine->memorySize;
+    long target;
+#ifdef simulatorThreaded
+    unsigned long i;
+    static const void *handlers[numOfSimulatorOps] = {
+            handlerOf(opAdd), handlerOf(opSub), handlerOf(opAnd), handlerOf(opOr), handlerOf(opNor),
+            handlerOf(opMove), handlerOf(opMvhi), handlerOf(opMvlo), handlerOf(opAddi), handlerOf(opSubi),
+            handlerOf(opAndi), handlerOf(opOri), handlerOf(opNori), handlerOf(opBne), handlerOf(opBeq),
+            handlerOf(opBlt), handlerOf(opBgt), handlerOf(opLb), handlerOf(opSb), handlerOf(opLw), handlerOf(opSw),
+            handlerOf(opLh), handlerOf(opSh), handlerOf(opJmp), handlerOf(opJmpRegister), handlerOf(opLa),
+            handlerOf(opCall), handlerOf(opStop), handlerOf(opIllegal), handlerOf(opBadTarget), handlerOf(opRanPastEnd)
+    };
+
+    /* Threads the predecoded instructions - each one points at the code executing it */
+    for(i = 0; i <= machine->numOfOps; i++)
+        ops[i].handler = handlers[ops[i].kind];
+#endif
+
+    machine->fault = NULL;
+    beginDispatch()
+
+    simulatorCase(opAdd) reg[op->rd] = reg[op->rs] + reg[op->rt]; nextOp();
+    simulatorCase(opSub) reg[op->rd] = reg[op->rs] - reg[op->rt]; nextOp();
+    simulatorCase(opAnd) reg[op->rd] = reg[op->rs] & reg[op->rt]; nextOp();
+    simulatorCase(opOr) reg[op->rd] = reg[op->rs] | reg[op->rt]; nextOp();
+    simulatorCase(opNor) reg[op->rd] = ~(reg[op->rs] | reg[op->rt]); nextOp();
+    simulatorCase(opMove) reg[op->rd] = reg[op->rs]; nextOp();
+    /* The upper or the lower half of the register, moved to the lower half of the destination */
+    simulatorCase(opMvhi) reg[op->rd] = reg[op->rs] >> 16 & 0xFFFF; nextOp();
+    simulatorCase(opMvlo) reg[op->rd] = reg[op->rs] & 0xFFFF; nextOp();
+
+    simulatorCase(opAddi) reg[op->rt] = reg[op->rs] + (unsigned int)op->operand; nextOp();
+    simulatorCase(opSubi) reg[op->rt] = reg[op->rs] - (unsigned int)op->operand; nextOp();
+    simulatorCase(opAndi) reg[op->rt] = reg[op->rs] & (unsigned int)op->operand; nextOp();
+    simulatorCase(opOri) reg[op->rt] = reg[op->rs] | (unsigned int)op->operand; nextOp();
+    simulatorCase(opNori) reg[op->rt] = ~(reg[op->rs] | (unsigned int)op->operand); nextOp();
+
+    simulatorCase(opBne)
+        if(reg[op->rs] != reg[op->rt])
+        {
+            jumpTo(op->operand);
+        }
+        nextOp();
+    simulatorCase(opBeq)
+        if(reg[op->rs] == reg[op->rt])
+        {
+            jumpTo(op->operand);
+        }
+        nextOp();
+    simulatorCase(opBlt)
+        if((int)reg[op->rs] < (int)reg[op->rt])
+        {
+            jumpTo(op->operand);
+        }
+        nextOp();
+    simulatorCase(opBgt)
+        if((int)reg[op->rs] > (int)reg[op->rt])
+        {
+            jumpTo(op->operand);
+        }
+        nextOp();
+
+    /* The loaded values are sign extended, the stored values are truncated, the least significant byte first */
+    simulatorCase(opLb)
+        if((address = (unsigned long)(reg[op->rs] + (unsigned int)op->operand)) > last - 1)
+        {
+            faultAt("The loaded address is outside the memory");
+        }
+        reg[op->rt] = (unsigned int)memory[address] - ((unsigned int)(memory[address] & 0x80) << 1);
+        nextOp();
+    simulatorCase(opLh)
+        if((address = (unsigned long)(reg[op->rs] + (unsigned int)op->operand)) > last - 2)
+        {
+            faultAt("The loaded address is outside the memory");
+        }
+        reg[op->rt] = (unsigned int)memory[address] | (unsigned int)memory[address + 1] << 8;
+        reg[op->rt] -= (reg[op->rt] & 0x8000) << 1;
+        nextOp();
+    simulatorCase(opLw)
+        if((address = (unsigned long)(reg[op->rs] + (unsigned int)op->operand)) > last - 4)
+        {
+            faultAt("The loaded address is outside the memory");
+        }
+        reg[op->rt] = (unsigned int)memory[address] | (unsigned int)memory[address + 1] << 8 |
+                      (unsigned int)memory[address + 2] << 16 | (unsigned int)memory[address + 3] << 24;
+        nextOp();
+    simulatorCase(opSb)
+        if((address = (unsigned long)(reg[op->rs] + (unsigned int)op->operand)) > last - 1)
+        {
+            faultAt("The stored address is outside the memory");
+        }
+        memory[address] = (unsigned char)(reg[op->rt] & 0xFF);
+        if(address < (unsigned long)machine->codeEnd)
+            goto storeIntoCode;
+        nextOp();
+    simulatorCase(opSh)
+        if((address = (unsigned long)(reg[op->rs] + (unsigned int)op->operand)) > last - 2)
+        {
+            faultAt("The stored address is outside the memory");
+        }
+        memory[address] = (unsigned char)(reg[op->rt] & 0xFF);
+        memory[address + 1] = (unsigned char)(reg[op->rt] >> 8 & 0xFF);
+        if(address < (unsigned long)machine->codeEnd)
+            goto storeIntoCode;
+        nextOp();
+    simulatorCase(opSw)
+        if((address = (unsigned long)(reg[op->rs] + (unsigned int)op->operand)) > last - 4)
+        {
+            faultAt("The stored address is outside the memory");
+        }
+        memory[address] = (unsigned char)(reg[op->rt] & 0xFF);
+        memory[address + 1] = (unsigned char)(reg[op->rt] >> 8 & 0xFF);
+        memory[address + 2] = (unsigned char)(reg[op->rt] >> 16 & 0xFF);
+        memory[address + 3] = (unsigned char)(reg[op->rt] >> 24 & 0xFF);
+        if(address < (unsigned long)machine->codeEnd)
+            goto storeIntoCode;
+        nextOp();
+
+    simulatorCase(opJmp) jumpTo(op->operand);
+    simulatorCase(opJmpRegister)
+        if((target = instructionIndex(machine, (long)reg[op->rs])) < 0)
+        {
+            faultAt("The register holds an address that isn't an instruction");
+        }
+        jumpTo(target);
+    simulatorCase(opLa) reg[0] = (unsigned int)op->operand; nextOp();
+    simulatorCase(opCall)
+        reg[0] = (unsigned int)(ICInitialValue + (op - ops) * 4 + 4);
+        jumpTo(op->operand);
+    simulatorCase(opStop) steps++; goto stopRun;
+
+    simulatorCase(opIllegal) faultAt("Illegal instruction");
+    simulatorCase(opBadTarget) faultAt("The target of the jump isn't an instruction");
+    simulatorCase(opRanPastEnd) faultAt("The program ran past its last instruction");
+
+storeIntoCode:
+    /* The program changed its own code - the changed instructions are decoded again */
+    {
+        unsigned long first = (address < ICInitialValue + 3) ? 0 : (address - ICInitialValue - 3) / 4;
+        unsigned long index;
+
+        for(index = first; index < machine->numOfOps && index * 4 + ICInitialValue <= address + 3; index++)
+        {
+            predecodeInstruction(machine, index);
+#ifdef simulatorThreaded
+            ops[index].handler = handlers[ops[index].kind];
+#endif
+        }
+    }
+    nextOp();
+
+    endDispatch()
+
+stepLimit:
+    machine->fault = "The limit of executed instructions was reached";
+stopRun:
+    machine->steps = steps;
+    machine->pc = ICInitialValue + (long)(op - ops) * 4;
+    return (machine->fault == NULL) ? VALID : INVALID;
+}
+
+
+void printRegisters(const simulator *machine, FILE *out)
+{
+    int i;
+
+    for(i = 0; i < numOfRegisters; i++)
+        fprintf(out, "$%-2d = %11d%s", i, (int)machine->registers[i], (i % 4 == 3) ? "\n" : "    ");
+}
+
+
+void freeSimulator(simulator *machine)
+{
+    free(machine->ops);
+    free(machine->memory);
+    memset(machine, 0, sizeof(simulator));
+}
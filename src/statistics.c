@@ -0,0 +1,177 @@
+/* For 'clock_gettime' */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../include/statistics.h"
+#include "../include/lineHandling.h"
+
+/* The names of the phases in the printed statistics, by the order of 'assemblyPhase' */
+static const char *phaseNames[numOfAssemblyPhases][2] = {
+        {"read", "read"}, {"first pass", "firstPass"}, {"branch relaxation", "relaxation"},
+        {"update values", "updateValues"},
+        {"second pass", "secondPass"}, {"object file", "objectFile"}, {"entries/externals files", "attributesFiles"}
+};
+
+static const char *outcomeNames[] = {"unused", "hit", "miss"};
+
+
+double secondsNow(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+
+double phaseStart(const assemblyContext *context)
+{
+    return (context->statistics != NULL) ? secondsNow() : 0;
+}
+
+
+void phaseEnd(const assemblyContext *context, assemblyPhase phase, double start)
+{
+    if(context->statistics != NULL)
+        context->statistics->seconds[phase] += secondsNow() - start;
+}
+
+
+void countAssembly(const assemblyContext *context, assemblyStatistics *statistics)
+{
+    attributesTable attribute;
+
+    statistics->symbols = context->symbolTab.count;
+    statistics->codeWords = context->codeImage.count;
+    statistics->dataBytes = context->dataImage.size;
+    statistics->fixups = context->fixups.count;
+    for(statistics->attributes = 0, attribute = context->attributesTab; attribute != NULL; attribute = attribute->next)
+        statistics->attributes++;
+}
+
+
+void collectStatistics(const assemblyContext *context, assemblyStatistics *statistics)
+{
+    /* A restored file has no tables, its counts were restored from the cache entry along with its outputs */
+    if(statistics->outcome == cacheHit)
+    {
+        statistics->lines = countSourceLines(&context->source);
+        return;
+    }
+
+    /* The number of lines is counted by the first pass */
+    countAssembly(context, statistics);
+    statistics->arenaAllocations = context->memory.allocations;
+    statistics->arenaBytes = context->memory.bytes;
+    statistics->arenaBlocks = context->memory.blockCount;
+    statistics->tableBytes = context->source.size + context->symbolTab.capacity * sizeof(symbolTable) +
+                             context->codeImage.capacity * sizeof(codeImageEntry) + context->dataImage.capacity +
+                             context->fixups.capacity * sizeof(fixupEntry) +
+                             context->entries.capacity * sizeof(deferredEntry);
+}
+
+
+void printJsonString(const char *string, FILE *out)
+{
+    fputc('"', out);
+    for(; *string != '\0'; string++)
+    {
+        if(*string == '"' || *string == '\\')
+            fprintf(out, "\\%c", *string);
+        else if((unsigned char)*string < ' ')
+            fprintf(out, "\\u%04x", (unsigned int)(unsigned char)*string);
+        else
+            fputc(*string, out);
+    }
+    fputc('"', out);
+}
+
+
+void printStatistics(const char *fileName, const assemblyStatistics *statistics, statisticsFormat format, FILE *out)
+{
+    int i;
+    double linesPerSecond = (statistics->totalSeconds > 0) ? (double)statistics->lines / statistics->totalSeconds : 0;
+
+    if(format == jsonStatistics)
+    {
+        fprintf(out, "{\"file\": ");
+        printJsonString(fileName, out);
+        fprintf(out, ", \"valid\": %s, \"cache\": \"%s\", \"seconds\": {", statistics->isValid ? "true" : "false",
+                outcomeNames[statistics->outcome]);
+        for(i = 0; i < numOfAssemblyPhases; i++)
+        {
+            fprintf(out, "%s\"%s\": ", (i == 0) ? "" : ", ", phaseNames[i][1]);
+            if(statistics->seconds[i] > 0)
+                fprintf(out, "%.6f", statistics->seconds[i]);
+            else
+                fprintf(out, "null");
+        }
+        fprintf(out, ", \"total\": %.6f}, \"linesPerSecond\": %.0f, \"lines\": %ld, \"symbols\": %lu, "
+                     "\"codeWords\": %lu, \"dataBytes\": %lu, \"fixups\": %lu, \"attributes\": %lu, ",
+                statistics->totalSeconds, linesPerSecond, statistics->lines, statistics->symbols,
+                statistics->codeWords, statistics->dataBytes, statistics->fixups, statistics->attributes);
+        if(statistics->outcome == cacheHit)
+            fprintf(out, "\"allocations\": null, \"allocatedBytes\": null, \"arenaBlocks\": null, \"tableBytes\": null}\n");
+        else
+            fprintf(out, "\"allocations\": %lu, \"allocatedBytes\": %lu, \"arenaBlocks\": %lu, \"tableBytes\": %lu}\n",
+                    statistics->arenaAllocations, statistics->arenaBytes, statistics->arenaBlocks,
+                    statistics->tableBytes);
+        return;
+    }
+
+    fprintf(out, "Statistics of file '%s' (%s%s):\n", fileName, statistics->isValid ? "valid" : "invalid",
+            (statistics->outcome == cacheHit) ? ", restored from the cache" : "");
+    for(i = 0; i < numOfAssemblyPhases; i++)
+        if(statistics->seconds[i] > 0)
+            fprintf(out, "    %-24s %10.3f ms\n", phaseNames[i][0], statistics->seconds[i] * 1000);
+    fprintf(out, "    %-24s %10.3f ms, %.0f lines per second\n", "total", statistics->totalSeconds * 1000, linesPerSecond);
+    fprintf(out, "    lines %ld, symbols %lu, code words %lu, data bytes %lu, fixups %lu, attributes %lu\n",
+            statistics->lines, statistics->symbols, statistics->codeWords, statistics->dataBytes, statistics->fixups,
+            statistics->attributes);
+    if(statistics->outcome == cacheHit)
+        fprintf(out, "    arena: n/a, tables: n/a (the file wasn't assembled)\n");
+    else
+        fprintf(out, "    arena: %lu allocations (%lu bytes) in %lu blocks, tables: %lu bytes\n",
+                statistics->arenaAllocations, statistics->arenaBytes, statistics->arenaBlocks, statistics->tableBytes);
+}
+
+
+int compareFileTimings(const void *first, const void *second)
+{
+    const fileTiming *firstFile = (const fileTiming *) first, *secondFile = (const fileTiming *) second;
+
+    if(firstFile->seconds != secondFile->seconds)
+        return (firstFile->seconds > secondFile->seconds) ? -1 : 1;
+    if(firstFile->size != secondFile->size)
+        return (firstFile->size > secondFile->size) ? -1 : 1;
+    return strcmp(firstFile->fileName, secondFile->fileName);
+}
+
+
+void printTimingSummary(fileTiming *timings, int numOfFiles, int numOfWorkers, double wallSeconds, FILE *out)
+{
+    double filesSeconds = 0;
+    unsigned long totalSize = 0;
+    int i;
+
+    for(i = 0; i < numOfFiles; i++)
+    {
+        filesSeconds += timings[i].seconds;
+        totalSize += timings[i].size;
+    }
+    qsort(timings, numOfFiles, sizeof(fileTiming), compareFileTimings);
+
+    fprintf(out, "Timing of %d files (%lu bytes) on %d worker%s: %.3f ms, files %.3f ms (%.0f%% of the workers' time)\n",
+            numOfFiles, totalSize, numOfWorkers, (numOfWorkers == 1) ? "" : "s", wallSeconds * 1000,
+            filesSeconds * 1000, (wallSeconds > 0) ? filesSeconds / (wallSeconds * numOfWorkers) * 100 : 0);
+    for(i = 0; i < numOfFiles; i++)
+    {
+        fprintf(out, "    %10.3f ms  %10lu bytes", timings[i].seconds * 1000, timings[i].size);
+        if(numOfWorkers > 1)
+            fprintf(out, "  worker %d", timings[i].worker + 1);
+        fprintf(out, "  %s\n", timings[i].fileName);
+    }
+}
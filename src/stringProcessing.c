@@ -42,7 +42,7 @@ state checkForComma(newLine *line, int *index, int numOfVariables)
 }
 
 
-void checkInteger(newLine* line, int* contentIndex, int* numOfVariables, int maxNumLength, int maxVal, int minVal)
+int checkInteger(newLine* line, int* contentIndex, int* numOfVariables, int maxNumLength, int maxVal, int minVal)
 {
     int numValue;
     char numString[maxNumLength + 2];
@@ -53,12 +53,13 @@ void checkInteger(newLine* line, int* contentIndex, int* numOfVariables, int max
         line->error = addError("Invalid operand, Operand must be an integer in the range defined by the instruction/directive");
     else
         (*numOfVariables)++;
+    return numValue;
 }
 
 
-void checkRegister(newLine *line, int *contentIndex, int *numOfScannedOperands)
+int checkRegister(newLine *line, int *contentIndex, int *numOfScannedOperands)
 {
-    int registerNum;
+    int registerNum = 0;
     char registerString[maxRegisterLength + 2];
     state registerState = VALID;
 
@@ -76,6 +77,7 @@ void checkRegister(newLine *line, int *contentIndex, int *numOfScannedOperands)
         line->error = addError("Invalid register. register must start with '$' and represent a number between 0-31");
     else
         (*numOfScannedOperands)++;
+    return registerNum;
 }
 
 
@@ -104,43 +106,6 @@ void checkOperandsAmount(newLine* line, unsigned int opcode, int numOfScannedOpe
 }
 
 
-int get2BytesInt(const char *content, int *index)
-{
-    int intValue;
-    char intString[max2BytesIntLength + 2];
-
-    intValue = scanInt(content, index, intString, max2BytesIntLength);
-
-    return intValue;
-}
-
-
-int getRegister(const char *content, int *index)
-{
-    int registerNum;
-    char registerString[maxRegisterLength + 2];
-
-    for(; content[*index] != '$'; (*index)++ );  /* Continues until encountering the beginning of a register */
-
-    (*index)++;  /* Skips to the register number */
-
-    registerNum = scanInt(content, index, registerString, maxRegisterLength);
-
-    return registerNum;
-}
-
-
-bool isRegister(const char *content, int index)
-{
-    /* Continues until encountering beginning of an operand */
-    for(; isWhiteSpace(content[index]) || content[index] == ','; index++);
-    /* If encountered beginning of a register */
-    if(content[index] == '$')
-        return TRUE;
-    return FALSE;
-}
-
-
 int scanInt(const char *content, int *contentIndex, char *numString, int maxLength)
 {
     int numValue;
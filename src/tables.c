@@ -3,6 +3,7 @@
 #include <stdlib.h>
 #include "../include/stringProcessing.h"
 #include "../include/general.h"
+#include "../include/arena.h"
 
 
 void setSymbolTableEntryValues(long address, imageType type, symbolTable newEntry, char *labelName) {
@@ -26,178 +27,276 @@ void setSymbolTableEntryValues(long address, imageType type, symbolTable newEntr
 }
 
 
-void addToSymbolTable(symbolTable *table, char *symbol, long address, imageType type)
+unsigned long hashSymbolName(const char *name)
 {
-    symbolTable newEntry, tempEntry;
-    char *labelName;
+    unsigned long hash = 2166136261UL;
 
-    /* Allocates memory and initializes the symbol */
-    newEntry = (symbolTable) callocWithCheck(sizeof(symbolTableEntry));
-    labelName = (char *) callocWithCheck(strlen(symbol) + 1);
-    strcpy(labelName, symbol);
+    for(; *name != '\0'; name++)
+    {
+        hash ^= (unsigned char)(*name);
+        hash *= 16777619UL;
+    }
+    return hash;
+}
 
-    /* Set values for the new symbol table entry */
-    setSymbolTableEntryValues(address, type, newEntry, labelName);
 
-    /* If the table is empty, the new entry becomes the first */
-    if((*table) == NULL)
-        (*table) = newEntry;
-    /* Otherwise, append the new entry at the end of the list */
+symbolTable findSymbol(symbolHashTable *table, const char *name)
+{
+    unsigned long slot;
+
+    /* An empty table has no hash index yet */
+    if(table->capacity == 0)
+        return NULL;
+
+    /* Probes the slots linearly until the symbol or an empty slot is found */
+    for(slot = hashSymbolName(name) & (table->capacity - 1); table->slots[slot] != NULL;
+        slot = (slot + 1) & (table->capacity - 1))
+    {
+        if(strcmp(table->slots[slot]->name, name) == 0)
+            return table->slots[slot];
+    }
+    return NULL;
+}
+
+
+void growSymbolTable(symbolHashTable *table)
+{
+    unsigned long slot;
+    symbolTable currentEntry;
+
+    free(table->slots);
+    table->capacity = (table->capacity == 0) ? symbolTableInitialCapacity : table->capacity * 2;
+    table->slots = (symbolTable *) callocWithCheck(table->capacity * sizeof(symbolTable));
+
+    /* Re-indexes all the symbols according to the new capacity */
+    for(currentEntry = table->head; currentEntry != NULL; currentEntry = currentEntry->next)
+    {
+        for(slot = hashSymbolName(currentEntry->name) & (table->capacity - 1); table->slots[slot] != NULL;
+            slot = (slot + 1) & (table->capacity - 1));
+        table->slots[slot] = currentEntry;
+    }
+}
+
+
+void insertSymbol(symbolHashTable *table, symbolTable newEntry)
+{
+    unsigned long slot;
+
+    newEntry->next = NULL;
+    /* Appends the new entry at the end of the list */
+    if(table->head == NULL)
+        table->head = newEntry;
+    else
+        table->tail->next = newEntry;
+    table->tail = newEntry;
+    table->count++;
+
+    /* Keeps the hash index at most half full, so the probe sequences stay short */
+    if(table->count * 2 > table->capacity)
+        growSymbolTable(table);
     else
     {
-        /* Traverse the list to find the last node */
-        for(tempEntry = (*table); tempEntry -> next != NULL; tempEntry = tempEntry -> next);
-        tempEntry -> next = newEntry;
+        for(slot = hashSymbolName(newEntry->name) & (table->capacity - 1); table->slots[slot] != NULL;
+            slot = (slot + 1) & (table->capacity - 1));
+        table->slots[slot] = newEntry;
     }
 }
 
 
-void setDataEntryValues(directiveType type, int numOfVars, long DC, void* dataArr, int sizeofVar, dataTable newEntry)
+void addToSymbolTable(symbolHashTable *table, char *symbol, long address, imageType type, arena *memory)
 {
-    newEntry -> dataType = type;
-	newEntry -> variableSize = sizeofVar;
-    newEntry -> numOfVariables = numOfVars;
-    newEntry -> data = dataArr;
-    newEntry -> address = DC;
-    newEntry -> dataSize = sizeofVar * numOfVars;
-    newEntry -> next = NULL;
+    symbolTable newEntry;
+    char *labelName;
+
+    /* Allocates memory from the arena and initializes the symbol */
+    newEntry = (symbolTable) arenaAlloc(memory, sizeof(symbolTableEntry));
+    labelName = arenaCopyString(memory, symbol);
+
+    /* Set values for the new symbol table entry */
+    setSymbolTableEntryValues(address, type, newEntry, labelName);
+    insertSymbol(table, newEntry);
 }
 
 
-int getSizeOfDataVariable(directiveType type)
+void reserveDataBytes(dataImageTable *table, unsigned long numOfBytes)
 {
-    int sizeofVariable;
-    /* '.db' / '.asciz' receives 1 byte variables */
-    if(type == DB || type == ASCIZ)
-        sizeofVariable = sizeof(char);
-    /* '.dh' receives 2 bytes variables */
-    if(type == DH)
-        sizeofVariable = sizeof(short);
-    /* '.dw' receives 4 bytes variables */
-    if(type == DW)
-        sizeofVariable = sizeof(int);
+    if(table->size + numOfBytes <= table->capacity)
+        return;
+
+    if(table->capacity == 0)
+        table->capacity = dataImageInitialCapacity;
+    while(table->size + numOfBytes > table->capacity)
+        table->capacity *= 2;
+    table->bytes = reallocWithCheck(table->bytes, table->capacity);
+}
+
 
-    return sizeofVariable;
+void appendDataByte(dataImageTable *table, long value)
+{
+    reserveDataBytes(table, 1);
+    table->bytes[table->size++] = (unsigned char)(value & 0xFF);
 }
 
 
-void addToDataImage(directiveType type, int numOfVariables, long* DC, void* dataArray, dataTable* table)
+void appendDataHalfWord(dataImageTable *table, long value)
 {
-    int sizeofVariable;
-    dataTable newEntry, tempEntry;
+    reserveDataBytes(table, 2);
+    table->bytes[table->size++] = (unsigned char)(value & 0xFF);
+    table->bytes[table->size++] = (unsigned char)((value >> 8) & 0xFF);
+}
+
 
-    sizeofVariable = getSizeOfDataVariable(type);
-    newEntry = callocWithCheck(sizeof(dataImageEntry));
+void appendDataWord(dataImageTable *table, long value)
+{
+    reserveDataBytes(table, 4);
+    table->bytes[table->size++] = (unsigned char)(value & 0xFF);
+    table->bytes[table->size++] = (unsigned char)((value >> 8) & 0xFF);
+    table->bytes[table->size++] = (unsigned char)((value >> 16) & 0xFF);
+    table->bytes[table->size++] = (unsigned char)((value >> 24) & 0xFF);
+}
 
-    setDataEntryValues(type, numOfVariables, *DC, dataArray, sizeofVariable, newEntry);
-    /* Increases the data counter (DC) according to the size of the obtained data */
-    (*DC) += newEntry->dataSize;
 
-    /* If the table is empty */
-    if((*table) == NULL)
-        (*table) = newEntry;
-    /* Defines the new entry to be the last in the list */
-    else
-    {
-        for(tempEntry = (*table); tempEntry -> next != NULL; tempEntry = tempEntry -> next);
-        tempEntry -> next = newEntry;
-    }
+void appendDataVariable(dataImageTable *table, directiveType type, long value)
+{
+    /* '.db' / '.asciz' receives 1 byte variables */
+    if(type == DB || type == ASCIZ)
+        appendDataByte(table, value);
+    /* '.dh' receives 2 bytes variables */
+    else if(type == DH)
+        appendDataHalfWord(table, value);
+    /* '.dw' receives 4 bytes variables */
+    else if(type == DW)
+        appendDataWord(table, value);
 }
 
 
-void setJBitField(const char *content, int *index, instructionWord *instructionToken, codeTable newEntry)
+void setJBitField(const instructionLine *instructionIR, codeImageEntry *newEntry)
 {
-    newEntry -> data -> typeJ.opcode = (*instructionToken).opcode;
+    newEntry -> data.typeJ.opcode = instructionIR->word.opcode;
 
     /* If it's 'jump' instruction with register operand */
-    if((*instructionToken).opcode == 30 && isRegister(content, (*index)))
+    if(instructionIR->numOfOperands == 1 && instructionIR->operands[0].kind == registerOperand)
     {
-        newEntry -> data -> typeJ.reg = 1;
-        newEntry -> data -> typeJ.address = getRegister(content, index);
+        newEntry -> data.typeJ.reg = 1;
+        newEntry -> data.typeJ.address = instructionIR->operands[0].value;
     }
     else
-        newEntry -> data -> typeJ.reg = 0;
+        newEntry -> data.typeJ.reg = 0;
 }
 
 
-void setIBitField(const char *content, int *index, instructionWord *instructionToken, codeTable newEntry)
+void setIBitField(const instructionLine *instructionIR, codeImageEntry *newEntry)
 {
-    newEntry -> data -> typeI.opcode = (*instructionToken).opcode;
-    newEntry -> data -> typeI.rs = getRegister(content, index);
-
-    /* Checks if it's a conditional branching instruction */
-    if(!((*instructionToken).opcode >= 15 && (*instructionToken).opcode <= 18))
-	{
-        /* skips to the start of the next operand */
-		(*index)++;
-		newEntry -> data -> typeI.immed = get2BytesInt(content, index);
-	}
-    newEntry -> data -> typeI.rt = getRegister(content, index);
+    newEntry -> data.typeI.opcode = instructionIR->word.opcode;
+    newEntry -> data.typeI.rs = instructionIR->operands[0].value;
+
+    /* A conditional branching instruction receives 2 registers and a label, resolved by a fixup */
+    if(instructionIR->operands[1].kind == registerOperand)
+        newEntry -> data.typeI.rt = instructionIR->operands[1].value;
+    else
+    {
+        newEntry -> data.typeI.immed = (int)instructionIR->operands[1].value;
+        newEntry -> data.typeI.rt = instructionIR->operands[2].value;
+    }
 }
 
 
-void setRBitField(const char *content, int *index, instructionWord *instructionToken, codeTable newEntry)
+void setRBitField(const instructionLine *instructionIR, codeImageEntry *newEntry)
 {
-    newEntry -> data -> typeR.unused = 0;
-    newEntry -> data -> typeR.opcode = (*instructionToken).opcode;
-    newEntry -> data -> typeR.funct = (*instructionToken).funct;
-    newEntry -> data -> typeR.rs = getRegister(content, index);
+    newEntry -> data.typeR.unused = 0;
+    newEntry -> data.typeR.opcode = instructionIR->word.opcode;
+    newEntry -> data.typeR.funct = instructionIR->word.funct;
+    newEntry -> data.typeR.rs = instructionIR->operands[0].value;
 
     /* If it's a copy instruction, rt field doesn't receive a variable */
-    if((*instructionToken).opcode == 1)
-        newEntry -> data -> typeR.rt = 0;
+    if(instructionIR->word.opcode == 1)
+    {
+        newEntry -> data.typeR.rt = 0;
+        newEntry -> data.typeR.rd = instructionIR->operands[1].value;
+    }
     else
-        newEntry -> data -> typeR.rt = getRegister(content, index);
-
-    newEntry -> data -> typeR.rd = getRegister(content, index);
+    {
+        newEntry -> data.typeR.rt = instructionIR->operands[1].value;
+        newEntry -> data.typeR.rd = instructionIR->operands[2].value;
+    }
 }
 
 
-void setCodeEntryBitfield(const char *content, int index, instructionWord instructionToken, codeTable newEntry)
+void setCodeEntryBitfield(const instructionLine *instructionIR, codeImageEntry *newEntry)
 {
-    /* Allocation new memory for the binary representation(using bit field) of the new code image entry */
-    newEntry->data = callocWithCheck(sizeof(typeRInstruction));
-
-    if(instructionToken.type == R)
-        setRBitField(content, &index, &instructionToken, newEntry);
+    if(instructionIR->word.type == R)
+        setRBitField(instructionIR, newEntry);
 
-    else if(instructionToken.type == I)
-        setIBitField(content, &index, &instructionToken, newEntry);
+    else if(instructionIR->word.type == I)
+        setIBitField(instructionIR, newEntry);
 
-    else if(instructionToken.type == J)
-        setJBitField(content, &index, &instructionToken, newEntry);
+    else if(instructionIR->word.type == J)
+        setJBitField(instructionIR, newEntry);
 }
 
 
-void setCodeEntryValues(const char* content, int index, instructionWord instructionToken, long IC, codeTable newEntry,
-		long lineNumber)
+void setCodeEntryValues(const instructionLine *instructionIR, long IC, codeImageEntry *newEntry, long lineNumber)
 {
-    setCodeEntryBitfield(content, index, instructionToken, newEntry);
+    setCodeEntryBitfield(instructionIR, newEntry);
 	newEntry ->lineNumber = lineNumber;
     newEntry -> address = (int)IC;
-    newEntry -> type = instructionToken.type;
-    newEntry -> next = NULL;
+    newEntry -> type = instructionIR->word.type;
 }
 
 
-void addToCodeImage(const char* content, int index, instructionWord instructionToken, codeTable* table, long* IC,
-		long lineNumber)
+void addToCodeImage(const instructionLine *instructionIR, codeImageTable* table, long* IC, long lineNumber)
 {
-    codeTable newEntry, tempEntry;
+    codeImageEntry *newEntry;
+
+    /* If the array is full, doubles its capacity */
+    if(table->count == table->capacity)
+    {
+        table->capacity = (table->capacity == 0) ? codeImageInitialCapacity : table->capacity * 2;
+        table->entries = reallocWithCheck(table->entries, table->capacity * sizeof(codeImageEntry));
+    }
+    /* The new entry is placed right after the last one, its bit fields start cleared */
+    newEntry = &table->entries[table->count++];
+    memset(newEntry, 0, sizeof(codeImageEntry));
 
-    newEntry = callocWithCheck(sizeof(codeImageEntry));
-	setCodeEntryValues(content, index, instructionToken, *IC, newEntry, lineNumber);
+	setCodeEntryValues(instructionIR, *IC, newEntry, lineNumber);
     (*IC) += 4;
+}
 
-    /* If the table is empty */
-    if((*table) == NULL)
-        (*table) = newEntry;
-    else
+
+void addToFixupTable(fixupTable *table, unsigned long codeIndex, instructionType type, char *symbol, long lineNumber,
+        arena *memory)
+{
+    fixupEntry *newEntry;
+
+    /* If the array is full, doubles its capacity */
+    if(table->count == table->capacity)
     {
-        /* Defines the new entry to be the last in the list */
-        for(tempEntry = (*table); tempEntry -> next != NULL; tempEntry = tempEntry -> next);
-        tempEntry -> next = newEntry;
+        table->capacity = (table->capacity == 0) ? fixupTableInitialCapacity : table->capacity * 2;
+        table->entries = reallocWithCheck(table->entries, table->capacity * sizeof(fixupEntry));
     }
+    newEntry = &table->entries[table->count++];
+
+    newEntry -> codeIndex = codeIndex;
+    newEntry -> type = type;
+    newEntry -> lineNumber = lineNumber;
+    newEntry -> symbol = arenaCopyString(memory, symbol);
+}
+
+
+void addToDeferredEntries(deferredEntryTable *table, char *name, long lineNumber, arena *memory)
+{
+    deferredEntry *newEntry;
+
+    /* If the array is full, doubles its capacity */
+    if(table->count == table->capacity)
+    {
+        table->capacity = (table->capacity == 0) ? deferredEntriesInitialCapacity : table->capacity * 2;
+        table->entries = reallocWithCheck(table->entries, table->capacity * sizeof(deferredEntry));
+    }
+    newEntry = &table->entries[table->count++];
+
+    newEntry -> lineNumber = lineNumber;
+    newEntry -> name = arenaCopyString(memory, name);
 }
 
 
@@ -210,83 +309,52 @@ void setAttributeEntryValues(imageType type, long address, attributesTable newEn
 }
 
 
-void addToAttributesTable(char *name, imageType type, long address, attributesTable *table)
+void addToAttributesTable(char *name, imageType type, long address, attributesTable *table, attributesTable *tail,
+        arena *memory)
 {
-    attributesTable newEntry, tempEntry;
+    attributesTable newEntry;
     char *currentName;
 
-    newEntry = (attributesTable) callocWithCheck(sizeof(attributesTableEntry));
-    currentName = (char *) callocWithCheck(strlen(name) + 1);
-    strcpy(currentName, name);
+    newEntry = (attributesTable) arenaAlloc(memory, sizeof(attributesTableEntry));
+    currentName = arenaCopyString(memory, name);
     setAttributeEntryValues(type, address, newEntry, currentName);
 
     if((*table) == NULL)  /* If the table is empty */
         (*table) = newEntry;
     else
-    {
         /* Defines the new node to be the last */
-        for(tempEntry = (*table); tempEntry -> next != NULL; tempEntry = tempEntry -> next);
-        tempEntry -> next = newEntry;
-    }
+        (*tail) -> next = newEntry;
+    (*tail) = newEntry;
 }
 
 
-void addEntrySymbolsToTable(attributesTable *attributesHead, symbolTable symbolHead)
+void addEntrySymbolsToTable(attributesTable *attributesHead, attributesTable *attributesTail, symbolHashTable *symbolTab,
+        arena *memory)
 {
-    symbolTable symbolEntry = symbolHead;
+    symbolTable symbolEntry = symbolTab->head;
 
     for(; symbolEntry != NULL; symbolEntry = symbolEntry->next)
     {
         if(symbolEntry->isEntry)
-            addToAttributesTable(symbolEntry->name, entry, symbolEntry->value, attributesHead);
+            addToAttributesTable(symbolEntry->name, entry, symbolEntry->value, attributesHead, attributesTail, memory);
     }
 }
 
 
-void freeSymbolTable(symbolTable head)
+void freeAssemblyContext(assemblyContext *context)
 {
-    symbolTable temp;
-    /* Deallocates the memory associated with each node in the linked list. */
-    while(head != NULL)
-    {
-        /* Pointer to the next node */
-        temp = head->next;
-        /* remove the current node */
-        free(head->name);
-        free(head);
-        /* Move to the next node */
-        head = temp;
-    }
+    /* Deallocates the growable arrays of the context */
+    free(context->symbolTab.slots);
+    free(context->codeImage.entries);
+    free(context->dataImage.bytes);
+    free(context->fixups.entries);
+    free(context->entries.entries);
+    free(context->source.content);
+    free(context->diagnostics);
+
+    /* The symbols, attributes and recorded names are all released at once, along with the arena */
+    freeArena(&context->memory);
+
+    /* Resets the context, so it can be used for the next file */
+    memset(context, 0, sizeof(assemblyContext));
 }
-
-
-void freeTables(codeTable codeHead, dataTable dataHead, attributesTable attributesHead)
-{
-    codeTable codeImageTemp;
-    dataTable dataImageTemp;
-    attributesTable attributesTemp;
-
-    /* Free code image */
-    while(codeHead != NULL)
-    {
-        codeImageTemp = codeHead->next;
-        free(codeHead->data);
-        free(codeHead);
-        codeHead = codeImageTemp;
-    }
-    /* Free data image */
-    while(dataHead != NULL)
-    {
-        dataImageTemp = dataHead->next;
-        free(dataHead);
-        dataHead = dataImageTemp;
-    }
-    /* Free attributes table */
-    while(attributesHead != NULL)
-    {
-        attributesTemp = attributesHead->next;
-        free(attributesHead->name);
-        free(attributesHead);
-        attributesHead = attributesTemp;
-    }
-}
\ No newline at end of file
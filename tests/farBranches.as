@@ -0,0 +1,8217 @@
+;file name: 'farBranches.as'
+;branches whose labels are at the edge of the 16-bit 'immed' field.
+;instructions are 4 bytes, so the farthest labels a branch reaches are
+;+32764 and -32768 bytes away, while +32768 and -32772 are out of range.
+;a branch out of range is relaxed into an inverted branch over a 'jmp'.
+;the relaxed branches never grow the code between a branch that fits
+;and its label, so the branches at the edge stay in range.
+
+;100 -> 32868 (+32768), relaxed
+	blt $1, $2, fwdOut1
+;104 -> 32872 (+32768), relaxed
+	bne $3, $4, fwdOut2
+;108 -> 32872 (+32764), fits
+	bgt $5, $6, fwdOut2
+;112 -> 32876 (+32764), fits
+	beq $7, $8, fwdIn
+backIn1: add $1, $2, $3
+backIn2: add $1, $2, $3
+backOut: add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+	add $1, $2, $3
+fwdOut1: sub $4, $5, $6
+fwdOut2: sub $4, $5, $6
+fwdIn: sub $4, $5, $6
+	or $7, $8, $9
+;32884 -> 116 (-32768), fits
+	blt $10, $11, backIn1
+;32888 -> 120 (-32768), fits
+	beq $12, $13, backIn2
+;32892 -> 120 (-32772), relaxed
+	bgt $14, $15, backIn2
+;32896 -> 124 (-32772), relaxed
+	bne $16, $17, backOut
+	stop
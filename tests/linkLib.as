@@ -0,0 +1,20 @@
+;file name: 'linkLib.as'
+;the library module of the program linked from 'linkMain.as' and 'linkLib.as'.
+;its entries are called by the main module ('call' leaves the return address
+;in $0), and it refers to the labels of the main module.
+
+	.entry square
+	.entry total
+	.entry finish
+	.extern counter
+	.extern main
+
+square:	move $1, $2
+	blt $1, $2, again
+	jmp $0
+again:	jmp main
+finish:	la counter
+	la total
+	stop
+
+total:	.dh 100, -1
@@ -0,0 +1,23 @@
+;file name: 'linkMain.as'
+;the main module of a program linked from 'linkMain.as' and 'linkLib.as'.
+;it calls a routine of the library, loads the data of both modules through
+;their linked addresses ($4 = 3, $5 = 100) and ends in the library.
+
+	.entry main
+	.entry counter
+	.extern square
+	.extern total
+	.extern finish
+
+main:	addi $0, 7, $1
+	call square
+	la counter
+	lw $0, 0, $4
+	la total
+	lh $0, 0, $5
+	bne $1, $2, skip
+	add $1, $2, $3
+skip:	jmp finish
+
+counter: .dw 3
+greeting: .asciz "hi"
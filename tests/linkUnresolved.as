@@ -0,0 +1,11 @@
+;file name: 'linkUnresolved.as'
+;a module that refers to a label no other module enters ('missing'),
+;and enters a label the library enters too ('total').
+
+	.entry total
+	.extern square
+	.extern missing
+
+	call square
+	jmp missing
+total:	stop
@@ -0,0 +1,100 @@
+#!/bin/sh
+#
+# Description: Checks the assembler and its tools against the expected outputs in this directory.
+#              - Every 'X.as' with an expected 'X.ob' is assembled, its '.ob' (and its '.ent' and '.ext', if expected)
+#                must be the same as the expected files.
+#              - 'linkMain.as' and 'linkLib.as' are linked by the linker and by 'assembler --link', both must write
+#                'linkProgram.ob'.
+#              - 'linkUnresolved.as' refers to a label no module enters and enters a label another module enters, the
+#                linker and 'assembler --link' must print the errors of 'linkUnresolvedLinker.err' and
+#                'linkUnresolvedAssembler.err' and write no file.
+#              - Every expected '.ob' (with its '.ent' and '.ext', if expected) is disassembled, and assembling the
+#                written source must yield the same files.
+#              - A code line of 200000 characters that the disassembler can't decode must be reported (exit status 1),
+#                and kept whole in the written source as a comment.
+#
+# Run (from the repository root, the programs are built with the commands of the README):
+#     sh tests/runTests.sh
+# Prints every failed check, and exits with 1 if any check failed.
+
+CC=${CC:-gcc}
+tests=$(cd "$(dirname "$0")" && pwd)
+root=$(dirname "$tests")
+work=$(mktemp -d)
+failed=0
+
+trap 'rm -rf "$work"' EXIT
+
+fail()
+{
+    echo "FAIL: $1"
+    failed=1
+}
+
+# The programs, built like the README builds them
+tools=$(ls "$root"/src/[a-z]*.c | grep -v /assembler.c)
+$CC -ansi -pedantic -O2 -o "$work/assembler" "$root"/src/*.c -pthread 2> /dev/null || { echo "FAIL: build assembler"; exit 1; }
+$CC -ansi -pedantic -O2 -o "$work/linker" "$root/linker/linker.c" $tools -pthread 2> /dev/null || { echo "FAIL: build linker"; exit 1; }
+$CC -ansi -pedantic -O2 -o "$work/disassembler" "$root/disassembler/disassembler.c" $tools -pthread 2> /dev/null ||
+    { echo "FAIL: build disassembler"; exit 1; }
+
+cp "$tests"/*.as "$work"
+cd "$work" || exit 1
+
+# Assembled files
+for expected in "$tests"/*.ob; do
+    name=$(basename "$expected" .ob)
+    [ -f "$name.as" ] || continue
+    ./assembler "$name.as" > /dev/null 2>&1
+    for extension in ob ent ext; do
+        if [ -f "$tests/$name.$extension" ]; then
+            cmp -s "$tests/$name.$extension" "$name.$extension" || fail "$name.$extension"
+        fi
+    done
+done
+
+# Linked modules
+./assembler linkMain.as linkLib.as linkUnresolved.as > /dev/null 2>&1
+./linker -o linkProgram.ob linkMain linkLib > /dev/null 2>&1
+cmp -s "$tests/linkProgram.ob" linkProgram.ob || fail "linker linkProgram.ob"
+rm -f linkProgram.ob
+./assembler --link linkProgram.ob linkMain.as linkLib.as > /dev/null 2>&1
+cmp -s "$tests/linkProgram.ob" linkProgram.ob || fail "assembler --link linkProgram.ob"
+
+# Unresolved and duplicate labels
+./linker -o unresolved.ob linkMain linkLib linkUnresolved > /dev/null 2> linker.err
+cmp -s "$tests/linkUnresolvedLinker.err" linker.err && [ ! -f unresolved.ob ] || fail "linker linkUnresolved"
+./assembler --link unresolved.ob linkMain.as linkLib.as linkUnresolved.as > /dev/null 2> assembler.err
+cmp -s "$tests/linkUnresolvedAssembler.err" assembler.err && [ ! -f unresolved.ob ] || fail "assembler --link linkUnresolved"
+
+# Disassembled programs, in a directory of their own so the expected files are the ones disassembled
+mkdir roundTrip
+for expected in "$tests"/*.ob; do
+    name=$(basename "$expected" .ob)
+    for extension in ob ent ext; do
+        [ -f "$tests/$name.$extension" ] && cp "$tests/$name.$extension" roundTrip
+    done
+    if ! (cd roundTrip && ../disassembler -o "${name}RoundTrip.as" "$name" > /dev/null 2>&1 &&
+          ../assembler "${name}RoundTrip.as" > /dev/null 2>&1); then
+        fail "round trip $name"
+        continue
+    fi
+    for extension in ob ent ext; do
+        if [ -f "$tests/$name.$extension" ]; then
+            cmp -s "$tests/$name.$extension" "roundTrip/${name}RoundTrip.$extension" || fail "round trip $name.$extension"
+        fi
+    done
+done
+
+# An invalid code line longer than the output buffer of the disassembler (its address has 200000 leading zeros)
+zeros=$(head -c 200000 /dev/zero | tr '\0' 0)
+printf '4 0\n%s100 FF FF FF FF\n' "$zeros" > longLine.ob
+./disassembler -o longLine.as longLine > /dev/null 2> longLine.err
+status=$?
+[ $status -eq 1 ] || fail "disassembler longLine exit status $status"
+grep -q "^Error! file 'longLine.ob' line 2: " longLine.err || fail "disassembler longLine error"
+awk '/^; 0+100 FF FF FF FF$/ && length($0) == 200017 { found = 1 } END { exit !found }' longLine.as ||
+    fail "disassembler longLine comment"
+
+[ $failed -eq 0 ] && echo "All the tests passed."
+exit $failed
@@ -4,7 +4,7 @@
 	labelV1: addi $1, -2, $3
 labelV2: add $10, $20, $30
 
-labelV4: blt $5  , $15,  V3
+labelV4: blt $5  , $15,  labelV3
 
 	.entry labelV3
 	.entry 	labelV4